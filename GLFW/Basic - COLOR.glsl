@@ -0,0 +1,17 @@
+// small color helpers, included more than once on purpose (second include is skipped)
+
+vec4 Grayscale(vec4 c)
+{
+   float l = dot(c.rgb, vec3(0.299, 0.587, 0.114));
+   return vec4(l, l, l, c.a);
+}
+
+vec4 Invert(vec4 c)
+{
+   return vec4(1.0 - c.rgb, c.a);
+}
+
+vec4 Posterize(vec4 c, float levels)
+{
+   return vec4(floor(c.rgb * levels) / levels, c.a);
+}
@@ -0,0 +1,35 @@
+#shader vertex
+#version 330 core
+
+layout(location = 0) in vec4 position;     // unit cube corner (-1 .. 1)
+
+/* per instance data (glVertexAttribDivisor = 1), only visible objects are in the buffer */
+layout(location = 1) in vec3 a_Offset;
+layout(location = 2) in vec3 a_Scale;      // half size of the box on every axis
+layout(location = 3) in vec4 a_Color;
+
+out vec4 v_Color;
+out gl_PerVertex { vec4 gl_Position; };
+
+uniform mat4 u_ViewProjection;
+
+void main()
+{
+   float shade = 0.6 + 0.2 * position.y + 0.1 * position.x;   // faces of the cube look different
+   v_Color = vec4(a_Color.rgb * shade, a_Color.a);
+   gl_Position = u_ViewProjection * vec4(position.xyz * a_Scale + a_Offset, 1.0);
+};
+
+
+
+#shader fragment
+#version 330 core
+
+layout(location = 0) out vec4 color;
+
+in vec4 v_Color;
+
+void main()
+{
+   color = v_Color;
+};
@@ -0,0 +1,41 @@
+#shader vertex
+#version 330 core
+
+#include "Basic - VERTEX.glsl"
+
+
+
+#shader fragment
+#version 330 core
+
+// features (set by the app, not written here): USE_UNIFORM_COLOR, GRAYSCALE, INVERT, POSTERIZE_LEVELS
+
+#include "Basic - COLOR.glsl"
+#include "Basic - COLOR.glsl"
+
+layout(location = 0) out vec4 color;
+
+#ifdef USE_UNIFORM_COLOR
+uniform vec4 u_Color; // anything starting with u_ is uniform
+#endif
+
+void main()
+{
+#ifdef USE_UNIFORM_COLOR
+   vec4 c = u_Color;
+#else
+   vec4 c = vec4(0.8, 0.2, 0.5, 1.0);
+#endif
+
+#ifdef GRAYSCALE
+   c = Grayscale(c);
+#endif
+#ifdef INVERT
+   c = Invert(c);
+#endif
+#if defined(POSTERIZE_LEVELS) && POSTERIZE_LEVELS > 0
+   c = Posterize(c, float(POSTERIZE_LEVELS));
+#endif
+
+   color = c;
+};
@@ -0,0 +1,32 @@
+#shader vertex
+#version 330 core
+
+layout(location = 0) in vec4 position;
+
+/* per instance data (glVertexAttribDivisor = 1) -> same value for all 4 vertices of one square */
+layout(location = 1) in vec2 a_Offset;
+layout(location = 2) in float a_Scale;
+layout(location = 3) in vec4 a_Color;  // replaces uniform u_Color
+
+out vec4 v_Color;
+out gl_PerVertex { vec4 gl_Position; };
+
+void main()
+{
+   v_Color = a_Color;
+   gl_Position = vec4(position.xy * a_Scale + a_Offset, position.z, position.w);
+};
+
+
+
+#shader fragment
+#version 330 core
+
+layout(location = 0) out vec4 color;
+
+in vec4 v_Color;
+
+void main()
+{
+   color = v_Color;
+};
@@ -0,0 +1,32 @@
+#shader vertex
+#version 330 core
+
+layout(location = 0) in vec4 position;     // 4 half floats
+layout(location = 1) in vec4 a_Normal;     // GL_INT_2_10_10_10_REV, normalized -> -1..1
+layout(location = 2) in vec4 a_Color;      // 4 x uint8, normalized -> 0..1
+
+out vec4 v_Color;
+out gl_PerVertex { vec4 gl_Position; };
+
+uniform vec3 u_Light;
+
+void main()
+{
+   float light = 0.3 + 0.7 * max(dot(normalize(a_Normal.xyz), normalize(u_Light)), 0.0);
+   v_Color = vec4(a_Color.rgb * light, a_Color.a);
+   gl_Position = vec4(position.xy, 0.0, 1.0);
+};
+
+
+
+#shader fragment
+#version 330 core
+
+layout(location = 0) out vec4 color;
+
+in vec4 v_Color;
+
+void main()
+{
+   color = v_Color;
+};
@@ -0,0 +1,29 @@
+#shader vertex
+#version 330 core
+
+layout(location = 0) in vec4 position;
+out gl_PerVertex { vec4 gl_Position; };
+
+uniform vec2 u_Offset;
+uniform float u_Scale;
+
+void main()
+{
+   gl_Position = vec4(position.xy * u_Scale + u_Offset, position.z, position.w);
+};
+
+
+
+#shader fragment
+#version 330 core
+
+layout(location = 0) out vec4 color;
+
+uniform vec4 u_Color; // anything starting with u_ is uniform
+uniform vec4 u_Tint[2];
+uniform float u_Unused; // never read, so the linker removes it (location -1)
+
+void main()
+{
+   color = u_Color * u_Tint[0] * u_Tint[1];
+};
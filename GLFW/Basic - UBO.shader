@@ -0,0 +1,48 @@
+#shader vertex
+#version 330 core
+
+layout(location = 0) in vec4 position;
+out gl_PerVertex { vec4 gl_Position; };
+
+layout(std140) uniform FrameData     // same for every draw and every program, filled once per frame
+{
+   vec4 u_Tint[2];
+   float u_Time;
+};
+
+layout(std140) uniform ObjectData    // one range of the frame buffer per draw
+{
+   vec4 u_Color;
+   vec2 u_Offset;
+   float u_Scale;
+};
+
+void main()
+{
+   gl_Position = vec4(position.xy * u_Scale + u_Offset, position.z, position.w);
+};
+
+
+
+#shader fragment
+#version 330 core
+
+layout(location = 0) out vec4 color;
+
+layout(std140) uniform FrameData
+{
+   vec4 u_Tint[2];
+   float u_Time;
+};
+
+layout(std140) uniform ObjectData
+{
+   vec4 u_Color;
+   vec2 u_Offset;
+   float u_Scale;
+};
+
+void main()
+{
+   color = u_Color * u_Tint[0] * u_Tint[1] * (0.75 + 0.25 * sin(u_Time));
+};
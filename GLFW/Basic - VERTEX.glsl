@@ -0,0 +1,9 @@
+// vertex stage shared by every Basic shader, include it right after #version
+
+layout(location = 0) in vec4 position;
+out gl_PerVertex { vec4 gl_Position; };
+
+void main()
+{
+   gl_Position = position;
+};
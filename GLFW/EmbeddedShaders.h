@@ -0,0 +1,323 @@
+/*
+
+GENERATED by HW_28--Embed_Shaders(generator).cpp from res/shaders, do not edit
+run the generator again after changing a .shader file (or add it as build step)
+
+*/
+
+#pragma once
+
+#include <string_view>
+#include <cstdint>
+
+
+namespace EmbeddedShaders {
+
+    /* FNV-1a 64 bit, constexpr so every hash below is computed by the compiler */
+    constexpr uint64_t Hash(std::string_view text, uint64_t hash = 14695981039346656037ull) {
+        for (char c : text) {
+            hash ^= (unsigned char)c;
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    struct Shader {
+        std::string_view file;          /* name of the .shader file, used to find an override */
+        std::string_view vertex;
+        std::string_view fragment;
+        uint64_t hash;                  /* of vertex + fragment, key for program caches */
+    };
+
+    constexpr Shader Make(std::string_view file, std::string_view vertex, std::string_view fragment) {
+        return { file, vertex, fragment, Hash(fragment, Hash(std::string_view("\0", 1), Hash(vertex))) };
+    }
+
+
+    /* Basic - BATCH.shader */
+    inline constexpr Shader Basic_BATCH = Make("Basic - BATCH.shader",
+        R"SHADER(#version 330 core
+
+layout(location = 0) in vec4 position;
+layout(location = 1) in vec4 a_Color;  // color now comes with every vertex instead of u_Color
+
+out vec4 v_Color;
+out gl_PerVertex { vec4 gl_Position; };
+
+void main()
+{
+   v_Color = a_Color;
+   gl_Position = position;
+};
+
+
+
+)SHADER",
+        R"SHADER(#version 330 core
+
+layout(location = 0) out vec4 color;
+
+in vec4 v_Color;
+
+void main()
+{
+   color = v_Color;
+};
+)SHADER");
+
+    /* Basic - CULLED.shader */
+    inline constexpr Shader Basic_CULLED = Make("Basic - CULLED.shader",
+        R"SHADER(#version 330 core
+
+layout(location = 0) in vec4 position;     // unit cube corner (-1 .. 1)
+
+/* per instance data (glVertexAttribDivisor = 1), only visible objects are in the buffer */
+layout(location = 1) in vec3 a_Offset;
+layout(location = 2) in vec3 a_Scale;      // half size of the box on every axis
+layout(location = 3) in vec4 a_Color;
+
+out vec4 v_Color;
+out gl_PerVertex { vec4 gl_Position; };
+
+uniform mat4 u_ViewProjection;
+
+void main()
+{
+   float shade = 0.6 + 0.2 * position.y + 0.1 * position.x;   // faces of the cube look different
+   v_Color = vec4(a_Color.rgb * shade, a_Color.a);
+   gl_Position = u_ViewProjection * vec4(position.xyz * a_Scale + a_Offset, 1.0);
+};
+
+
+
+)SHADER",
+        R"SHADER(#version 330 core
+
+layout(location = 0) out vec4 color;
+
+in vec4 v_Color;
+
+void main()
+{
+   color = v_Color;
+};
+)SHADER");
+
+    /* Basic - INSTANCED.shader */
+    inline constexpr Shader Basic_INSTANCED = Make("Basic - INSTANCED.shader",
+        R"SHADER(#version 330 core
+
+layout(location = 0) in vec4 position;
+
+/* per instance data (glVertexAttribDivisor = 1) -> same value for all 4 vertices of one square */
+layout(location = 1) in vec2 a_Offset;
+layout(location = 2) in float a_Scale;
+layout(location = 3) in vec4 a_Color;  // replaces uniform u_Color
+
+out vec4 v_Color;
+out gl_PerVertex { vec4 gl_Position; };
+
+void main()
+{
+   v_Color = a_Color;
+   gl_Position = vec4(position.xy * a_Scale + a_Offset, position.z, position.w);
+};
+
+
+
+)SHADER",
+        R"SHADER(#version 330 core
+
+layout(location = 0) out vec4 color;
+
+in vec4 v_Color;
+
+void main()
+{
+   color = v_Color;
+};
+)SHADER");
+
+    /* Basic - PACKED.shader */
+    inline constexpr Shader Basic_PACKED = Make("Basic - PACKED.shader",
+        R"SHADER(#version 330 core
+
+layout(location = 0) in vec4 position;     // 4 half floats
+layout(location = 1) in vec4 a_Normal;     // GL_INT_2_10_10_10_REV, normalized -> -1..1
+layout(location = 2) in vec4 a_Color;      // 4 x uint8, normalized -> 0..1
+
+out vec4 v_Color;
+out gl_PerVertex { vec4 gl_Position; };
+
+uniform vec3 u_Light;
+
+void main()
+{
+   float light = 0.3 + 0.7 * max(dot(normalize(a_Normal.xyz), normalize(u_Light)), 0.0);
+   v_Color = vec4(a_Color.rgb * light, a_Color.a);
+   gl_Position = vec4(position.xy, 0.0, 1.0);
+};
+
+
+
+)SHADER",
+        R"SHADER(#version 330 core
+
+layout(location = 0) out vec4 color;
+
+in vec4 v_Color;
+
+void main()
+{
+   color = v_Color;
+};
+)SHADER");
+
+    /* Basic - REFLECTION.shader */
+    inline constexpr Shader Basic_REFLECTION = Make("Basic - REFLECTION.shader",
+        R"SHADER(#version 330 core
+
+layout(location = 0) in vec4 position;
+out gl_PerVertex { vec4 gl_Position; };
+
+uniform vec2 u_Offset;
+uniform float u_Scale;
+
+void main()
+{
+   gl_Position = vec4(position.xy * u_Scale + u_Offset, position.z, position.w);
+};
+
+
+
+)SHADER",
+        R"SHADER(#version 330 core
+
+layout(location = 0) out vec4 color;
+
+uniform vec4 u_Color; // anything starting with u_ is uniform
+uniform vec4 u_Tint[2];
+uniform float u_Unused; // never read, so the linker removes it (location -1)
+
+void main()
+{
+   color = u_Color * u_Tint[0] * u_Tint[1];
+};
+)SHADER");
+
+    /* Basic - UBO.shader */
+    inline constexpr Shader Basic_UBO = Make("Basic - UBO.shader",
+        R"SHADER(#version 330 core
+
+layout(location = 0) in vec4 position;
+out gl_PerVertex { vec4 gl_Position; };
+
+layout(std140) uniform FrameData     // same for every draw and every program, filled once per frame
+{
+   vec4 u_Tint[2];
+   float u_Time;
+};
+
+layout(std140) uniform ObjectData    // one range of the frame buffer per draw
+{
+   vec4 u_Color;
+   vec2 u_Offset;
+   float u_Scale;
+};
+
+void main()
+{
+   gl_Position = vec4(position.xy * u_Scale + u_Offset, position.z, position.w);
+};
+
+
+
+)SHADER",
+        R"SHADER(#version 330 core
+
+layout(location = 0) out vec4 color;
+
+layout(std140) uniform FrameData
+{
+   vec4 u_Tint[2];
+   float u_Time;
+};
+
+layout(std140) uniform ObjectData
+{
+   vec4 u_Color;
+   vec2 u_Offset;
+   float u_Scale;
+};
+
+void main()
+{
+   color = u_Color * u_Tint[0] * u_Tint[1] * (0.75 + 0.25 * sin(u_Time));
+};
+)SHADER");
+
+    /* Basic - UNFORMS.shader */
+    inline constexpr Shader Basic_UNFORMS = Make("Basic - UNFORMS.shader",
+        R"SHADER(#version 330 core
+
+layout(location = 0) in vec4 position;
+out gl_PerVertex { vec4 gl_Position; };
+
+void main()
+{
+   gl_Position = position;
+};
+
+
+
+)SHADER",
+        R"SHADER(#version 330 core
+
+layout(location = 0) out vec4 color;
+
+uniform vec4 u_Color; // anything starting with u_ is uniform
+
+void main()
+{
+   color = u_Color;
+};
+)SHADER");
+
+    /* Basic.shader */
+    inline constexpr Shader Basic = Make("Basic.shader",
+        R"SHADER(#version 330 core
+
+layout(location = 0) in vec4 position;
+out gl_PerVertex { vec4 gl_Position; };
+
+void main()
+{
+   gl_Position = position;
+};
+
+
+
+)SHADER",
+        R"SHADER(#version 330 core
+
+layout(location = 0) out vec4 color;
+
+void main()
+{
+   color = vec4(0.8, 0.2, 0.5, 1.0);
+};
+)SHADER");
+
+
+    inline constexpr Shader All[] = {
+        Basic_BATCH,
+        Basic_CULLED,
+        Basic_INSTANCED,
+        Basic_PACKED,
+        Basic_REFLECTION,
+        Basic_UBO,
+        Basic_UNFORMS,
+        Basic,
+    };
+
+}
@@ -0,0 +1,490 @@
+/*
+
+Batch Rendering
+
+in HW_9 and HW_10 every object is one glDrawElements call, so to draw 50k squares we have to bind, set uniform and draw 50k times
+and most of the frame time is spent by the driver on the CPU and not by the GPU drawing
+
+so instead we put all squares (quads) of a frame in one big vertex buffer (GL_DYNAMIC_DRAW) and draw them with one glDrawElements
+color is moved from u_Color uniform to a vertex attribute so every quad can still have its own color
+index buffer is same for every frame (0 1 2 2 3 0 , 4 5 6 6 7 4 , ...) so it is created once at start
+we only flush (draw) early if buffer is full or if program / texture is changed
+
+at start both paths are benchmarked and we print how many quads can be drawn in one frame at 60 Hz (16.6 ms)
+(into a 1x1 viewport, so it is the submit cost and not the fill rate of the different quad sizes)
+
+*/
+
+
+
+
+#include <GL\glew.h>
+
+#include <GLFW/glfw3.h>
+
+
+#include <iostream>
+#include <fstream>  // to read file
+#include <string>   // To use getline func
+#include <sstream>
+#include <vector>
+#include <chrono>   // to measure frame time
+#include <cstddef>  // offsetof
+#include <math.h>
+
+
+/* ------------ MACRO ------------ */
+#define ASSERT(x) if (!(x)) __debugbreak(); // MSVC (microsoft compiler) specific command to stop executing the program
+
+#define GLCall(x) GLCLearError();\
+    x;\
+    ASSERT(GlLogCall(#x, __FILE__, __LINE__))
+
+/*
+# before a fucntion pass it as a stringand __FILE__and __LINE__ are macros to get file loc and line of fucntion
+and since MACROS HAS TO BE IN SAME LINE we use \ before line ends to write macros in multiple lines
+*/
+
+
+static void GLCLearError() {
+    while (glGetError() != GL_NO_ERROR);    // glGetError get error and we get all the error until there are no arror left
+}
+
+static bool GlLogCall(const char* function, const char* file, int line) {
+    while (GLenum error = glGetError()) {
+        std::cout << "[OpenGl Error] (" << error << "): " << function << " " << file << ":" << line << std::endl;
+        return false;
+    }
+    return true;
+}
+
+
+struct ShaderProgramSource {
+    std::string VertexSource;
+    std::string FragmentSource;
+};
+
+static ShaderProgramSource ParseShader(const std::string& filepath);
+
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader);
+
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source);
+
+
+
+/* ------------- BATCH RENDERER ------------- */
+
+/* one vertex of a quad in the batch -> position + color */
+struct QuadVertex {
+    float x, y;
+    float r, g, b, a;
+};
+
+class BatchRenderer {
+public:
+    static const unsigned int MaxQuads = 10000;            /* quads per flush, after this buffer is drawn and filled again */
+    static const unsigned int MaxVertices = MaxQuads * 4;
+    static const unsigned int MaxIndices = MaxQuads * 6;
+
+    BatchRenderer() {
+
+        GLCall(glGenVertexArrays(1, &m_Vao));
+        GLCall(glBindVertexArray(m_Vao));
+
+        /* vertex buffer has no data yet (nullptr) only space, it is filled every frame so GL_DYNAMIC_DRAW */
+        GLCall(glGenBuffers(1, &m_Vbo));
+        GLCall(glBindBuffer(GL_ARRAY_BUFFER, m_Vbo));
+        GLCall(glBufferData(GL_ARRAY_BUFFER, MaxVertices * sizeof(QuadVertex), nullptr, GL_DYNAMIC_DRAW));
+
+        GLCall(glEnableVertexAttribArray(0));
+        GLCall(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(QuadVertex), (const void*)offsetof(QuadVertex, x)));
+        GLCall(glEnableVertexAttribArray(1));
+        GLCall(glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(QuadVertex), (const void*)offsetof(QuadVertex, r)));
+
+        /* index buffer is same for every batch so it is made once here */
+        std::vector<unsigned int> indices(MaxIndices);
+        for (unsigned int i = 0, offset = 0; i < MaxIndices; i += 6, offset += 4) {
+            indices[i + 0] = offset + 0;
+            indices[i + 1] = offset + 1;
+            indices[i + 2] = offset + 2;
+            indices[i + 3] = offset + 2;
+            indices[i + 4] = offset + 3;
+            indices[i + 5] = offset + 0;
+        }
+
+        GLCall(glGenBuffers(1, &m_Ibo));
+        GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_Ibo));   /* ibo is stored in vao so no need to bind it again while drawing */
+        GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, MaxIndices * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW));
+
+        GLCall(glBindVertexArray(0));
+        GLCall(glBindBuffer(GL_ARRAY_BUFFER, 0));
+
+        m_Vertices.reserve(MaxVertices);
+    }
+
+    ~BatchRenderer() {
+        glDeleteBuffers(1, &m_Vbo);
+        glDeleteBuffers(1, &m_Ibo);
+        glDeleteVertexArrays(1, &m_Vao);
+    }
+
+    /* start of a frame */
+    void Begin() {
+        m_Vertices.clear();
+        m_DrawCalls = 0;
+        m_QuadCount = 0;
+    }
+
+    /* add one quad with (x, y) as bottom left corner, draw is done later in Flush() */
+    void DrawQuad(float x, float y, float w, float h, float r, float g, float b, float a,
+                  unsigned int program, unsigned int texture = 0) {
+
+        /* different program or texture cannot go in same draw call so draw what we have till now */
+        if (program != m_Program || texture != m_Texture) {
+            Flush();
+            m_Program = program;
+            m_Texture = texture;
+        }
+        if (m_Vertices.size() >= MaxVertices)
+            Flush();
+
+        m_Vertices.push_back({ x,     y,     r, g, b, a });
+        m_Vertices.push_back({ x + w, y,     r, g, b, a });
+        m_Vertices.push_back({ x + w, y + h, r, g, b, a });
+        m_Vertices.push_back({ x,     y + h, r, g, b, a });
+        m_QuadCount++;
+    }
+
+    /* end of a frame, draw whatever is left */
+    void End() {
+        Flush();
+    }
+
+    /* upload the vertices of the batch and draw them with one call */
+    void Flush() {
+        if (m_Vertices.empty())
+            return;
+
+        GLCall(glBindBuffer(GL_ARRAY_BUFFER, m_Vbo));
+        /* orphaning -> giving nullptr again lets driver give us new memory instead of waiting for last draw to finish */
+        GLCall(glBufferData(GL_ARRAY_BUFFER, MaxVertices * sizeof(QuadVertex), nullptr, GL_DYNAMIC_DRAW));
+        GLCall(glBufferSubData(GL_ARRAY_BUFFER, 0, m_Vertices.size() * sizeof(QuadVertex), m_Vertices.data()));
+
+        GLCall(glUseProgram(m_Program));
+        if (m_Texture != 0) {
+            GLCall(glActiveTexture(GL_TEXTURE0));
+            GLCall(glBindTexture(GL_TEXTURE_2D, m_Texture));
+        }
+        GLCall(glBindVertexArray(m_Vao));
+
+        GLCall(glDrawElements(GL_TRIANGLES, (int)(m_Vertices.size() / 4 * 6), GL_UNSIGNED_INT, nullptr));
+
+        m_Vertices.clear();
+        m_DrawCalls++;
+    }
+
+    unsigned int GetDrawCalls() const { return m_DrawCalls; }
+    unsigned int GetQuadCount() const { return m_QuadCount; }
+
+private:
+    unsigned int m_Vao = 0, m_Vbo = 0, m_Ibo = 0;
+    unsigned int m_Program = 0, m_Texture = 0;
+    std::vector<QuadVertex> m_Vertices;     /* cpu side copy of the batch */
+    unsigned int m_DrawCalls = 0;
+    unsigned int m_QuadCount = 0;
+};
+
+
+/* puts 'count' quads in a grid which cover the whole window */
+static void SubmitGrid(BatchRenderer& renderer, unsigned int program, unsigned int count, float r) {
+
+    unsigned int side = (unsigned int)ceil(sqrt((double)count));
+    float size = 2.0f / side;
+
+    for (unsigned int i = 0; i < count; i++) {
+        float x = -1.0f + (i % side) * size;
+        float y = -1.0f + (i / side) * size;
+        renderer.DrawQuad(x, y, size * 0.9f, size * 0.9f, r, (float)(i % side) / side, 0.5f, 1.0f, program);
+    }
+}
+
+
+
+int main(void)
+{
+    /* GLFW BASIC STUFF */
+        GLFWwindow* window;
+
+        /* Initialize the GLFW library */
+        if (!glfwInit())
+            return -1;
+
+
+        /* setting version 3.3 and core profile (i.e mordern opengl) */
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+
+        /* Create a windowed mode window and its OpenGL context */
+        window = glfwCreateWindow(640, 480, "Hello World", NULL, NULL);
+        if (!window)
+        {
+            glfwTerminate();
+            return -1;
+
+        }
+        /* Make the window's context current */
+        glfwMakeContextCurrent(window);
+
+    /*  END BASIC GLFW   */
+
+
+    /* Intitialize GLEW */
+        if (glewInit() != GLEW_OK) {
+            std::cout << "Error!" << std::endl;
+        }
+    /* END */
+
+    std::cout << glGetString(GL_VERSION) << std::endl;  /* prints the version of opengl using */
+
+    {   /* scope so that buffers (destructors) are deleted before glfwTerminate destroys the context */
+
+
+
+    /* ------------- Generating Data to be used to display in the window ------------- */
+
+        /* ------------- ONE OBJECT PATH (same as HW_10) ------------- */
+
+            float positions[] = {
+                -0.5f, -0.5f,    // 0
+                 0.5f, -0.5f,    // 1
+                 0.5f,  0.5f,    // 2
+                -0.5f,  0.5f     // 3
+            };
+
+            unsigned int indices[] = {
+                0, 1, 2,
+                2, 3, 0
+            };
+
+            unsigned int vao;
+            GLCall(glGenVertexArrays(1, &vao));
+            GLCall(glBindVertexArray(vao));
+
+            unsigned int buffer;
+            GLCall(glGenBuffers(1, &buffer));
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, buffer));
+            GLCall(glBufferData(GL_ARRAY_BUFFER, 4 * 2 * sizeof(float), positions, GL_STATIC_DRAW));
+
+            GLCall(glEnableVertexAttribArray(0));
+            GLCall(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2, 0));
+
+            unsigned int ibo;
+            GLCall(glGenBuffers(1, &ibo));
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo));
+            GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, 6 * sizeof(unsigned int), indices, GL_STATIC_DRAW));
+
+            GLCall(glBindVertexArray(0));
+
+
+        /* ------------- SHADERS ------------- */
+
+            ShaderProgramSource uniformSource = ParseShader("res/shaders/Basic - UNFORMS.shader");
+            unsigned int uniformShader = CreateShader(uniformSource.VertexSource, uniformSource.FragmentSource);
+
+            GLCall(int location = glGetUniformLocation(uniformShader, "u_Color"));
+            ASSERT(location != -1);
+
+            ShaderProgramSource batchSource = ParseShader("res/shaders/Basic - BATCH.shader");
+            unsigned int batchShader = CreateShader(batchSource.VertexSource, batchSource.FragmentSource);
+
+
+        /* ------------- BATCH ------------- */
+
+            BatchRenderer renderer;
+
+
+    /* ------------- END OF GENERATING DATA ------------- */
+
+
+
+    /* ------------- BENCHMARK ------------- */
+
+        /* swap interval 0 so frames are not locked to monitor refresh rate and we measure real cost of a frame */
+        glfwSwapInterval(0);
+
+        /* HW_10 squares are half the screen and grid quads are tiny, drawing both into 1 pixel
+           means fill rate is the same (almost nothing) and only the cost of submitting them is measured */
+        GLCall(glViewport(0, 0, 1, 1));
+
+        const unsigned int benchQuads = 50000;
+        const int benchFrames = 60;
+        const double frameBudgetMs = 1000.0 / 60.0;
+
+        /* one draw call per quad, color set by glUniform4f every time like HW_10 */
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int frame = 0; frame < benchFrames; frame++) {
+            glClear(GL_COLOR_BUFFER_BIT);
+            for (unsigned int i = 0; i < benchQuads; i++) {
+                GLCall(glUseProgram(uniformShader));
+                GLCall(glUniform4f(location, (float)(i % 256) / 255.0f, 0.2f, 0.5f, 1.0f));
+                GLCall(glBindVertexArray(vao));
+                GLCall(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr));
+            }
+            glFinish();     /* wait for gpu to finish so gpu time is also counted */
+        }
+        double objectMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count() / benchFrames;
+
+        /* all quads in one batch */
+        start = std::chrono::high_resolution_clock::now();
+        for (int frame = 0; frame < benchFrames; frame++) {
+            glClear(GL_COLOR_BUFFER_BIT);
+            renderer.Begin();
+            SubmitGrid(renderer, batchShader, benchQuads, 0.5f);
+            renderer.End();
+            glFinish();
+        }
+        double batchMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count() / benchFrames;
+
+        std::cout << "[Benchmark] " << benchQuads << " quads, " << benchFrames << " frames" << std::endl;
+        std::cout << "  one object per draw : " << objectMs << " ms/frame -> "
+                  << (unsigned int)(benchQuads * frameBudgetMs / objectMs) << " quads/frame at 60 Hz" << std::endl;
+        std::cout << "  batched             : " << batchMs << " ms/frame -> "
+                  << (unsigned int)(benchQuads * frameBudgetMs / batchMs) << " quads/frame at 60 Hz"
+                  << " (" << renderer.GetDrawCalls() << " draw calls)" << std::endl;
+
+        int width, height;
+        glfwGetFramebufferSize(window, &width, &height);
+        GLCall(glViewport(0, 0, width, height));
+        glfwSwapInterval(1);    /* back to normal */
+
+    /* ------------- END BENCHMARK ------------- */
+
+
+
+    /* ----------- Animation Variable ----------- */
+    float r = 0.0f;
+    float increment = 0.05f;
+
+
+
+    /* WHILE Loop to keep the window active till window is closed */
+    while (!glfwWindowShouldClose(window))
+    {
+        /* Render here */
+
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        renderer.Begin();
+        SubmitGrid(renderer, batchShader, benchQuads, r);
+        renderer.End();
+
+        if (r > 1.0f)
+            increment = -0.05f;
+        else if (r < 0.0f)
+            increment = 0.05f;
+
+        r += increment;
+
+
+        /* Swap front and back buffers */
+        glfwSwapBuffers(window);
+
+        /* Poll for and process events */
+        glfwPollEvents();
+    }
+
+    glDeleteBuffers(1, &buffer);
+    glDeleteBuffers(1, &ibo);
+    glDeleteVertexArrays(1, &vao);
+    glDeleteProgram(uniformShader);
+    glDeleteProgram(batchShader);
+    }
+
+    glfwTerminate();
+    return 0;
+}
+
+
+
+
+/* Makes and compile the shader by inputing the type and Source code */
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source) {
+
+    unsigned int id = glCreateShader(shaderType);   /* generate Shader and return id */
+    const char* src = source.c_str();               /* convert inputed string to char* */
+    GLCall(glShaderSource(id, 1, &src, nullptr));           /* attaching source code to the shader */
+    GLCall(glCompileShader(id));                            /* compile shader */
+
+    /* -------- ERROR HANDLING -------- */
+        int result;
+        GLCall(glGetShaderiv(id, GL_COMPILE_STATUS, &result));
+        if (result == GL_FALSE) {
+            int length;
+            GLCall(glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length));
+            char* message = (char*) _malloca(length * sizeof(char));      /* just means char Array of length 'length'  or    char message[length] */
+            GLCall(glGetShaderInfoLog(id, length, &length, message));
+
+            std::cout << "Failed To Compile " << (shaderType == GL_VERTEX_SHADER ? "vertex" : "fragment") << " shader" << std::endl;
+
+            std::cout << message << std::endl;
+            GLCall(glDeleteShader(id));
+            return 0;
+        }
+
+    /* -------- END ERROR HANDLING -------- */
+
+    return id;
+
+}
+
+
+/* Creates a program Which contain vertex and fragment shader */
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader) {
+
+    GLCall(unsigned int program = glCreateProgram());                           /* generate program to store all shader and program to be run by GPU during while loop */
+    unsigned int vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
+    unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+
+    GLCall(glAttachShader(program, vs));                                        /* Attach shader to program to be run by GPU */
+    GLCall(glAttachShader(program, fs));
+    GLCall(glLinkProgram(program));
+    GLCall(glValidateProgram(program));
+    GLCall(glDeleteShader(vs));                                                 /* DELETING shader to save space as shader is already attached to program */
+    GLCall(glDeleteShader(fs));
+
+    return program;
+
+}
+
+
+/* Read file and output vertex and fragment shader source code */
+static ShaderProgramSource ParseShader(const std::string& filepath) {
+
+    std::ifstream stream(filepath);
+
+    enum class ShaderType {
+        NONE = -1, VERTEX = 0, FRAGMENT = 1
+    };
+
+    std::string line;
+    std::stringstream ss[2];
+    ShaderType type = ShaderType::NONE;
+    while (getline(stream, line)) {
+
+        if (line.find("#shader") != std::string::npos) {
+
+            if (line.find("vertex") != std::string::npos)
+                type = ShaderType::VERTEX;
+            else if (line.find("fragment") != std::string::npos)
+                type = ShaderType::FRAGMENT;
+
+        }
+        else {
+            ss[int(type)] << line << '\n';
+        }
+    }
+
+    return { ss[0].str(), ss[1].str() };
+}
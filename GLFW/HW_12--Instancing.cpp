@@ -0,0 +1,416 @@
+/*
+
+Instancing
+
+in HW_7, HW_8 and HW_10 color is set with glGetUniformLocation(shader, "u_Color") and glUniform4f before the draw
+so N colored squares need N glUniform4f and N glDrawElements
+
+with instancing the data which is different for every square (offset, scale, color) goes in a second vertex buffer
+and glVertexAttribDivisor(attrib, 1) tells opengl to move to next value of that attribute once per instance (square) and not once per vertex
+then glDrawElementsInstanced draws all squares with only one call -> even 1 million squares is one draw
+
+both the normal VAO (from HW_10) and the instanced VAO are made below so both paths can be compared
+set s_UseInstancing to false to see the old path in the window
+
+*/
+
+
+
+
+#include <GL\glew.h>
+
+#include <GLFW/glfw3.h>
+
+
+#include <iostream>
+#include <fstream>  // to read file
+#include <string>   // To use getline func
+#include <sstream>
+#include <vector>
+#include <chrono>   // to measure frame time
+#include <cstddef>  // offsetof
+#include <math.h>
+
+
+/* ------------ MACRO ------------ */
+#define ASSERT(x) if (!(x)) __debugbreak(); // MSVC (microsoft compiler) specific command to stop executing the program
+
+#define GLCall(x) GLCLearError();\
+    x;\
+    ASSERT(GlLogCall(#x, __FILE__, __LINE__))
+
+/*
+# before a fucntion pass it as a stringand __FILE__and __LINE__ are macros to get file loc and line of fucntion
+and since MACROS HAS TO BE IN SAME LINE we use \ before line ends to write macros in multiple lines
+*/
+
+
+static void GLCLearError() {
+    while (glGetError() != GL_NO_ERROR);    // glGetError get error and we get all the error until there are no arror left
+}
+
+static bool GlLogCall(const char* function, const char* file, int line) {
+    while (GLenum error = glGetError()) {
+        std::cout << "[OpenGl Error] (" << error << "): " << function << " " << file << ":" << line << std::endl;
+        return false;
+    }
+    return true;
+}
+
+
+struct ShaderProgramSource {
+    std::string VertexSource;
+    std::string FragmentSource;
+};
+
+static ShaderProgramSource ParseShader(const std::string& filepath);
+
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader);
+
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source);
+
+
+/* data of one square (instance) -> this is what was u_Color before + where the square is */
+struct InstanceData {
+    float offsetX, offsetY;
+    float scale;
+    float r, g, b, a;
+};
+
+
+static const bool s_UseInstancing = true;         /* false -> draw with u_Color and one glDrawElements per square */
+static const unsigned int s_InstanceCount = 1000000;
+
+
+
+int main(void)
+{
+    /* GLFW BASIC STUFF */
+        GLFWwindow* window;
+
+        /* Initialize the GLFW library */
+        if (!glfwInit())
+            return -1;
+
+
+        /* setting version 3.3 and core profile (i.e mordern opengl) */
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+
+        /* Create a windowed mode window and its OpenGL context */
+        window = glfwCreateWindow(640, 480, "Hello World", NULL, NULL);
+        if (!window)
+        {
+            glfwTerminate();
+            return -1;
+
+        }
+        /* Make the window's context current */
+        glfwMakeContextCurrent(window);
+
+        glfwSwapInterval(1);    /* controls FPS or intervel between buffer(frames) */
+
+    /*  END BASIC GLFW   */
+
+
+    /* Intitialize GLEW */
+        if (glewInit() != GLEW_OK) {
+            std::cout << "Error!" << std::endl;
+        }
+    /* END */
+
+    std::cout << glGetString(GL_VERSION) << std::endl;  /* prints the version of opengl using */
+
+
+
+    /* ------------- Generating Data to be used to display in the window ------------- */
+
+        /* ------------- Vertex Info (like position, color, texture, smoothness, normal,etc) ------------- */
+
+            // 4 positions of vertices of sqaure
+            float positions[] = {
+                -0.5f, -0.5f,    // 0
+                 0.5f, -0.5f,    // 1
+                 0.5f,  0.5f,    // 2
+                -0.5f,  0.5f     // 3
+            };
+
+            // Index data -----> position in which vertices is to be rendered to form a square
+            unsigned int indices[] = {
+                0, 1, 2,
+                2, 3, 0
+            };
+
+
+        /* ------------- VERTEX ARRAY OBJECT (same as HW_10) ------------- */
+            unsigned int vao;
+            GLCall(glGenVertexArrays(1, &vao));
+            GLCall(glBindVertexArray(vao));
+
+            unsigned int buffer;
+            GLCall(glGenBuffers(1, &buffer));
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, buffer));
+            GLCall(glBufferData(GL_ARRAY_BUFFER, 4 * 2 * sizeof(float), positions, GL_STATIC_DRAW));
+
+            GLCall(glEnableVertexAttribArray(0));
+            GLCall(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2, 0));
+
+            unsigned int ibo;       // index buffer object
+            GLCall(glGenBuffers(1, &ibo));
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo));
+            GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, 6 * sizeof(unsigned int), indices, GL_STATIC_DRAW));
+
+
+        /* ------------- INSTANCE DATA ------------- */
+
+            /* squares in a grid covering the window, color changes with position */
+            std::vector<InstanceData> instances(s_InstanceCount);
+            unsigned int side = (unsigned int)ceil(sqrt((double)s_InstanceCount));
+            float cell = 2.0f / side;
+            for (unsigned int i = 0; i < s_InstanceCount; i++) {
+                unsigned int col = i % side, row = i / side;
+                instances[i] = { -1.0f + (col + 0.5f) * cell, -1.0f + (row + 0.5f) * cell, cell * 0.9f,
+                                 (float)col / side, 0.2f, (float)row / side, 1.0f };
+            }
+
+
+        /* ------------- INSTANCED VERTEX ARRAY OBJECT ------------- */
+
+            /* uses same square buffer and ibo as above, only the instance buffer is new */
+            unsigned int instancedVao;
+            GLCall(glGenVertexArrays(1, &instancedVao));
+            GLCall(glBindVertexArray(instancedVao));
+
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, buffer));
+            GLCall(glEnableVertexAttribArray(0));
+            GLCall(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2, 0));
+
+            unsigned int instanceBuffer;
+            GLCall(glGenBuffers(1, &instanceBuffer));
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer));
+            GLCall(glBufferData(GL_ARRAY_BUFFER, instances.size() * sizeof(InstanceData), instances.data(), GL_STATIC_DRAW));
+
+            GLCall(glEnableVertexAttribArray(1));
+            GLCall(glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (const void*)offsetof(InstanceData, offsetX)));
+            GLCall(glVertexAttribDivisor(1, 1));        /* 1 -> next value after every 1 instance */
+
+            GLCall(glEnableVertexAttribArray(2));
+            GLCall(glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (const void*)offsetof(InstanceData, scale)));
+            GLCall(glVertexAttribDivisor(2, 1));
+
+            GLCall(glEnableVertexAttribArray(3));
+            GLCall(glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (const void*)offsetof(InstanceData, r)));
+            GLCall(glVertexAttribDivisor(3, 1));
+
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo));  /* ibo binding is part of vao state */
+
+
+        /* ------------- SHADERS ------------- */
+
+            ShaderProgramSource shaderSource = ParseShader("res/shaders/Basic - UNFORMS.shader");
+            unsigned int shader = CreateShader(shaderSource.VertexSource, shaderSource.FragmentSource);
+
+            GLCall(int location = glGetUniformLocation(shader, "u_Color"));
+            ASSERT(location != -1);
+
+            ShaderProgramSource instancedSource = ParseShader("res/shaders/Basic - INSTANCED.shader");
+            unsigned int instancedShader = CreateShader(instancedSource.VertexSource, instancedSource.FragmentSource);
+
+
+    /* ------------- END OF GENERATING DATA ------------- */
+
+
+    /* ----------- Unbound everything ----------- */
+
+            GLCall(glUseProgram(0));
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, 0));           //buffer
+            GLCall(glBindVertexArray(0));                       // Vao
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));   // inbex buffer
+
+
+
+    /* ------------- BENCHMARK ------------- */
+
+        glfwSwapInterval(0);    /* not locked to monitor so we see the real cost */
+
+        const unsigned int benchSquares = 100000;
+        const int benchFrames = 30;
+
+        /* HW_10 path -> per square data set before every glDrawElements
+           same squares as the instanced path (same offset, scale, color), so only the way they are submitted differs:
+           the HW_10 vao has no attributes 1 .. 3 enabled, so the instanced shader takes the glVertexAttrib* value (like a uniform) */
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int frame = 0; frame < benchFrames; frame++) {
+            glClear(GL_COLOR_BUFFER_BIT);
+            GLCall(glUseProgram(instancedShader));
+            GLCall(glBindVertexArray(vao));
+            for (unsigned int i = 0; i < benchSquares; i++) {
+                const InstanceData& d = instances[i];
+                GLCall(glVertexAttrib2f(1, d.offsetX, d.offsetY));
+                GLCall(glVertexAttrib1f(2, d.scale));
+                GLCall(glVertexAttrib4f(3, d.r, d.g, d.b, d.a));
+                GLCall(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr));
+            }
+            glFinish();
+        }
+        double uniformMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count() / benchFrames;
+
+        /* instanced path -> one call for same number of squares */
+        start = std::chrono::high_resolution_clock::now();
+        for (int frame = 0; frame < benchFrames; frame++) {
+            glClear(GL_COLOR_BUFFER_BIT);
+            GLCall(glUseProgram(instancedShader));
+            GLCall(glBindVertexArray(instancedVao));
+            GLCall(glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr, benchSquares));
+            glFinish();
+        }
+        double instancedMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count() / benchFrames;
+
+        std::cout << "[Benchmark] " << benchSquares << " squares, " << benchFrames << " frames" << std::endl;
+        std::cout << "  glVertexAttrib* + glDrawElements     : " << uniformMs << " ms/frame (" << benchSquares << " draws)" << std::endl;
+        std::cout << "  glDrawElementsInstanced             : " << instancedMs << " ms/frame (1 draw)" << std::endl;
+
+        glfwSwapInterval(1);
+
+    /* ------------- END BENCHMARK ------------- */
+
+
+
+    /* ----------- Animation Variable ----------- */
+    float r = 0.0f;
+    float increment = 0.05f;
+
+
+
+    /* WHILE Loop to keep the window active till window is closed */
+    while (!glfwWindowShouldClose(window))
+    {
+        /* Render here */
+
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        if (s_UseInstancing) {
+            /* all squares, colors come from instance buffer so no uniform here */
+            GLCall(glUseProgram(instancedShader));
+            GLCall(glBindVertexArray(instancedVao));
+            GLCall(glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr, s_InstanceCount));
+        }
+        else {
+            /* old path, one square with animated color */
+            GLCall(glUseProgram(shader));
+            GLCall(glUniform4f(location, r, 0.2f, 0.5f, 1.0f));
+            GLCall(glBindVertexArray(vao));
+            GLCall(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr));
+        }
+
+        if (r > 1.0f)
+            increment = -0.05f;
+        else if (r < 0.0f)
+            increment = 0.05f;
+
+        r += increment;
+
+
+        /* Swap front and back buffers */
+        glfwSwapBuffers(window);
+
+        /* Poll for and process events */
+        glfwPollEvents();
+    }
+
+    glDeleteBuffers(1, &buffer);
+    glDeleteBuffers(1, &instanceBuffer);
+    glDeleteBuffers(1, &ibo);
+    glDeleteVertexArrays(1, &vao);
+    glDeleteVertexArrays(1, &instancedVao);
+    glDeleteProgram(shader);
+    glDeleteProgram(instancedShader);
+
+    glfwTerminate();
+    return 0;
+}
+
+
+
+
+/* Makes and compile the shader by inputing the type and Source code */
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source) {
+
+    unsigned int id = glCreateShader(shaderType);   /* generate Shader and return id */
+    const char* src = source.c_str();               /* convert inputed string to char* */
+    GLCall(glShaderSource(id, 1, &src, nullptr));           /* attaching source code to the shader */
+    GLCall(glCompileShader(id));                            /* compile shader */
+
+    /* -------- ERROR HANDLING -------- */
+        int result;
+        GLCall(glGetShaderiv(id, GL_COMPILE_STATUS, &result));
+        if (result == GL_FALSE) {
+            int length;
+            GLCall(glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length));
+            char* message = (char*) _malloca(length * sizeof(char));      /* just means char Array of length 'length'  or    char message[length] */
+            GLCall(glGetShaderInfoLog(id, length, &length, message));
+
+            std::cout << "Failed To Compile " << (shaderType == GL_VERTEX_SHADER ? "vertex" : "fragment") << " shader" << std::endl;
+
+            std::cout << message << std::endl;
+            GLCall(glDeleteShader(id));
+            return 0;
+        }
+
+    /* -------- END ERROR HANDLING -------- */
+
+    return id;
+
+}
+
+
+/* Creates a program Which contain vertex and fragment shader */
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader) {
+
+    GLCall(unsigned int program = glCreateProgram());                           /* generate program to store all shader and program to be run by GPU during while loop */
+    unsigned int vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
+    unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+
+    GLCall(glAttachShader(program, vs));                                        /* Attach shader to program to be run by GPU */
+    GLCall(glAttachShader(program, fs));
+    GLCall(glLinkProgram(program));
+    GLCall(glValidateProgram(program));
+    GLCall(glDeleteShader(vs));                                                 /* DELETING shader to save space as shader is already attached to program */
+    GLCall(glDeleteShader(fs));
+
+    return program;
+
+}
+
+
+/* Read file and output vertex and fragment shader source code */
+static ShaderProgramSource ParseShader(const std::string& filepath) {
+
+    std::ifstream stream(filepath);
+
+    enum class ShaderType {
+        NONE = -1, VERTEX = 0, FRAGMENT = 1
+    };
+
+    std::string line;
+    std::stringstream ss[2];
+    ShaderType type = ShaderType::NONE;
+    while (getline(stream, line)) {
+
+        if (line.find("#shader") != std::string::npos) {
+
+            if (line.find("vertex") != std::string::npos)
+                type = ShaderType::VERTEX;
+            else if (line.find("fragment") != std::string::npos)
+                type = ShaderType::FRAGMENT;
+
+        }
+        else {
+            ss[int(type)] << line << '\n';
+        }
+    }
+
+    return { ss[0].str(), ss[1].str() };
+}
@@ -0,0 +1,448 @@
+/*
+
+Streaming Buffer (ring buffer)
+
+till now every buffer is made once with glBufferData(..., GL_STATIC_DRAW) but when the vertices change every frame (animation)
+uploading them again with glBufferData makes the driver wait or copy because the GPU may still be drawing last frame from that buffer
+
+so we make one big buffer split in N parts (regions), one part per frame
+frame 0 writes in region 0, frame 1 in region 1 ... and then back to region 0 (ring)
+after drawing from a region we put a fence (glFenceSync), and before writing to that region again we wait on the fence (glClientWaitSync)
+so cpu never writes over data which the GPU is still reading
+
+if GL_ARB_buffer_storage is there (GL 4.4) the buffer is mapped only once with PERSISTENT | COHERENT and we write directly to it
+else (GL 3.3 core) the region is mapped every frame with glMapBufferRange + GL_MAP_UNSYNCHRONIZED_BIT (we do the syncing ourself with fences)
+
+bytes streamed and time spent waiting on fences is counted, if wait time is high the ring has too few / too small regions
+
+*/
+
+
+
+
+#include <GL\glew.h>
+
+#include <GLFW/glfw3.h>
+
+
+#include <iostream>
+#include <fstream>  // to read file
+#include <string>   // To use getline func
+#include <sstream>
+#include <vector>
+#include <chrono>   // to measure fence wait time
+#include <cstddef>  // offsetof
+#include <math.h>
+
+
+/* ------------ MACRO ------------ */
+#define ASSERT(x) if (!(x)) __debugbreak(); // MSVC (microsoft compiler) specific command to stop executing the program
+
+#define GLCall(x) GLCLearError();\
+    x;\
+    ASSERT(GlLogCall(#x, __FILE__, __LINE__))
+
+/*
+# before a fucntion pass it as a stringand __FILE__and __LINE__ are macros to get file loc and line of fucntion
+and since MACROS HAS TO BE IN SAME LINE we use \ before line ends to write macros in multiple lines
+*/
+
+
+static void GLCLearError() {
+    while (glGetError() != GL_NO_ERROR);    // glGetError get error and we get all the error until there are no arror left
+}
+
+static bool GlLogCall(const char* function, const char* file, int line) {
+    while (GLenum error = glGetError()) {
+        std::cout << "[OpenGl Error] (" << error << "): " << function << " " << file << ":" << line << std::endl;
+        return false;
+    }
+    return true;
+}
+
+
+struct ShaderProgramSource {
+    std::string VertexSource;
+    std::string FragmentSource;
+};
+
+static ShaderProgramSource ParseShader(const std::string& filepath);
+
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader);
+
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source);
+
+
+
+/* ------------- STREAMING BUFFER ------------- */
+
+class StreamBuffer {
+public:
+    /* regionSize -> bytes one frame can write, regionCount -> how many frames can be in flight */
+    StreamBuffer(GLenum target, unsigned int regionSize, unsigned int regionCount = 3)
+        : m_Target(target), m_RegionSize(regionSize), m_RegionCount(regionCount), m_Fences(regionCount, nullptr) {
+
+        m_Persistent = GLEW_ARB_buffer_storage != GL_FALSE;
+
+        GLCall(glGenBuffers(1, &m_Buffer));
+        GLCall(glBindBuffer(m_Target, m_Buffer));
+
+        if (m_Persistent) {
+            /* storage can't be resized later, and it stays mapped for whole life of buffer */
+            GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            GLCall(glBufferStorage(m_Target, (GLsizeiptr)m_RegionSize * m_RegionCount, nullptr, flags));
+            GLCall(m_Mapped = (char*)glMapBufferRange(m_Target, 0, (GLsizeiptr)m_RegionSize * m_RegionCount, flags));
+        }
+        else {
+            GLCall(glBufferData(m_Target, (GLsizeiptr)m_RegionSize * m_RegionCount, nullptr, GL_STREAM_DRAW));
+        }
+    }
+
+    ~StreamBuffer() {
+        for (GLsync fence : m_Fences)
+            if (fence)
+                glDeleteSync(fence);
+
+        glBindBuffer(m_Target, m_Buffer);
+        if (m_Persistent)
+            glUnmapBuffer(m_Target);
+        glDeleteBuffers(1, &m_Buffer);
+    }
+
+    /* waits till GPU is done with the current region and gives pointer to write in it */
+    void* Map() {
+        WaitForRegion(m_Region);
+
+        if (m_Persistent)
+            return m_Mapped + GetOffset();
+
+        /* UNSYNCHRONIZED -> driver does not wait for GPU, fence above already did that */
+        GLCall(glBindBuffer(m_Target, m_Buffer));
+        GLCall(void* ptr = glMapBufferRange(m_Target, GetOffset(), m_RegionSize,
+            GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT));
+        return ptr;
+    }
+
+    /* call after writing 'bytes' in the pointer from Map() */
+    void Unmap(unsigned int bytes) {
+        ASSERT(bytes <= m_RegionSize);
+        m_BytesStreamed += bytes;
+
+        if (!m_Persistent) {
+            GLCall(glBindBuffer(m_Target, m_Buffer));
+            GLCall(glUnmapBuffer(m_Target));
+        }
+    }
+
+    /* call after all draws reading the current region are issued, then moves to the next region */
+    void Fence() {
+        GLCall(m_Fences[m_Region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+        m_Region = (m_Region + 1) % m_RegionCount;
+    }
+
+    unsigned int GetBuffer() const { return m_Buffer; }
+    unsigned int GetOffset() const { return m_Region * m_RegionSize; }     /* byte offset of current region */
+    bool IsPersistent() const { return m_Persistent; }
+
+    unsigned long long GetBytesStreamed() const { return m_BytesStreamed; }
+    double GetFenceWaitMs() const { return m_FenceWaitMs; }
+    unsigned int GetStalls() const { return m_Stalls; }         /* times the fence was not ready and cpu had to wait */
+
+private:
+    void WaitForRegion(unsigned int region) {
+        GLsync fence = m_Fences[region];
+        if (!fence)
+            return;
+
+        auto start = std::chrono::high_resolution_clock::now();
+
+        /* first check without waiting, if not ready flush commands and wait (timeout in nanoseconds) */
+        GLenum result = glClientWaitSync(fence, 0, 0);
+        if (result == GL_TIMEOUT_EXPIRED) {
+            m_Stalls++;
+            do {
+                result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+            } while (result == GL_TIMEOUT_EXPIRED);
+        }
+        ASSERT(result != GL_WAIT_FAILED);
+
+        m_FenceWaitMs += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+        glDeleteSync(fence);
+        m_Fences[region] = nullptr;
+    }
+
+    unsigned int m_Buffer = 0;
+    GLenum m_Target;
+    unsigned int m_RegionSize;
+    unsigned int m_RegionCount;
+    unsigned int m_Region = 0;
+    std::vector<GLsync> m_Fences;       /* one fence per region */
+    bool m_Persistent = false;
+    char* m_Mapped = nullptr;           /* only used when persistent */
+
+    unsigned long long m_BytesStreamed = 0;
+    double m_FenceWaitMs = 0.0;
+    unsigned int m_Stalls = 0;
+};
+
+
+/* vertex which is streamed every frame -> position + color */
+struct StreamVertex {
+    float x, y;
+    float r, g, b, a;
+};
+
+
+
+int main(void)
+{
+    /* GLFW BASIC STUFF */
+        GLFWwindow* window;
+
+        /* Initialize the GLFW library */
+        if (!glfwInit())
+            return -1;
+
+
+        /* setting version 3.3 and core profile (i.e mordern opengl) */
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+
+        /* Create a windowed mode window and its OpenGL context */
+        window = glfwCreateWindow(640, 480, "Hello World", NULL, NULL);
+        if (!window)
+        {
+            glfwTerminate();
+            return -1;
+
+        }
+        /* Make the window's context current */
+        glfwMakeContextCurrent(window);
+
+        glfwSwapInterval(1);    /* controls FPS or intervel between buffer(frames) */
+
+    /*  END BASIC GLFW   */
+
+
+    /* Intitialize GLEW */
+        if (glewInit() != GLEW_OK) {
+            std::cout << "Error!" << std::endl;
+        }
+    /* END */
+
+    std::cout << glGetString(GL_VERSION) << std::endl;  /* prints the version of opengl using */
+
+    {   /* scope so that buffers (destructors) are deleted before glfwTerminate destroys the context */
+
+
+
+    /* ------------- Generating Data to be used to display in the window ------------- */
+
+        const unsigned int quadCount = 20000;
+        const unsigned int side = (unsigned int)ceil(sqrt((double)quadCount));
+
+        /* ------------- VERTEX ARRAY OBJECT ------------- */
+            unsigned int vao;
+            GLCall(glGenVertexArrays(1, &vao));
+            GLCall(glBindVertexArray(vao));
+
+
+        /* ------------- STREAMING BUFFER ------------- */
+
+            StreamBuffer stream(GL_ARRAY_BUFFER, quadCount * 4 * sizeof(StreamVertex), 3);
+            std::cout << "Streaming buffer: " << (stream.IsPersistent() ? "persistent mapped (ARB_buffer_storage)" : "glMapBufferRange unsynchronized") << std::endl;
+
+            /* attribute offsets are from start of buffer, the region is selected with basevertex in the draw */
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, stream.GetBuffer()));
+            GLCall(glEnableVertexAttribArray(0));
+            GLCall(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(StreamVertex), (const void*)offsetof(StreamVertex, x)));
+            GLCall(glEnableVertexAttribArray(1));
+            GLCall(glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(StreamVertex), (const void*)offsetof(StreamVertex, r)));
+
+
+        /* ------------- INDEX BUFFER ------------- */
+
+            /* indices never change so they are static like before */
+            std::vector<unsigned int> indices(quadCount * 6);
+            for (unsigned int i = 0; i < quadCount; i++) {
+                unsigned int v = i * 4;
+                unsigned int q[] = { v + 0, v + 1, v + 2, v + 2, v + 3, v + 0 };
+                std::copy(q, q + 6, indices.begin() + i * 6);
+            }
+
+            unsigned int ibo;       // index buffer object
+            GLCall(glGenBuffers(1, &ibo));
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo));
+            GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW));
+
+
+        /* ------------- SHADERS ------------- */
+
+            ShaderProgramSource shaderSource = ParseShader("res/shaders/Basic - BATCH.shader");
+            unsigned int shader = CreateShader(shaderSource.VertexSource, shaderSource.FragmentSource);
+
+
+    /* ------------- END OF GENERATING DATA ------------- */
+
+
+    /* ----------- Unbound everything ----------- */
+
+            GLCall(glUseProgram(0));
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, 0));
+            GLCall(glBindVertexArray(0));
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
+
+
+
+    /* ----------- Animation Variable ----------- */
+    float t = 0.0f;
+    unsigned int frame = 0;
+
+
+
+    /* WHILE Loop to keep the window active till window is closed */
+    while (!glfwWindowShouldClose(window))
+    {
+        /* Render here */
+
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        /* ------------- write this frame's vertices directly in the buffer ------------- */
+        StreamVertex* v = (StreamVertex*)stream.Map();
+        float cell = 2.0f / side;
+        for (unsigned int i = 0; i < quadCount; i++) {
+            float x = -1.0f + (i % side) * cell;
+            float y = -1.0f + (i / side) * cell;
+            float s = cell * (0.5f + 0.4f * sinf(t + x * 4.0f + y * 3.0f));     /* every quad grows and shrinks -> data changes every frame */
+            float r = 0.5f + 0.5f * sinf(t + x);
+
+            *v++ = { x,     y,     r, 0.2f, 0.5f, 1.0f };
+            *v++ = { x + s, y,     r, 0.2f, 0.5f, 1.0f };
+            *v++ = { x + s, y + s, r, 0.2f, 0.5f, 1.0f };
+            *v++ = { x,     y + s, r, 0.2f, 0.5f, 1.0f };
+        }
+        stream.Unmap(quadCount * 4 * sizeof(StreamVertex));
+
+        GLCall(glUseProgram(shader));
+        GLCall(glBindVertexArray(vao));
+        /* basevertex moves the whole draw to the current region of the ring */
+        GLCall(glDrawElementsBaseVertex(GL_TRIANGLES, quadCount * 6, GL_UNSIGNED_INT, nullptr, stream.GetOffset() / sizeof(StreamVertex)));
+
+        stream.Fence();
+
+        t += 0.05f;
+        frame++;
+
+        if (frame % 300 == 0) {
+            std::cout << "[Stream] frames " << frame
+                      << "  MB streamed " << stream.GetBytesStreamed() / (1024.0 * 1024.0)
+                      << "  fence wait " << stream.GetFenceWaitMs() << " ms"
+                      << "  stalls " << stream.GetStalls() << std::endl;
+        }
+
+
+        /* Swap front and back buffers */
+        glfwSwapBuffers(window);
+
+        /* Poll for and process events */
+        glfwPollEvents();
+    }
+
+    std::cout << "[Stream] total MB streamed " << stream.GetBytesStreamed() / (1024.0 * 1024.0)
+              << ", fence wait " << stream.GetFenceWaitMs() << " ms over " << frame << " frames"
+              << ", stalls " << stream.GetStalls() << " (if stalls are high use more regions)" << std::endl;
+
+    glDeleteBuffers(1, &ibo);
+    glDeleteVertexArrays(1, &vao);
+    glDeleteProgram(shader);
+    }
+
+    glfwTerminate();
+    return 0;
+}
+
+
+
+
+/* Makes and compile the shader by inputing the type and Source code */
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source) {
+
+    unsigned int id = glCreateShader(shaderType);   /* generate Shader and return id */
+    const char* src = source.c_str();               /* convert inputed string to char* */
+    GLCall(glShaderSource(id, 1, &src, nullptr));           /* attaching source code to the shader */
+    GLCall(glCompileShader(id));                            /* compile shader */
+
+    /* -------- ERROR HANDLING -------- */
+        int result;
+        GLCall(glGetShaderiv(id, GL_COMPILE_STATUS, &result));
+        if (result == GL_FALSE) {
+            int length;
+            GLCall(glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length));
+            char* message = (char*) _malloca(length * sizeof(char));      /* just means char Array of length 'length'  or    char message[length] */
+            GLCall(glGetShaderInfoLog(id, length, &length, message));
+
+            std::cout << "Failed To Compile " << (shaderType == GL_VERTEX_SHADER ? "vertex" : "fragment") << " shader" << std::endl;
+
+            std::cout << message << std::endl;
+            GLCall(glDeleteShader(id));
+            return 0;
+        }
+
+    /* -------- END ERROR HANDLING -------- */
+
+    return id;
+
+}
+
+
+/* Creates a program Which contain vertex and fragment shader */
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader) {
+
+    GLCall(unsigned int program = glCreateProgram());                           /* generate program to store all shader and program to be run by GPU during while loop */
+    unsigned int vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
+    unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+
+    GLCall(glAttachShader(program, vs));                                        /* Attach shader to program to be run by GPU */
+    GLCall(glAttachShader(program, fs));
+    GLCall(glLinkProgram(program));
+    GLCall(glValidateProgram(program));
+    GLCall(glDeleteShader(vs));                                                 /* DELETING shader to save space as shader is already attached to program */
+    GLCall(glDeleteShader(fs));
+
+    return program;
+
+}
+
+
+/* Read file and output vertex and fragment shader source code */
+static ShaderProgramSource ParseShader(const std::string& filepath) {
+
+    std::ifstream stream(filepath);
+
+    enum class ShaderType {
+        NONE = -1, VERTEX = 0, FRAGMENT = 1
+    };
+
+    std::string line;
+    std::stringstream ss[2];
+    ShaderType type = ShaderType::NONE;
+    while (getline(stream, line)) {
+
+        if (line.find("#shader") != std::string::npos) {
+
+            if (line.find("vertex") != std::string::npos)
+                type = ShaderType::VERTEX;
+            else if (line.find("fragment") != std::string::npos)
+                type = ShaderType::FRAGMENT;
+
+        }
+        else {
+            ss[int(type)] << line << '\n';
+        }
+    }
+
+    return { ss[0].str(), ss[1].str() };
+}
@@ -0,0 +1,485 @@
+/*
+
+GL State Cache
+
+in HW_9 the loop calls glUseProgram, glBindBuffer, glEnableVertexAttribArray, glVertexAttribPointer ... every frame for every object
+and HW_10 still binds program, vao and ibo every time even if they are already bound
+opengl does not check this for us cheaply, every call goes in the driver and costs cpu time
+
+so we keep a copy (shadow) of what is bound right now on the cpu side
+and only call opengl if the new value is different, otherwise the call is skipped (elided)
+number of issued and elided calls are counted so we can see how much was saved
+
+NOTE -> GL_ELEMENT_ARRAY_BUFFER binding is stored inside the vao, so when vao changes that cached value is reset
+NOTE -> if some code calls gl directly (not through cache) call Invalidate() after it, or cache will be wrong
+
+*/
+
+
+
+
+#include <GL\glew.h>
+
+#include <GLFW/glfw3.h>
+
+
+#include <iostream>
+#include <fstream>  // to read file
+#include <string>   // To use getline func
+#include <sstream>
+#include <vector>
+#include <chrono>   // to measure frame time
+#include <math.h>
+
+
+/* ------------ MACRO ------------ */
+#define ASSERT(x) if (!(x)) __debugbreak(); // MSVC (microsoft compiler) specific command to stop executing the program
+
+#define GLCall(x) GLCLearError();\
+    x;\
+    ASSERT(GlLogCall(#x, __FILE__, __LINE__))
+
+/*
+# before a fucntion pass it as a stringand __FILE__and __LINE__ are macros to get file loc and line of fucntion
+and since MACROS HAS TO BE IN SAME LINE we use \ before line ends to write macros in multiple lines
+*/
+
+
+static void GLCLearError() {
+    while (glGetError() != GL_NO_ERROR);    // glGetError get error and we get all the error until there are no arror left
+}
+
+static bool GlLogCall(const char* function, const char* file, int line) {
+    while (GLenum error = glGetError()) {
+        std::cout << "[OpenGl Error] (" << error << "): " << function << " " << file << ":" << line << std::endl;
+        return false;
+    }
+    return true;
+}
+
+
+struct ShaderProgramSource {
+    std::string VertexSource;
+    std::string FragmentSource;
+};
+
+static ShaderProgramSource ParseShader(const std::string& filepath);
+
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader);
+
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source);
+
+
+
+/* ------------- STATE CACHE ------------- */
+
+class GLStateCache {
+public:
+    static const unsigned int MaxTextureUnits = 16;
+
+    GLStateCache() { Invalidate(); }
+
+    /* forget everything, next call of every type will go to opengl */
+    void Invalidate() {
+        m_Program = Unknown;
+        m_Vao = Unknown;
+        for (unsigned int& b : m_Buffers)
+            b = Unknown;
+        m_ActiveUnit = Unknown;
+        for (unsigned int& t : m_Textures)
+            t = Unknown;
+    }
+
+    void UseProgram(unsigned int program) {
+        if (m_Program == program) { m_Elided++; return; }
+        GLCall(glUseProgram(program));
+        m_Program = program;
+        m_Issued++;
+    }
+
+    void BindVertexArray(unsigned int vao) {
+        if (m_Vao == vao) { m_Elided++; return; }
+        GLCall(glBindVertexArray(vao));
+        m_Vao = vao;
+        m_Buffers[BufferSlot(GL_ELEMENT_ARRAY_BUFFER)] = Unknown;   /* every vao has its own ibo binding */
+        m_Issued++;
+    }
+
+    void BindBuffer(GLenum target, unsigned int buffer) {
+        unsigned int& bound = m_Buffers[BufferSlot(target)];
+        if (bound == buffer) { m_Elided++; return; }
+        GLCall(glBindBuffer(target, buffer));
+        bound = buffer;
+        m_Issued++;
+    }
+
+    /* only GL_TEXTURE_2D is tracked, that is all the samples use */
+    void BindTexture(unsigned int unit, unsigned int texture) {
+        ASSERT(unit < MaxTextureUnits);
+        if (m_Textures[unit] == texture) { m_Elided++; return; }
+
+        if (m_ActiveUnit != unit) {
+            GLCall(glActiveTexture(GL_TEXTURE0 + unit));
+            m_ActiveUnit = unit;
+            m_Issued++;
+        }
+        GLCall(glBindTexture(GL_TEXTURE_2D, texture));
+        m_Textures[unit] = texture;
+        m_Issued++;
+    }
+
+    /* call when a buffer / vao / program is deleted, so a new object with same id is not skipped */
+    void OnDeleteBuffer(unsigned int buffer) {
+        for (unsigned int& b : m_Buffers)
+            if (b == buffer) b = Unknown;
+    }
+    void OnDeleteVertexArray(unsigned int vao) { if (m_Vao == vao) m_Vao = Unknown; }
+    void OnDeleteProgram(unsigned int program) { if (m_Program == program) m_Program = Unknown; }
+
+    unsigned long long GetIssued() const { return m_Issued; }
+    unsigned long long GetElided() const { return m_Elided; }
+    void ResetCounters() { m_Issued = 0; m_Elided = 0; }
+
+private:
+    static const unsigned int Unknown = 0xFFFFFFFF;     /* not a valid gl name, so first bind always goes through */
+
+    static unsigned int BufferSlot(GLenum target) {
+        switch (target) {
+            case GL_ARRAY_BUFFER:         return 0;
+            case GL_ELEMENT_ARRAY_BUFFER: return 1;
+            case GL_UNIFORM_BUFFER:       return 2;
+            case GL_COPY_READ_BUFFER:     return 3;
+            case GL_COPY_WRITE_BUFFER:    return 4;
+            case GL_PIXEL_UNPACK_BUFFER:  return 5;
+            case GL_DRAW_INDIRECT_BUFFER: return 6;
+        }
+        ASSERT(false);      /* add the target above */
+        return 0;
+    }
+
+    unsigned int m_Program;
+    unsigned int m_Vao;
+    unsigned int m_Buffers[7];
+    unsigned int m_ActiveUnit;
+    unsigned int m_Textures[MaxTextureUnits];
+
+    unsigned long long m_Issued = 0;
+    unsigned long long m_Elided = 0;
+};
+
+
+/* one thing to draw -> which vao (mesh) and its color */
+struct Object {
+    unsigned int vao;
+    unsigned int ibo;
+    unsigned int indexCount;
+    float r, g, b;
+};
+
+
+
+int main(void)
+{
+    /* GLFW BASIC STUFF */
+        GLFWwindow* window;
+
+        /* Initialize the GLFW library */
+        if (!glfwInit())
+            return -1;
+
+
+        /* setting version 3.3 and core profile (i.e mordern opengl) */
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+
+        /* Create a windowed mode window and its OpenGL context */
+        window = glfwCreateWindow(640, 480, "Hello World", NULL, NULL);
+        if (!window)
+        {
+            glfwTerminate();
+            return -1;
+
+        }
+        /* Make the window's context current */
+        glfwMakeContextCurrent(window);
+
+        glfwSwapInterval(1);    /* controls FPS or intervel between buffer(frames) */
+
+    /*  END BASIC GLFW   */
+
+
+    /* Intitialize GLEW */
+        if (glewInit() != GLEW_OK) {
+            std::cout << "Error!" << std::endl;
+        }
+    /* END */
+
+    std::cout << glGetString(GL_VERSION) << std::endl;  /* prints the version of opengl using */
+
+
+
+    /* ------------- Generating Data to be used to display in the window ------------- */
+
+        /* ------------- two meshes -> square (HW_10) and triangle (HW_2) ------------- */
+
+            float squarePositions[] = {
+                -0.5f, -0.5f,    // 0
+                 0.5f, -0.5f,    // 1
+                 0.5f,  0.5f,    // 2
+                -0.5f,  0.5f     // 3
+            };
+            unsigned int squareIndices[] = {
+                0, 1, 2,
+                2, 3, 0
+            };
+
+            float trianglePositions[] = {
+                -0.5f, -0.5f,
+                 0.0f,  0.5f,
+                 0.5f, -0.5f
+            };
+            unsigned int triangleIndices[] = { 0, 1, 2 };
+
+            float* meshPositions[] = { squarePositions, trianglePositions };
+            unsigned int meshVertexCount[] = { 4, 3 };
+            unsigned int* meshIndices[] = { squareIndices, triangleIndices };
+            unsigned int meshIndexCount[] = { 6, 3 };
+
+            unsigned int vaos[2], buffers[2], ibos[2];
+            for (int i = 0; i < 2; i++) {
+                GLCall(glGenVertexArrays(1, &vaos[i]));
+                GLCall(glBindVertexArray(vaos[i]));
+
+                GLCall(glGenBuffers(1, &buffers[i]));
+                GLCall(glBindBuffer(GL_ARRAY_BUFFER, buffers[i]));
+                GLCall(glBufferData(GL_ARRAY_BUFFER, meshVertexCount[i] * 2 * sizeof(float), meshPositions[i], GL_STATIC_DRAW));
+
+                GLCall(glEnableVertexAttribArray(0));
+                GLCall(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2, 0));
+
+                GLCall(glGenBuffers(1, &ibos[i]));
+                GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibos[i]));
+                GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, meshIndexCount[i] * sizeof(unsigned int), meshIndices[i], GL_STATIC_DRAW));
+            }
+
+
+        /* ------------- OBJECTS ------------- */
+
+            /* hundreds of objects but only 2 meshes and 1 program -> most binds are same as last one */
+            const unsigned int objectCount = 400;
+            std::vector<Object> objects;
+            for (unsigned int i = 0; i < objectCount; i++) {
+                int mesh = i < objectCount / 2 ? 0 : 1;
+                objects.push_back({ vaos[mesh], ibos[mesh], meshIndexCount[mesh], (float)i / objectCount, 0.2f, 0.5f });
+            }
+
+
+        /* ------------- SHADERS ------------- */
+
+            ShaderProgramSource shaderSource = ParseShader("res/shaders/Basic - UNFORMS.shader");
+            unsigned int shader = CreateShader(shaderSource.VertexSource, shaderSource.FragmentSource);
+
+            GLCall(int location = glGetUniformLocation(shader, "u_Color"));
+            ASSERT(location != -1);
+
+
+    /* ------------- END OF GENERATING DATA ------------- */
+
+
+    /* ----------- Unbound everything ----------- */
+
+            GLCall(glUseProgram(0));
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, 0));
+            GLCall(glBindVertexArray(0));
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
+
+
+    GLStateCache cache;     /* everything above was bound without cache, so cache starts as unknown */
+
+
+
+    /* ------------- BENCHMARK ------------- */
+
+        glfwSwapInterval(0);
+
+        const int benchFrames = 200;
+
+        /* binding everything every time like HW_10 */
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int frame = 0; frame < benchFrames; frame++) {
+            glClear(GL_COLOR_BUFFER_BIT);
+            for (const Object& o : objects) {
+                GLCall(glUseProgram(shader));
+                GLCall(glUniform4f(location, o.r, o.g, o.b, 1.0f));
+                GLCall(glBindVertexArray(o.vao));
+                GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, o.ibo));
+                GLCall(glDrawElements(GL_TRIANGLES, o.indexCount, GL_UNSIGNED_INT, nullptr));
+            }
+            glFinish();
+        }
+        double directMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count() / benchFrames;
+
+        /* same loop through the cache */
+        cache.Invalidate();
+        cache.ResetCounters();
+        start = std::chrono::high_resolution_clock::now();
+        for (int frame = 0; frame < benchFrames; frame++) {
+            glClear(GL_COLOR_BUFFER_BIT);
+            for (const Object& o : objects) {
+                cache.UseProgram(shader);
+                GLCall(glUniform4f(location, o.r, o.g, o.b, 1.0f));
+                cache.BindVertexArray(o.vao);
+                cache.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, o.ibo);
+                GLCall(glDrawElements(GL_TRIANGLES, o.indexCount, GL_UNSIGNED_INT, nullptr));
+            }
+            glFinish();
+        }
+        double cachedMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count() / benchFrames;
+
+        std::cout << "[Benchmark] " << objectCount << " objects, " << benchFrames << " frames" << std::endl;
+        std::cout << "  direct binds : " << directMs << " ms/frame (" << objectCount * 3 << " bind calls per frame)" << std::endl;
+        std::cout << "  state cache  : " << cachedMs << " ms/frame ("
+                  << cache.GetIssued() / benchFrames << " issued, " << cache.GetElided() / benchFrames << " elided per frame)" << std::endl;
+
+        glfwSwapInterval(1);
+
+    /* ------------- END BENCHMARK ------------- */
+
+
+
+    /* ----------- Animation Variable ----------- */
+    float r = 0.0f;
+    float increment = 0.05f;
+    unsigned int frame = 0;
+
+    cache.ResetCounters();
+
+
+
+    /* WHILE Loop to keep the window active till window is closed */
+    while (!glfwWindowShouldClose(window))
+    {
+        /* Render here */
+
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        /* ------------- Bind Back everything (cache skips what is already bound) ------------- */
+        for (const Object& o : objects) {
+            cache.UseProgram(shader);
+            GLCall(glUniform4f(location, r * o.r, o.g, o.b, 1.0f));
+            cache.BindVertexArray(o.vao);
+            cache.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, o.ibo);
+            GLCall(glDrawElements(GL_TRIANGLES, o.indexCount, GL_UNSIGNED_INT, nullptr));
+        }
+
+        if (r > 1.0f)
+            increment = -0.05f;
+        else if (r < 0.0f)
+            increment = 0.05f;
+
+        r += increment;
+
+        if (++frame % 300 == 0)
+            std::cout << "[StateCache] issued " << cache.GetIssued() << "  elided " << cache.GetElided() << std::endl;
+
+
+        /* Swap front and back buffers */
+        glfwSwapBuffers(window);
+
+        /* Poll for and process events */
+        glfwPollEvents();
+    }
+
+    glDeleteBuffers(2, buffers);
+    glDeleteBuffers(2, ibos);
+    glDeleteVertexArrays(2, vaos);
+    glDeleteProgram(shader);
+
+    glfwTerminate();
+    return 0;
+}
+
+
+
+
+/* Makes and compile the shader by inputing the type and Source code */
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source) {
+
+    unsigned int id = glCreateShader(shaderType);   /* generate Shader and return id */
+    const char* src = source.c_str();               /* convert inputed string to char* */
+    GLCall(glShaderSource(id, 1, &src, nullptr));           /* attaching source code to the shader */
+    GLCall(glCompileShader(id));                            /* compile shader */
+
+    /* -------- ERROR HANDLING -------- */
+        int result;
+        GLCall(glGetShaderiv(id, GL_COMPILE_STATUS, &result));
+        if (result == GL_FALSE) {
+            int length;
+            GLCall(glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length));
+            char* message = (char*) _malloca(length * sizeof(char));      /* just means char Array of length 'length'  or    char message[length] */
+            GLCall(glGetShaderInfoLog(id, length, &length, message));
+
+            std::cout << "Failed To Compile " << (shaderType == GL_VERTEX_SHADER ? "vertex" : "fragment") << " shader" << std::endl;
+
+            std::cout << message << std::endl;
+            GLCall(glDeleteShader(id));
+            return 0;
+        }
+
+    /* -------- END ERROR HANDLING -------- */
+
+    return id;
+
+}
+
+
+/* Creates a program Which contain vertex and fragment shader */
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader) {
+
+    GLCall(unsigned int program = glCreateProgram());                           /* generate program to store all shader and program to be run by GPU during while loop */
+    unsigned int vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
+    unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+
+    GLCall(glAttachShader(program, vs));                                        /* Attach shader to program to be run by GPU */
+    GLCall(glAttachShader(program, fs));
+    GLCall(glLinkProgram(program));
+    GLCall(glValidateProgram(program));
+    GLCall(glDeleteShader(vs));                                                 /* DELETING shader to save space as shader is already attached to program */
+    GLCall(glDeleteShader(fs));
+
+    return program;
+
+}
+
+
+/* Read file and output vertex and fragment shader source code */
+static ShaderProgramSource ParseShader(const std::string& filepath) {
+
+    std::ifstream stream(filepath);
+
+    enum class ShaderType {
+        NONE = -1, VERTEX = 0, FRAGMENT = 1
+    };
+
+    std::string line;
+    std::stringstream ss[2];
+    ShaderType type = ShaderType::NONE;
+    while (getline(stream, line)) {
+
+        if (line.find("#shader") != std::string::npos) {
+
+            if (line.find("vertex") != std::string::npos)
+                type = ShaderType::VERTEX;
+            else if (line.find("fragment") != std::string::npos)
+                type = ShaderType::FRAGMENT;
+
+        }
+        else {
+            ss[int(type)] << line << '\n';
+        }
+    }
+
+    return { ss[0].str(), ss[1].str() };
+}
@@ -0,0 +1,503 @@
+/*
+
+Render Queue (sorting draws)
+
+till now draws are done in main() in the order code is written, so if objects are mixed (square, triangle, square ...)
+program and vao are changed again and again
+
+here objects do not draw directly, they put a draw packet (program, vao, index count, color uniform) in a queue
+every packet has a 64 bit key, and the queue sorts packets by key before drawing
+
+    bits  63..52  -> program   (12 bits)
+    bits  51..36  -> material  (16 bits)  -> here material is just the u_Color value
+    bits  35..24  -> vao       (12 bits)
+    bits  23..0   -> depth     (24 bits)  -> front to back
+
+so after sorting all draws with same program are together, inside that same material, then same vao, then by depth
+sorting is radix sort (8 bits at a time) which is O(n) and faster than std::sort for plain integer keys
+
+state changes before and after sorting are counted and printed
+
+*/
+
+
+
+
+#include <GL\glew.h>
+
+#include <GLFW/glfw3.h>
+
+
+#include <iostream>
+#include <fstream>  // to read file
+#include <string>   // To use getline func
+#include <sstream>
+#include <vector>
+#include <chrono>   // to measure sort time
+#include <cstdint>  // uint64_t
+#include <cstring>  // memcmp, memcpy
+#include <random>   // to mix the objects
+#include <math.h>
+
+
+/* ------------ MACRO ------------ */
+#define ASSERT(x) if (!(x)) __debugbreak(); // MSVC (microsoft compiler) specific command to stop executing the program
+
+#define GLCall(x) GLCLearError();\
+    x;\
+    ASSERT(GlLogCall(#x, __FILE__, __LINE__))
+
+/*
+# before a fucntion pass it as a stringand __FILE__and __LINE__ are macros to get file loc and line of fucntion
+and since MACROS HAS TO BE IN SAME LINE we use \ before line ends to write macros in multiple lines
+*/
+
+
+static void GLCLearError() {
+    while (glGetError() != GL_NO_ERROR);    // glGetError get error and we get all the error until there are no arror left
+}
+
+static bool GlLogCall(const char* function, const char* file, int line) {
+    while (GLenum error = glGetError()) {
+        std::cout << "[OpenGl Error] (" << error << "): " << function << " " << file << ":" << line << std::endl;
+        return false;
+    }
+    return true;
+}
+
+
+struct ShaderProgramSource {
+    std::string VertexSource;
+    std::string FragmentSource;
+};
+
+static ShaderProgramSource ParseShader(const std::string& filepath);
+
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader);
+
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source);
+
+
+
+/* ------------- RENDER QUEUE ------------- */
+
+/* everything needed for one glDrawElements */
+struct DrawPacket {
+    unsigned int program;
+    int colorLocation;          /* -1 if program has no u_Color */
+    unsigned int vao;
+    unsigned int indexCount;
+    float color[4];             /* uniforms of this draw */
+};
+
+/* ids are small numbers given by the app (not gl names) so they fit in the bits of the key */
+static uint64_t MakeSortKey(unsigned int programId, unsigned int materialId, unsigned int vaoId, float depth) {
+
+    ASSERT(programId < (1u << 12) && materialId < (1u << 16) && vaoId < (1u << 12));
+
+    /* depth 0..1 -> 24 bit integer, values outside are clamped */
+    float d = depth < 0.0f ? 0.0f : (depth > 1.0f ? 1.0f : depth);
+    uint64_t depthBits = (uint64_t)(d * ((1 << 24) - 1));
+
+    return ((uint64_t)programId << 52) | ((uint64_t)materialId << 36) | ((uint64_t)vaoId << 24) | depthBits;
+}
+
+class RenderQueue {
+public:
+    struct Stats {
+        unsigned int draws = 0;
+        unsigned int programChanges = 0;
+        unsigned int materialChanges = 0;     /* uniform uploads */
+        unsigned int vaoChanges = 0;
+    };
+
+    void Clear() {
+        m_Packets.clear();
+        m_Items.clear();
+    }
+
+    void Submit(uint64_t key, const DrawPacket& packet) {
+        m_Items.push_back({ key, (unsigned int)m_Packets.size() });
+        m_Packets.push_back(packet);
+    }
+
+    /* LSD radix sort on the key, 8 bits per pass, passes where all keys have same byte are skipped */
+    void Sort() {
+        size_t n = m_Items.size();
+        m_Temp.resize(n);
+
+        for (int shift = 0; shift < 64; shift += 8) {
+            unsigned int count[256] = {};
+            for (size_t i = 0; i < n; i++)
+                count[(m_Items[i].key >> shift) & 0xFF]++;
+
+            if (n == 0 || count[(m_Items[0].key >> shift) & 0xFF] == n)
+                continue;   /* every key same in this byte -> nothing to do */
+
+            unsigned int offset = 0;
+            for (unsigned int& c : count) {
+                unsigned int t = c;
+                c = offset;
+                offset += t;
+            }
+            for (size_t i = 0; i < n; i++)
+                m_Temp[count[(m_Items[i].key >> shift) & 0xFF]++] = m_Items[i];
+
+            m_Items.swap(m_Temp);
+        }
+    }
+
+    /* counts what would change if the queue is drawn in current order (no gl calls) */
+    Stats CountStateChanges() const {
+        return Walk(false);
+    }
+
+    /* draws everything in current order, only changes state if it is different from last draw */
+    Stats Execute() const {
+        return Walk(true);
+    }
+
+    size_t Size() const { return m_Items.size(); }
+
+private:
+    struct SortItem {
+        uint64_t key;
+        unsigned int packet;    /* index in m_Packets, so only 16 bytes are moved while sorting */
+    };
+
+    Stats Walk(bool draw) const {
+        Stats stats;
+        unsigned int program = 0, vao = 0;
+        const float* color = nullptr;
+
+        for (const SortItem& item : m_Items) {
+            const DrawPacket& p = m_Packets[item.packet];
+
+            if (p.program != program) {
+                if (draw) { GLCall(glUseProgram(p.program)); }
+                program = p.program;
+                color = nullptr;            /* uniforms belong to program, so set again */
+                stats.programChanges++;
+            }
+            if (p.colorLocation != -1 && (!color || memcmp(color, p.color, sizeof(p.color)) != 0)) {
+                if (draw) { GLCall(glUniform4f(p.colorLocation, p.color[0], p.color[1], p.color[2], p.color[3])); }
+                color = p.color;
+                stats.materialChanges++;
+            }
+            if (p.vao != vao) {
+                if (draw) { GLCall(glBindVertexArray(p.vao)); }
+                vao = p.vao;
+                stats.vaoChanges++;
+            }
+            if (draw) { GLCall(glDrawElements(GL_TRIANGLES, p.indexCount, GL_UNSIGNED_INT, nullptr)); }
+            stats.draws++;
+        }
+        return stats;
+    }
+
+    std::vector<DrawPacket> m_Packets;
+    std::vector<SortItem> m_Items;
+    std::vector<SortItem> m_Temp;       /* kept so sort does not allocate every frame */
+};
+
+
+static void PrintStats(const char* name, const RenderQueue::Stats& s) {
+    std::cout << "  " << name << " : " << s.draws << " draws, " << s.programChanges << " program changes, "
+              << s.materialChanges << " uniform changes, " << s.vaoChanges << " vao changes" << std::endl;
+}
+
+
+/* one object of the scene */
+struct SceneObject {
+    unsigned int programId, materialId, meshId;
+    float depth;
+};
+
+
+
+int main(void)
+{
+    /* GLFW BASIC STUFF */
+        GLFWwindow* window;
+
+        /* Initialize the GLFW library */
+        if (!glfwInit())
+            return -1;
+
+
+        /* setting version 3.3 and core profile (i.e mordern opengl) */
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+
+        /* Create a windowed mode window and its OpenGL context */
+        window = glfwCreateWindow(640, 480, "Hello World", NULL, NULL);
+        if (!window)
+        {
+            glfwTerminate();
+            return -1;
+
+        }
+        /* Make the window's context current */
+        glfwMakeContextCurrent(window);
+
+        glfwSwapInterval(1);    /* controls FPS or intervel between buffer(frames) */
+
+    /*  END BASIC GLFW   */
+
+
+    /* Intitialize GLEW */
+        if (glewInit() != GLEW_OK) {
+            std::cout << "Error!" << std::endl;
+        }
+    /* END */
+
+    std::cout << glGetString(GL_VERSION) << std::endl;  /* prints the version of opengl using */
+
+
+
+    /* ------------- Generating Data to be used to display in the window ------------- */
+
+        /* ------------- two meshes -> square (HW_10) and triangle (HW_2) ------------- */
+
+            float squarePositions[] = {
+                -0.5f, -0.5f,    // 0
+                 0.5f, -0.5f,    // 1
+                 0.5f,  0.5f,    // 2
+                -0.5f,  0.5f     // 3
+            };
+            unsigned int squareIndices[] = {
+                0, 1, 2,
+                2, 3, 0
+            };
+
+            float trianglePositions[] = {
+                -0.5f, -0.5f,
+                 0.0f,  0.5f,
+                 0.5f, -0.5f
+            };
+            unsigned int triangleIndices[] = { 0, 1, 2 };
+
+            float* meshPositions[] = { squarePositions, trianglePositions };
+            unsigned int meshVertexCount[] = { 4, 3 };
+            unsigned int* meshIndices[] = { squareIndices, triangleIndices };
+            unsigned int meshIndexCount[] = { 6, 3 };
+
+            unsigned int vaos[2], buffers[2], ibos[2];
+            for (int i = 0; i < 2; i++) {
+                GLCall(glGenVertexArrays(1, &vaos[i]));
+                GLCall(glBindVertexArray(vaos[i]));
+
+                GLCall(glGenBuffers(1, &buffers[i]));
+                GLCall(glBindBuffer(GL_ARRAY_BUFFER, buffers[i]));
+                GLCall(glBufferData(GL_ARRAY_BUFFER, meshVertexCount[i] * 2 * sizeof(float), meshPositions[i], GL_STATIC_DRAW));
+
+                GLCall(glEnableVertexAttribArray(0));
+                GLCall(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2, 0));
+
+                GLCall(glGenBuffers(1, &ibos[i]));
+                GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibos[i]));
+                GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, meshIndexCount[i] * sizeof(unsigned int), meshIndices[i], GL_STATIC_DRAW));
+            }
+
+
+        /* ------------- SHADERS -> Basic (fixed color, HW_9) and UNFORMS (u_Color, HW_10) ------------- */
+
+            ShaderProgramSource basicSource = ParseShader("res/shaders/Basic.shader");
+            ShaderProgramSource uniformSource = ParseShader("res/shaders/Basic - UNFORMS.shader");
+
+            unsigned int programs[2];
+            programs[0] = CreateShader(basicSource.VertexSource, basicSource.FragmentSource);
+            programs[1] = CreateShader(uniformSource.VertexSource, uniformSource.FragmentSource);
+
+            int colorLocations[2];
+            GLCall(colorLocations[0] = glGetUniformLocation(programs[0], "u_Color"));   /* -1, Basic.shader has no uniform */
+            GLCall(colorLocations[1] = glGetUniformLocation(programs[1], "u_Color"));
+            ASSERT(colorLocations[1] != -1);
+
+
+        /* ------------- MATERIALS (colors) ------------- */
+
+            const unsigned int materialCount = 8;
+            float materials[materialCount][4];
+            for (unsigned int i = 0; i < materialCount; i++) {
+                materials[i][0] = (float)i / materialCount;
+                materials[i][1] = 0.2f;
+                materials[i][2] = 0.5f;
+                materials[i][3] = 1.0f;
+            }
+
+
+        /* ------------- SCENE (objects in random order) ------------- */
+
+            const unsigned int objectCount = 2000;
+            std::vector<SceneObject> scene(objectCount);
+            std::mt19937 rng(1234);
+            for (SceneObject& o : scene) {
+                o.programId = rng() % 2;
+                o.materialId = o.programId == 1 ? rng() % materialCount : 0;   /* Basic.shader has no material */
+                o.meshId = rng() % 2;
+                o.depth = (rng() % 1000) / 1000.0f;
+            }
+
+
+    /* ------------- END OF GENERATING DATA ------------- */
+
+
+    /* ----------- Unbound everything ----------- */
+
+            GLCall(glUseProgram(0));
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, 0));
+            GLCall(glBindVertexArray(0));
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
+
+
+
+    RenderQueue queue;
+
+    /* puts every object of the scene in the queue */
+    auto submitScene = [&]() {
+        queue.Clear();
+        for (const SceneObject& o : scene) {
+            DrawPacket p;
+            p.program = programs[o.programId];
+            p.colorLocation = colorLocations[o.programId];
+            p.vao = vaos[o.meshId];
+            p.indexCount = meshIndexCount[o.meshId];
+            memcpy(p.color, materials[o.materialId], sizeof(p.color));
+
+            queue.Submit(MakeSortKey(o.programId, o.materialId, o.meshId, o.depth), p);
+        }
+    };
+
+
+    /* ------------- STATE CHANGES BEFORE / AFTER SORT ------------- */
+
+        submitScene();
+        RenderQueue::Stats unsorted = queue.CountStateChanges();
+
+        auto start = std::chrono::high_resolution_clock::now();
+        queue.Sort();
+        double sortMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+        RenderQueue::Stats sorted = queue.CountStateChanges();
+
+        std::cout << "[RenderQueue] " << objectCount << " objects, sort took " << sortMs << " ms" << std::endl;
+        PrintStats("unsorted", unsorted);
+        PrintStats("sorted  ", sorted);
+
+
+
+    /* WHILE Loop to keep the window active till window is closed */
+    while (!glfwWindowShouldClose(window))
+    {
+        /* Render here */
+
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        /* objects submit in any order, queue sorts and draws */
+        submitScene();
+        queue.Sort();
+        queue.Execute();
+
+
+        /* Swap front and back buffers */
+        glfwSwapBuffers(window);
+
+        /* Poll for and process events */
+        glfwPollEvents();
+    }
+
+    glDeleteBuffers(2, buffers);
+    glDeleteBuffers(2, ibos);
+    glDeleteVertexArrays(2, vaos);
+    glDeleteProgram(programs[0]);
+    glDeleteProgram(programs[1]);
+
+    glfwTerminate();
+    return 0;
+}
+
+
+
+
+/* Makes and compile the shader by inputing the type and Source code */
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source) {
+
+    unsigned int id = glCreateShader(shaderType);   /* generate Shader and return id */
+    const char* src = source.c_str();               /* convert inputed string to char* */
+    GLCall(glShaderSource(id, 1, &src, nullptr));           /* attaching source code to the shader */
+    GLCall(glCompileShader(id));                            /* compile shader */
+
+    /* -------- ERROR HANDLING -------- */
+        int result;
+        GLCall(glGetShaderiv(id, GL_COMPILE_STATUS, &result));
+        if (result == GL_FALSE) {
+            int length;
+            GLCall(glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length));
+            char* message = (char*) _malloca(length * sizeof(char));      /* just means char Array of length 'length'  or    char message[length] */
+            GLCall(glGetShaderInfoLog(id, length, &length, message));
+
+            std::cout << "Failed To Compile " << (shaderType == GL_VERTEX_SHADER ? "vertex" : "fragment") << " shader" << std::endl;
+
+            std::cout << message << std::endl;
+            GLCall(glDeleteShader(id));
+            return 0;
+        }
+
+    /* -------- END ERROR HANDLING -------- */
+
+    return id;
+
+}
+
+
+/* Creates a program Which contain vertex and fragment shader */
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader) {
+
+    GLCall(unsigned int program = glCreateProgram());                           /* generate program to store all shader and program to be run by GPU during while loop */
+    unsigned int vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
+    unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+
+    GLCall(glAttachShader(program, vs));                                        /* Attach shader to program to be run by GPU */
+    GLCall(glAttachShader(program, fs));
+    GLCall(glLinkProgram(program));
+    GLCall(glValidateProgram(program));
+    GLCall(glDeleteShader(vs));                                                 /* DELETING shader to save space as shader is already attached to program */
+    GLCall(glDeleteShader(fs));
+
+    return program;
+
+}
+
+
+/* Read file and output vertex and fragment shader source code */
+static ShaderProgramSource ParseShader(const std::string& filepath) {
+
+    std::ifstream stream(filepath);
+
+    enum class ShaderType {
+        NONE = -1, VERTEX = 0, FRAGMENT = 1
+    };
+
+    std::string line;
+    std::stringstream ss[2];
+    ShaderType type = ShaderType::NONE;
+    while (getline(stream, line)) {
+
+        if (line.find("#shader") != std::string::npos) {
+
+            if (line.find("vertex") != std::string::npos)
+                type = ShaderType::VERTEX;
+            else if (line.find("fragment") != std::string::npos)
+                type = ShaderType::FRAGMENT;
+
+        }
+        else {
+            ss[int(type)] << line << '\n';
+        }
+    }
+
+    return { ss[0].str(), ss[1].str() };
+}
@@ -0,0 +1,631 @@
+/*
+
+Command Buffers (multithreaded recording, one GL thread)
+
+all GL work till now is done on main thread between glfwPollEvents and glfwSwapBuffers
+an opengl context can be current on only one thread, so we can not just call gl from many threads
+
+instead worker threads do not call gl at all, they record commands (bind program, bind vao, uniform, draw)
+in their own CommandBuffer which is just a linear array of bytes (no locks needed, every thread has its own)
+one render thread owns the context and replays all buffers in order (buffer 0, then 1, then 2 ...) and swaps
+
+replay goes through CommandBackend, so buffers do not know about opengl
+GLBackend calls gl, ValidationBackend is used by the stress test to check the order of commands
+
+main thread  -> poll events, workers record frame N+1
+render thread -> replays frame N and swaps
+
+at start a stress test records 100k commands from 8 threads and checks replay order
+
+*/
+
+
+
+
+#include <GL\glew.h>
+
+#include <GLFW/glfw3.h>
+
+
+#include <iostream>
+#include <fstream>  // to read file
+#include <string>   // To use getline func
+#include <sstream>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <cstring>  // memcpy
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <math.h>
+
+
+/* ------------ MACRO ------------ */
+#define ASSERT(x) if (!(x)) __debugbreak(); // MSVC (microsoft compiler) specific command to stop executing the program
+
+#define GLCall(x) GLCLearError();\
+    x;\
+    ASSERT(GlLogCall(#x, __FILE__, __LINE__))
+
+/*
+# before a fucntion pass it as a stringand __FILE__and __LINE__ are macros to get file loc and line of fucntion
+and since MACROS HAS TO BE IN SAME LINE we use \ before line ends to write macros in multiple lines
+*/
+
+
+static void GLCLearError() {
+    while (glGetError() != GL_NO_ERROR);    // glGetError get error and we get all the error until there are no arror left
+}
+
+static bool GlLogCall(const char* function, const char* file, int line) {
+    while (GLenum error = glGetError()) {
+        std::cout << "[OpenGl Error] (" << error << "): " << function << " " << file << ":" << line << std::endl;
+        return false;
+    }
+    return true;
+}
+
+
+struct ShaderProgramSource {
+    std::string VertexSource;
+    std::string FragmentSource;
+};
+
+static ShaderProgramSource ParseShader(const std::string& filepath);
+
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader);
+
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source);
+
+
+
+/* ------------- COMMANDS ------------- */
+
+enum class CommandType : uint32_t {
+    BindProgram, BindVertexArray, Uniform4f, DrawElements
+};
+
+struct CmdBindProgram     { static const CommandType Type = CommandType::BindProgram;     unsigned int program; };
+struct CmdBindVertexArray { static const CommandType Type = CommandType::BindVertexArray; unsigned int vao; };
+struct CmdUniform4f       { static const CommandType Type = CommandType::Uniform4f;       int location; float v[4]; };
+struct CmdDrawElements    { static const CommandType Type = CommandType::DrawElements;    unsigned int count; unsigned int firstIndex; };
+
+
+/* what a command buffer is replayed into -> does not have to be opengl */
+class CommandBackend {
+public:
+    virtual ~CommandBackend() {}
+    virtual void BindProgram(const CmdBindProgram& cmd) = 0;
+    virtual void BindVertexArray(const CmdBindVertexArray& cmd) = 0;
+    virtual void Uniform4f(const CmdUniform4f& cmd) = 0;
+    virtual void DrawElements(const CmdDrawElements& cmd) = 0;
+};
+
+
+/* ------------- COMMAND BUFFER ------------- */
+
+/* linear array of [header][command][header][command]... , only one thread writes to it */
+class CommandBuffer {
+public:
+    template<typename T>
+    void Push(const T& cmd) {
+        Header header = { T::Type, (uint32_t)sizeof(T) };
+        size_t at = m_Data.size();
+        m_Data.resize(at + sizeof(Header) + sizeof(T));
+        memcpy(&m_Data[at], &header, sizeof(Header));
+        memcpy(&m_Data[at + sizeof(Header)], &cmd, sizeof(T));
+        m_Count++;
+    }
+
+    void Clear() {
+        m_Data.clear();     /* keeps memory, so next frame does not allocate */
+        m_Count = 0;
+    }
+
+    void Replay(CommandBackend& backend) const {
+        size_t at = 0;
+        while (at < m_Data.size()) {
+            Header header;
+            memcpy(&header, &m_Data[at], sizeof(Header));
+            const unsigned char* payload = &m_Data[at + sizeof(Header)];
+
+            switch (header.type) {
+                case CommandType::BindProgram:     backend.BindProgram(Read<CmdBindProgram>(payload));         break;
+                case CommandType::BindVertexArray: backend.BindVertexArray(Read<CmdBindVertexArray>(payload)); break;
+                case CommandType::Uniform4f:       backend.Uniform4f(Read<CmdUniform4f>(payload));             break;
+                case CommandType::DrawElements:    backend.DrawElements(Read<CmdDrawElements>(payload));       break;
+            }
+            at += sizeof(Header) + header.size;
+        }
+    }
+
+    size_t GetCount() const { return m_Count; }
+    size_t GetBytes() const { return m_Data.size(); }
+
+private:
+    struct Header {
+        CommandType type;
+        uint32_t size;      /* bytes of command after header */
+    };
+
+    template<typename T>
+    static T Read(const unsigned char* data) {
+        T cmd;
+        memcpy(&cmd, data, sizeof(T));      /* memcpy because data is not aligned for T */
+        return cmd;
+    }
+
+    std::vector<unsigned char> m_Data;
+    size_t m_Count = 0;
+};
+
+
+/* ------------- BACKENDS ------------- */
+
+/* the real one, only used on the render thread */
+class GLBackend : public CommandBackend {
+public:
+    void BindProgram(const CmdBindProgram& cmd) override         { GLCall(glUseProgram(cmd.program)); }
+    void BindVertexArray(const CmdBindVertexArray& cmd) override { GLCall(glBindVertexArray(cmd.vao)); }
+    void Uniform4f(const CmdUniform4f& cmd) override             { GLCall(glUniform4f(cmd.location, cmd.v[0], cmd.v[1], cmd.v[2], cmd.v[3])); }
+    void DrawElements(const CmdDrawElements& cmd) override {
+        GLCall(glDrawElements(GL_TRIANGLES, cmd.count, GL_UNSIGNED_INT, (const void*)(cmd.firstIndex * sizeof(unsigned int))));
+    }
+};
+
+/* for the stress test -> every thread recorded program = thread id, then uniform / draw with location / count = sequence number */
+class ValidationBackend : public CommandBackend {
+public:
+    void BindProgram(const CmdBindProgram& cmd) override {
+        if (cmd.program != m_Thread) {      /* new buffer has started, must be next thread and previous must be complete */
+            if (cmd.program != m_Thread + 1 || (m_Thread != 0 && m_Seq != m_PerThread))
+                m_Ok = false;
+            m_Thread = cmd.program;
+            m_Seq = 0;
+        }
+    }
+    void BindVertexArray(const CmdBindVertexArray&) override {}
+    void Uniform4f(const CmdUniform4f& cmd) override {
+        if (cmd.location != (int)m_Seq)
+            m_Ok = false;
+        m_Seq++;
+        m_Replayed++;
+    }
+    void DrawElements(const CmdDrawElements& cmd) override {
+        if (cmd.count != m_Seq)
+            m_Ok = false;
+        m_Seq++;
+        m_Replayed++;
+    }
+
+    ValidationBackend(unsigned int perThread) : m_PerThread(perThread) {}
+
+    bool IsOk(unsigned int threads) const { return m_Ok && m_Thread == threads && m_Seq == m_PerThread; }
+    unsigned int GetReplayed() const { return m_Replayed; }
+
+private:
+    unsigned int m_PerThread;
+    unsigned int m_Thread = 0;          /* threads are numbered from 1 */
+    unsigned int m_Seq = 0;
+    unsigned int m_Replayed = 0;
+    bool m_Ok = true;
+};
+
+
+/* ------------- WORKER POOL ------------- */
+
+/* threads stay alive and wait, Run(job) calls job(0..count-1) on all of them and returns when all are done */
+class WorkerPool {
+public:
+    WorkerPool(unsigned int count) {
+        for (unsigned int i = 0; i < count; i++)
+            m_Threads.emplace_back([this, i]() { WorkerLoop(i); });
+    }
+
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Quit = true;
+        }
+        m_Start.notify_all();
+        for (std::thread& t : m_Threads)
+            t.join();
+    }
+
+    void Run(const std::function<void(unsigned int)>& job) {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Job = job;
+        m_Pending = (unsigned int)m_Threads.size();
+        m_Generation++;
+        m_Start.notify_all();
+        m_Done.wait(lock, [this]() { return m_Pending == 0; });
+    }
+
+    unsigned int GetCount() const { return (unsigned int)m_Threads.size(); }
+
+private:
+    void WorkerLoop(unsigned int index) {
+        unsigned long long seen = 0;
+        while (true) {
+            std::function<void(unsigned int)> job;
+            {
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                m_Start.wait(lock, [&]() { return m_Quit || m_Generation != seen; });
+                if (m_Quit)
+                    return;
+                seen = m_Generation;
+                job = m_Job;
+            }
+
+            job(index);
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (--m_Pending == 0)
+                m_Done.notify_one();
+        }
+    }
+
+    std::vector<std::thread> m_Threads;
+    std::mutex m_Mutex;
+    std::condition_variable m_Start, m_Done;
+    std::function<void(unsigned int)> m_Job;
+    unsigned long long m_Generation = 0;
+    unsigned int m_Pending = 0;
+    bool m_Quit = false;
+};
+
+
+/* ------------- RENDER THREAD ------------- */
+
+/* everything recorded for one frame, one buffer per worker */
+struct Frame {
+    std::vector<CommandBuffer> buffers;
+    bool inFlight = false;      /* true while render thread is using it */
+};
+
+class RenderThread {
+public:
+    RenderThread(GLFWwindow* window) : m_Window(window) {
+        m_Thread = std::thread([this]() { Loop(); });
+    }
+
+    ~RenderThread() {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Quit = true;
+        }
+        m_Wake.notify_all();
+        m_Thread.join();
+    }
+
+    /* gives frame to render thread, it is replayed in order and then swapped */
+    void Submit(Frame* frame) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        frame->inFlight = true;
+        m_Queue.push_back(frame);
+        m_Wake.notify_all();
+    }
+
+    /* blocks till render thread is done with this frame, so workers can record in it again */
+    void WaitIdle(Frame* frame) {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Wake.wait(lock, [frame]() { return !frame->inFlight; });
+    }
+
+private:
+    void Loop() {
+        glfwMakeContextCurrent(m_Window);   /* from now on only this thread calls gl */
+        GLBackend backend;
+
+        while (true) {
+            Frame* frame;
+            {
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                m_Wake.wait(lock, [this]() { return m_Quit || !m_Queue.empty(); });
+                if (m_Queue.empty())
+                    break;      /* quit only after all submitted frames are drawn */
+                frame = m_Queue.front();
+                m_Queue.erase(m_Queue.begin());
+            }
+
+            glClear(GL_COLOR_BUFFER_BIT);
+            for (const CommandBuffer& buffer : frame->buffers)
+                buffer.Replay(backend);
+            glfwSwapBuffers(m_Window);
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            frame->inFlight = false;
+            m_Wake.notify_all();
+        }
+
+        glfwMakeContextCurrent(nullptr);
+    }
+
+    GLFWwindow* m_Window;
+    std::thread m_Thread;
+    std::mutex m_Mutex;
+    std::condition_variable m_Wake;
+    std::vector<Frame*> m_Queue;
+    bool m_Quit = false;
+};
+
+
+/* ------------- STRESS TEST ------------- */
+
+static bool CommandBufferStressTest(WorkerPool& pool, unsigned int totalCommands) {
+
+    unsigned int threads = pool.GetCount();
+    unsigned int perThread = totalCommands / threads;
+    std::vector<CommandBuffer> buffers(threads);
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    /* every thread writes (thread id, 0..perThread-1) so order can be checked after replay */
+    pool.Run([&](unsigned int t) {
+        CommandBuffer& cb = buffers[t];
+        cb.Push(CmdBindProgram{ t + 1 });
+        for (unsigned int seq = 0; seq < perThread; seq++) {
+            if (seq % 2 == 0)
+                cb.Push(CmdUniform4f{ (int)seq, { 0.0f, 0.0f, 0.0f, 1.0f } });
+            else
+                cb.Push(CmdDrawElements{ seq, 0 });
+        }
+    });
+
+    double recordMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+    ValidationBackend validator(perThread);
+    for (const CommandBuffer& cb : buffers)
+        cb.Replay(validator);
+
+    bool ok = validator.IsOk(threads) && validator.GetReplayed() == perThread * threads;
+    std::cout << "[StressTest] " << threads << " threads x " << perThread << " commands recorded in " << recordMs << " ms, replay order "
+              << (ok ? "OK" : "FAILED") << std::endl;
+    return ok;
+}
+
+
+
+int main(void)
+{
+    /* GLFW BASIC STUFF */
+        GLFWwindow* window;
+
+        /* Initialize the GLFW library */
+        if (!glfwInit())
+            return -1;
+
+
+        /* setting version 3.3 and core profile (i.e mordern opengl) */
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+
+        /* Create a windowed mode window and its OpenGL context */
+        window = glfwCreateWindow(640, 480, "Hello World", NULL, NULL);
+        if (!window)
+        {
+            glfwTerminate();
+            return -1;
+
+        }
+        /* Make the window's context current */
+        glfwMakeContextCurrent(window);
+
+        glfwSwapInterval(1);    /* controls FPS or intervel between buffer(frames) */
+
+    /*  END BASIC GLFW   */
+
+
+    /* Intitialize GLEW */
+        if (glewInit() != GLEW_OK) {
+            std::cout << "Error!" << std::endl;
+        }
+    /* END */
+
+    std::cout << glGetString(GL_VERSION) << std::endl;  /* prints the version of opengl using */
+
+
+
+    /* ------------- Generating Data to be used to display in the window ------------- */
+
+            // 4 positions of vertices of sqaure
+            float positions[] = {
+                -0.5f, -0.5f,    // 0
+                 0.5f, -0.5f,    // 1
+                 0.5f,  0.5f,    // 2
+                -0.5f,  0.5f     // 3
+            };
+
+            unsigned int indices[] = {
+                0, 1, 2,
+                2, 3, 0
+            };
+
+            unsigned int vao;
+            GLCall(glGenVertexArrays(1, &vao));
+            GLCall(glBindVertexArray(vao));
+
+            unsigned int buffer;
+            GLCall(glGenBuffers(1, &buffer));
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, buffer));
+            GLCall(glBufferData(GL_ARRAY_BUFFER, 4 * 2 * sizeof(float), positions, GL_STATIC_DRAW));
+
+            GLCall(glEnableVertexAttribArray(0));
+            GLCall(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2, 0));
+
+            unsigned int ibo;
+            GLCall(glGenBuffers(1, &ibo));
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo));
+            GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, 6 * sizeof(unsigned int), indices, GL_STATIC_DRAW));
+
+            ShaderProgramSource shaderSource = ParseShader("res/shaders/Basic - UNFORMS.shader");
+            unsigned int shader = CreateShader(shaderSource.VertexSource, shaderSource.FragmentSource);
+
+            GLCall(int location = glGetUniformLocation(shader, "u_Color"));
+            ASSERT(location != -1);
+
+            GLCall(glBindVertexArray(0));
+
+    /* ------------- END OF GENERATING DATA ------------- */
+
+
+    WorkerPool workers(8);
+
+    CommandBufferStressTest(workers, 100000);
+
+
+    /* main thread gives the context to the render thread */
+    glfwMakeContextCurrent(nullptr);
+
+    {   /* scope so render thread is stopped before cleanup below */
+
+        RenderThread renderThread(window);
+
+        /* 2 frames -> workers record one while render thread draws the other */
+        Frame frames[2];
+        for (Frame& f : frames)
+            f.buffers.resize(workers.GetCount());
+
+        const unsigned int objectCount = 8000;
+        float r = 0.0f;
+        float increment = 0.05f;
+        unsigned int frameIndex = 0;
+
+
+        /* WHILE Loop to keep the window active till window is closed */
+        while (!glfwWindowShouldClose(window))
+        {
+            Frame& frame = frames[frameIndex % 2];
+            renderThread.WaitIdle(&frame);
+
+            /* every worker records a slice of the objects */
+            workers.Run([&](unsigned int t) {
+                CommandBuffer& cb = frame.buffers[t];
+                cb.Clear();
+                cb.Push(CmdBindProgram{ shader });
+                cb.Push(CmdBindVertexArray{ vao });
+
+                unsigned int begin = objectCount * t / workers.GetCount();
+                unsigned int end = objectCount * (t + 1) / workers.GetCount();
+                for (unsigned int i = begin; i < end; i++) {
+                    cb.Push(CmdUniform4f{ location, { r, (float)i / objectCount, 0.5f, 1.0f } });
+                    cb.Push(CmdDrawElements{ 6, 0 });
+                }
+            });
+
+            renderThread.Submit(&frame);
+
+            if (r > 1.0f)
+                increment = -0.05f;
+            else if (r < 0.0f)
+                increment = 0.05f;
+
+            r += increment;
+            frameIndex++;
+
+            /* Poll for and process events (has to be on main thread) */
+            glfwPollEvents();
+        }
+
+        renderThread.WaitIdle(&frames[0]);
+        renderThread.WaitIdle(&frames[1]);
+    }
+
+    /* render thread is gone, take the context back to delete things */
+    glfwMakeContextCurrent(window);
+
+    glDeleteBuffers(1, &buffer);
+    glDeleteBuffers(1, &ibo);
+    glDeleteVertexArrays(1, &vao);
+    glDeleteProgram(shader);
+
+    glfwTerminate();
+    return 0;
+}
+
+
+
+
+/* Makes and compile the shader by inputing the type and Source code */
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source) {
+
+    unsigned int id = glCreateShader(shaderType);   /* generate Shader and return id */
+    const char* src = source.c_str();               /* convert inputed string to char* */
+    GLCall(glShaderSource(id, 1, &src, nullptr));           /* attaching source code to the shader */
+    GLCall(glCompileShader(id));                            /* compile shader */
+
+    /* -------- ERROR HANDLING -------- */
+        int result;
+        GLCall(glGetShaderiv(id, GL_COMPILE_STATUS, &result));
+        if (result == GL_FALSE) {
+            int length;
+            GLCall(glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length));
+            char* message = (char*) _malloca(length * sizeof(char));      /* just means char Array of length 'length'  or    char message[length] */
+            GLCall(glGetShaderInfoLog(id, length, &length, message));
+
+            std::cout << "Failed To Compile " << (shaderType == GL_VERTEX_SHADER ? "vertex" : "fragment") << " shader" << std::endl;
+
+            std::cout << message << std::endl;
+            GLCall(glDeleteShader(id));
+            return 0;
+        }
+
+    /* -------- END ERROR HANDLING -------- */
+
+    return id;
+
+}
+
+
+/* Creates a program Which contain vertex and fragment shader */
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader) {
+
+    GLCall(unsigned int program = glCreateProgram());                           /* generate program to store all shader and program to be run by GPU during while loop */
+    unsigned int vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
+    unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+
+    GLCall(glAttachShader(program, vs));                                        /* Attach shader to program to be run by GPU */
+    GLCall(glAttachShader(program, fs));
+    GLCall(glLinkProgram(program));
+    GLCall(glValidateProgram(program));
+    GLCall(glDeleteShader(vs));                                                 /* DELETING shader to save space as shader is already attached to program */
+    GLCall(glDeleteShader(fs));
+
+    return program;
+
+}
+
+
+/* Read file and output vertex and fragment shader source code */
+static ShaderProgramSource ParseShader(const std::string& filepath) {
+
+    std::ifstream stream(filepath);
+
+    enum class ShaderType {
+        NONE = -1, VERTEX = 0, FRAGMENT = 1
+    };
+
+    std::string line;
+    std::stringstream ss[2];
+    ShaderType type = ShaderType::NONE;
+    while (getline(stream, line)) {
+
+        if (line.find("#shader") != std::string::npos) {
+
+            if (line.find("vertex") != std::string::npos)
+                type = ShaderType::VERTEX;
+            else if (line.find("fragment") != std::string::npos)
+                type = ShaderType::FRAGMENT;
+
+        }
+        else {
+            ss[int(type)] << line << '\n';
+        }
+    }
+
+    return { ss[0].str(), ss[1].str() };
+}
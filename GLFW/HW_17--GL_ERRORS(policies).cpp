@@ -0,0 +1,408 @@
+/*
+
+GL_ERRORS with policies (debug / async / off)
+
+GLCall from HW_6 calls GLCLearError (glGetError in a loop) before every call and GlLogCall (glGetError again) after it
+glGetError can make the cpu wait for the driver (round trip) so with GLCall on every call the frame gets slow
+and ASSERT uses __debugbreak which is only in MSVC, on linux it does not even compile
+
+so now which checking is done is chosen at compile time with GL_CHECK_POLICY
+
+---> GL_CHECK_NONE   : GLCall(x) becomes just x , zero cost (release build)
+---> GL_CHECK_ASYNC  : GLCall(x) is also just x , but driver tells us about errors itself through glDebugMessageCallback
+                       GL_DEBUG_OUTPUT_SYNCHRONOUS is off so driver can report later and does not slow down the call
+                       (we lose file and line, but message from driver says what was wrong)
+---> GL_CHECK_STRICT : same as old GLCall, stops exactly on the line with error
+
+DEBUG_BREAK uses __debugbreak on MSVC and raise(SIGTRAP) on gcc / clang (linux, mac) so debugger stops there too
+
+at start the cost of GLCall with the chosen policy is measured on 1 million glUniform4f calls
+
+*/
+
+
+
+
+#include <GL\glew.h>
+
+#include <GLFW/glfw3.h>
+
+
+#include <iostream>
+#include <fstream>  // to read file
+#include <string>   // To use getline func
+#include <sstream>
+#include <vector>
+#include <chrono>   // to measure cost of GLCall
+#include <math.h>
+
+
+/* ------------ ERROR CHECK POLICY ------------ */
+/*
+GL_CHECK_NONE   -> GLCall(x) is just x, nothing is checked (release)
+GL_CHECK_ASYNC  -> GLCall(x) is just x, driver reports errors later through glDebugMessageCallback (needs KHR_debug / GL 4.3)
+GL_CHECK_STRICT -> glGetError before and after every call, stops on the line with the error (old GLCall)
+
+default is NONE for release (NDEBUG) and STRICT for debug, or pass -DGL_CHECK_POLICY=1 to compiler to choose
+*/
+#define GL_CHECK_NONE   0
+#define GL_CHECK_ASYNC  1
+#define GL_CHECK_STRICT 2
+
+#ifndef GL_CHECK_POLICY
+    #ifdef NDEBUG
+        #define GL_CHECK_POLICY GL_CHECK_NONE
+    #else
+        #define GL_CHECK_POLICY GL_CHECK_STRICT
+    #endif
+#endif
+
+
+/* ------------ MACRO ------------ */
+
+/* __debugbreak is only in MSVC, on gcc / clang SIGTRAP does same thing (debugger stops there) */
+#if defined(_MSC_VER)
+    #define DEBUG_BREAK() __debugbreak()
+#elif defined(__GNUC__) || defined(__clang__)
+    #include <signal.h>
+    #define DEBUG_BREAK() raise(SIGTRAP)
+#else
+    #include <cstdlib>
+    #define DEBUG_BREAK() std::abort()
+#endif
+
+#define ASSERT(x) if (!(x)) DEBUG_BREAK();
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+    #define GLCall(x) GLCLearError();\
+        x;\
+        ASSERT(GlLogCall(#x, __FILE__, __LINE__))
+#else
+    #define GLCall(x) x
+#endif
+
+/*
+# before a fucntion pass it as a stringand __FILE__and __LINE__ are macros to get file loc and line of fucntion
+and since MACROS HAS TO BE IN SAME LINE we use \ before line ends to write macros in multiple lines
+*/
+
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+static void GLCLearError() {
+    while (glGetError() != GL_NO_ERROR);    // glGetError get error and we get all the error until there are no arror left
+}
+
+static bool GlLogCall(const char* function, const char* file, int line) {
+    bool ok = true;
+    while (GLenum error = glGetError()) {
+        std::cout << "[OpenGl Error] (" << error << "): " << function << " " << file << ":" << line << std::endl;
+        ok = false;
+    }
+    return ok;
+}
+#endif
+
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+/* called by the driver (maybe from its own thread) when something is wrong */
+static void APIENTRY GlDebugCallback(GLenum /*source*/, GLenum type, GLuint id, GLenum severity, GLsizei /*length*/, const GLchar* message, const void* /*userParam*/) {
+
+    const char* level = severity == GL_DEBUG_SEVERITY_HIGH ? "HIGH" : severity == GL_DEBUG_SEVERITY_MEDIUM ? "MEDIUM" : "LOW";
+    std::cout << "[OpenGl Debug] (" << level << (type == GL_DEBUG_TYPE_ERROR ? ", error" : "") << ", id " << id << "): " << message << std::endl;
+}
+#endif
+
+/* call once after glewInit, sets up whatever the chosen policy needs */
+static void SetupGLErrorPolicy() {
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+    if (GLEW_VERSION_4_3 || GLEW_KHR_debug) {
+        glEnable(GL_DEBUG_OUTPUT);
+        glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);     /* driver does not have to report inside the call, so no slow down */
+        glDebugMessageCallback(GlDebugCallback, nullptr);
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);  /* skip info messages */
+        std::cout << "GL errors: async (debug callback)" << std::endl;
+    }
+    else {
+        std::cout << "GL errors: async asked but KHR_debug is not there, errors are not checked" << std::endl;
+    }
+#elif GL_CHECK_POLICY == GL_CHECK_STRICT
+    std::cout << "GL errors: strict (glGetError after every call)" << std::endl;
+#else
+    std::cout << "GL errors: off" << std::endl;
+#endif
+}
+
+
+struct ShaderProgramSource {
+    std::string VertexSource;
+    std::string FragmentSource;
+};
+
+static ShaderProgramSource ParseShader(const std::string& filepath);
+
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader);
+
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source);
+
+
+int main(void)
+{
+    /* GLFW BASIC STUFF */
+        GLFWwindow* window;
+
+        /* Initialize the GLFW library */
+        if (!glfwInit())
+            return -1;
+
+
+        /* setting version 3.3 and core profile (i.e mordern opengl) */
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);    /* most drivers only send debug messages in debug context */
+#endif
+
+
+        /* Create a windowed mode window and its OpenGL context */
+        window = glfwCreateWindow(640, 480, "Hello World", NULL, NULL);
+        if (!window)
+        {
+            glfwTerminate();
+            return -1;
+
+        }
+        /* Make the window's context current */
+        glfwMakeContextCurrent(window);
+
+        glfwSwapInterval(1);    /* controls FPS or intervel between buffer(frames) */
+
+    /*  END BASIC GLFW   */
+
+
+    /* Intitialize GLEW */
+        if (glewInit() != GLEW_OK) {
+            std::cout << "Error!" << std::endl;
+        }
+    /* END */
+
+    std::cout << glGetString(GL_VERSION) << std::endl;  /* prints the version of opengl using */
+
+    SetupGLErrorPolicy();
+
+
+
+    /* ------------- Generating Data to be used to display in the window ------------- */
+
+        /* ------------- Vertex Info (like position, color, texture, smoothness, normal,etc) ------------- */
+
+            // 4 positions of vertices of sqaure
+            float positions[] = {
+                -0.5f, -0.5f,    // 0
+                 0.5f, -0.5f,    // 1
+                 0.5f,  0.5f,    // 2
+                -0.5f,  0.5f     // 3
+            };
+
+            // Index data -----> position in which vertices is to be rendered to form a square
+            unsigned int indices[] = {
+                0, 1, 2,
+                2, 3, 0
+            };
+
+
+        /* ------------- VERTEX ARRAY OBJECT ------------- */
+            unsigned int vao;
+            GLCall(glGenVertexArrays(1, &vao));
+            GLCall(glBindVertexArray(vao));
+
+
+        /* ------------- BUFFER DATA ------------- */
+
+            unsigned int buffer;
+            GLCall(glGenBuffers(1, &buffer));
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, buffer));
+            GLCall(glBufferData(GL_ARRAY_BUFFER, 4 * 2 * sizeof(float), positions, GL_STATIC_DRAW));
+
+
+        /* ------------- VERTEX_Attribute ------------- */
+
+            GLCall(glEnableVertexAttribArray(0));
+            GLCall(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2, 0));
+
+
+        /* ------------- INDEX BUFFER ------------- */
+
+            unsigned int ibo;       // index buffer object
+            GLCall(glGenBuffers(1, &ibo));
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo));
+            GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, 6 * sizeof(unsigned int), indices, GL_STATIC_DRAW));
+
+
+        /* ------------- SHADERS ------------- */
+
+            ShaderProgramSource shaderSource = ParseShader("res/shaders/Basic - UNFORMS.shader");
+            unsigned int shader = CreateShader(shaderSource.VertexSource, shaderSource.FragmentSource);
+            GLCall(glUseProgram(shader));
+
+
+        /* ------------- Setting UNIFORMS ------------- */
+
+            GLCall(int location = glGetUniformLocation(shader, "u_Color"));
+            ASSERT(location != -1);
+
+
+    /* ------------- END OF GENERATING DATA ------------- */
+
+
+    /* ------------- COST OF GLCall ------------- */
+
+        const int calls = 1000000;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < calls; i++) {
+            GLCall(glUniform4f(location, (float)(i & 255) / 255.0f, 0.2f, 0.5f, 1.0f));
+        }
+        glFinish();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+        std::cout << "[GLCall] " << calls << " wrapped glUniform4f calls took " << ms << " ms (" << ms * 1000000.0 / calls << " ns per call)" << std::endl;
+
+    /* ------------- END COST ------------- */
+
+
+    /* ----------- Unbound everything ----------- */
+
+            GLCall(glUseProgram(0));
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, 0));           //buffer
+            GLCall(glBindVertexArray(0));                       // Vao
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));   // inbex buffer
+
+
+
+
+    /* ----------- Animation Variable ----------- */
+    float r = 0.0f;
+    float increment = 0.05f;
+
+
+
+    /* WHILE Loop to keep the window active till window is closed */
+    while (!glfwWindowShouldClose(window))
+    {
+        /* Render here */
+
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        /* ------------- Bind Back everything ------------- */
+        GLCall(glUseProgram(shader));
+        GLCall(glUniform4f(location, r, 0.2f, 0.5f, 1.0f));
+        GLCall(glBindVertexArray(vao));
+
+        GLCall(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr));
+
+        if (r > 1.0f)
+            increment = -0.05f;
+        else if (r < 0.0f)
+            increment = 0.05f;
+
+        r += increment;
+
+
+        /* Swap front and back buffers */
+        glfwSwapBuffers(window);
+
+        /* Poll for and process events */
+        glfwPollEvents();
+    }
+
+    glDeleteBuffers(1, &buffer);
+    glDeleteBuffers(1, &ibo);
+    glDeleteVertexArrays(1, &vao);
+    glDeleteProgram(shader);
+
+    glfwTerminate();
+    return 0;
+}
+
+
+
+
+/* Makes and compile the shader by inputing the type and Source code */
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source) {
+
+    unsigned int id = glCreateShader(shaderType);   /* generate Shader and return id */
+    const char* src = source.c_str();               /* convert inputed string to char* */
+    GLCall(glShaderSource(id, 1, &src, nullptr));           /* attaching source code to the shader */
+    GLCall(glCompileShader(id));                            /* compile shader */
+
+    /* -------- ERROR HANDLING -------- */
+        int result;
+        GLCall(glGetShaderiv(id, GL_COMPILE_STATUS, &result));
+        if (result == GL_FALSE) {
+            int length;
+            GLCall(glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length));
+            std::vector<char> message(length + 1);      /* char Array of length 'length' (_malloca is only in MSVC) */
+            GLCall(glGetShaderInfoLog(id, length, &length, message.data()));
+
+            std::cout << "Failed To Compile " << (shaderType == GL_VERTEX_SHADER ? "vertex" : "fragment") << " shader" << std::endl;
+
+            std::cout << message.data() << std::endl;
+            GLCall(glDeleteShader(id));
+            return 0;
+        }
+
+    /* -------- END ERROR HANDLING -------- */
+
+    return id;
+
+}
+
+
+/* Creates a program Which contain vertex and fragment shader */
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader) {
+
+    GLCall(unsigned int program = glCreateProgram());                           /* generate program to store all shader and program to be run by GPU during while loop */
+    unsigned int vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
+    unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+
+    GLCall(glAttachShader(program, vs));                                        /* Attach shader to program to be run by GPU */
+    GLCall(glAttachShader(program, fs));
+    GLCall(glLinkProgram(program));
+    GLCall(glValidateProgram(program));
+    GLCall(glDeleteShader(vs));                                                 /* DELETING shader to save space as shader is already attached to program */
+    GLCall(glDeleteShader(fs));
+
+    return program;
+
+}
+
+
+/* Read file and output vertex and fragment shader source code */
+static ShaderProgramSource ParseShader(const std::string& filepath) {
+
+    std::ifstream stream(filepath);
+
+    enum class ShaderType {
+        NONE = -1, VERTEX = 0, FRAGMENT = 1
+    };
+
+    std::string line;
+    std::stringstream ss[2];
+    ShaderType type = ShaderType::NONE;
+    while (getline(stream, line)) {
+
+        if (line.find("#shader") != std::string::npos) {
+
+            if (line.find("vertex") != std::string::npos)
+                type = ShaderType::VERTEX;
+            else if (line.find("fragment") != std::string::npos)
+                type = ShaderType::FRAGMENT;
+
+        }
+        else {
+            ss[int(type)] << line << '\n';
+        }
+    }
+
+    return { ss[0].str(), ss[1].str() };
+}
@@ -0,0 +1,640 @@
+/*
+
+GL Tracer and GPU Profiler (chrome trace)
+
+GLCall is already on every gl call (HW_6, HW_17), so it is a good place to measure more than errors
+with GL_TRACE on, GLCall also records
+
+---> how long the call took on the cpu (two clock reads around the call)
+---> how many times every gl function was called and total time spent in it
+
+cpu time of a gl call is not the time the GPU takes, GPU works later and in parallel
+so for GPU we use timer queries -> glQueryCounter(query, GL_TIMESTAMP) at start and end of a named scope (like "draw squares")
+result of a query is ready only some frames later, if we ask for it right away cpu waits for GPU (stall)
+so queries are kept in a pool of 3 frames -> frame N reads back the results of frame N-3 which are done by now
+(GL_TIMESTAMP pairs are used and not GL_TIME_ELAPSED because TIME_ELAPSED queries can not be nested)
+
+at exit everything is written in trace.json in chrome trace_event format
+open chrome://tracing (or ui.perfetto.dev) and load the file to see every frame on a timeline
+a table of calls per gl function is also printed
+
+*/
+
+
+
+
+#include <GL\glew.h>
+
+#include <GLFW/glfw3.h>
+
+
+#include <iostream>
+#include <fstream>  // to read file
+#include <string>   // To use getline func
+#include <sstream>
+#include <vector>
+#include <chrono>
+#include <unordered_map>
+#include <map>
+#include <algorithm>
+#include <cctype>   // isupper
+#include <math.h>
+
+
+/* ------------ TRACE ------------ */
+/* GL_TRACE 1 -> GLCall records cpu time of every call, can be turned off with -DGL_TRACE=0 */
+#ifndef GL_TRACE
+    #define GL_TRACE 1
+#endif
+
+
+/* ------------ ERROR CHECK POLICY ------------ */
+/*
+GL_CHECK_NONE   -> GLCall(x) is just x, nothing is checked (release)
+GL_CHECK_ASYNC  -> GLCall(x) is just x, driver reports errors later through glDebugMessageCallback (needs KHR_debug / GL 4.3)
+GL_CHECK_STRICT -> glGetError before and after every call, stops on the line with the error (old GLCall)
+
+default is NONE for release (NDEBUG) and STRICT for debug, or pass -DGL_CHECK_POLICY=1 to compiler to choose
+*/
+#define GL_CHECK_NONE   0
+#define GL_CHECK_ASYNC  1
+#define GL_CHECK_STRICT 2
+
+#ifndef GL_CHECK_POLICY
+    #ifdef NDEBUG
+        #define GL_CHECK_POLICY GL_CHECK_NONE
+    #else
+        #define GL_CHECK_POLICY GL_CHECK_STRICT
+    #endif
+#endif
+
+
+/* ------------ MACRO ------------ */
+
+/* __debugbreak is only in MSVC, on gcc / clang SIGTRAP does same thing (debugger stops there) */
+#if defined(_MSC_VER)
+    #define DEBUG_BREAK() __debugbreak()
+#elif defined(__GNUC__) || defined(__clang__)
+    #include <signal.h>
+    #define DEBUG_BREAK() raise(SIGTRAP)
+#else
+    #include <cstdlib>
+    #define DEBUG_BREAK() std::abort()
+#endif
+
+#define ASSERT(x) if (!(x)) DEBUG_BREAK();
+
+/* with GL_TRACE the clock is read only around the call itself, so time of glGetError is not counted */
+#if GL_CHECK_POLICY == GL_CHECK_STRICT && GL_TRACE
+    #define GLCall(x) GLCLearError();\
+        GLTraceBegin();\
+        x;\
+        GLTraceEnd(#x);\
+        ASSERT(GlLogCall(#x, __FILE__, __LINE__))
+#elif GL_CHECK_POLICY == GL_CHECK_STRICT
+    #define GLCall(x) GLCLearError();\
+        x;\
+        ASSERT(GlLogCall(#x, __FILE__, __LINE__))
+#elif GL_TRACE
+    #define GLCall(x) GLTraceBegin();\
+        x;\
+        GLTraceEnd(#x)
+#else
+    #define GLCall(x) x
+#endif
+
+/*
+# before a fucntion pass it as a stringand __FILE__and __LINE__ are macros to get file loc and line of fucntion
+and since MACROS HAS TO BE IN SAME LINE we use \ before line ends to write macros in multiple lines
+*/
+
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+static void GLCLearError() {
+    while (glGetError() != GL_NO_ERROR);    // glGetError get error and we get all the error until there are no arror left
+}
+
+static bool GlLogCall(const char* function, const char* file, int line) {
+    bool ok = true;
+    while (GLenum error = glGetError()) {
+        std::cout << "[OpenGl Error] (" << error << "): " << function << " " << file << ":" << line << std::endl;
+        ok = false;
+    }
+    return ok;
+}
+#endif
+
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+/* called by the driver (maybe from its own thread) when something is wrong */
+static void APIENTRY GlDebugCallback(GLenum /*source*/, GLenum type, GLuint id, GLenum severity, GLsizei /*length*/, const GLchar* message, const void* /*userParam*/) {
+
+    const char* level = severity == GL_DEBUG_SEVERITY_HIGH ? "HIGH" : severity == GL_DEBUG_SEVERITY_MEDIUM ? "MEDIUM" : "LOW";
+    std::cout << "[OpenGl Debug] (" << level << (type == GL_DEBUG_TYPE_ERROR ? ", error" : "") << ", id " << id << "): " << message << std::endl;
+}
+#endif
+
+/* call once after glewInit, sets up whatever the chosen policy needs */
+static void SetupGLErrorPolicy() {
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+    if (GLEW_VERSION_4_3 || GLEW_KHR_debug) {
+        glEnable(GL_DEBUG_OUTPUT);
+        glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);     /* driver does not have to report inside the call, so no slow down */
+        glDebugMessageCallback(GlDebugCallback, nullptr);
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);  /* skip info messages */
+        std::cout << "GL errors: async (debug callback)" << std::endl;
+    }
+    else {
+        std::cout << "GL errors: async asked but KHR_debug is not there, errors are not checked" << std::endl;
+    }
+#elif GL_CHECK_POLICY == GL_CHECK_STRICT
+    std::cout << "GL errors: strict (glGetError after every call)" << std::endl;
+#else
+    std::cout << "GL errors: off" << std::endl;
+#endif
+}
+
+
+/* ------------- CPU CLOCK ------------- */
+
+/* microseconds since start of program, chrome trace wants time in us */
+static double NowUs() {
+    static const auto start = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+
+/* one box on the timeline of chrome trace */
+struct TraceEvent {
+    const char* name;           /* always a string literal (#x of GLCall or scope name) so no copy is made */
+    const char* category;       /* "gl" , "cpu" or "gpu" */
+    int thread;                 /* row in the viewer, gpu gets its own row */
+    double start, duration;     /* in us */
+};
+
+static std::vector<TraceEvent> s_TraceEvents;
+static const size_t s_MaxTraceEvents = 500000;      /* so a long run does not use all memory, stats are still counted after this */
+
+
+/* ------------- GL CALL TRACER ------------- */
+
+/* stats of one GLCall line in code, key is the #x string which is same pointer for same line */
+struct CallSiteStats {
+    unsigned long long calls = 0;
+    double totalUs = 0.0;
+};
+
+static std::unordered_map<const char*, CallSiteStats> s_CallSites;
+
+#if GL_TRACE
+static double s_CallStart = 0.0;
+
+static void GLTraceBegin() {
+    s_CallStart = NowUs();
+}
+
+static void GLTraceEnd(const char* call) {
+    double end = NowUs();
+    CallSiteStats& site = s_CallSites[call];
+    site.calls++;
+    site.totalUs += end - s_CallStart;
+
+    if (s_TraceEvents.size() < s_MaxTraceEvents)
+        s_TraceEvents.push_back({ call, "gl", 1, s_CallStart, end - s_CallStart });
+}
+#endif
+
+/* "int location = glGetUniformLocation(shader, ...)" -> "glGetUniformLocation" */
+static std::string GLEntryPoint(const std::string& call) {
+    size_t begin = 0;
+    while ((begin = call.find("gl", begin)) != std::string::npos) {
+        if (begin + 2 < call.size() && isupper((unsigned char)call[begin + 2]) && (begin == 0 || !isalnum((unsigned char)call[begin - 1])))
+            break;
+        begin += 2;
+    }
+    if (begin == std::string::npos)
+        return call;
+    size_t end = call.find('(', begin);
+    return call.substr(begin, end - begin);
+}
+
+/* adds all lines calling same gl function together and prints them, most expensive first */
+static void PrintGLCallStats() {
+
+    std::map<std::string, CallSiteStats> perFunction;
+    for (const auto& site : s_CallSites) {
+        CallSiteStats& f = perFunction[GLEntryPoint(site.first)];
+        f.calls += site.second.calls;
+        f.totalUs += site.second.totalUs;
+    }
+
+    std::vector<std::pair<std::string, CallSiteStats>> sorted(perFunction.begin(), perFunction.end());
+    std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) { return a.second.totalUs > b.second.totalUs; });
+
+    std::cout << "[GLTrace] calls per gl function" << std::endl;
+    for (const auto& f : sorted) {
+        std::cout << "  " << f.first << " : " << f.second.calls << " calls, " << f.second.totalUs / 1000.0 << " ms total, "
+                  << f.second.totalUs * 1000.0 / f.second.calls << " ns avg" << std::endl;
+    }
+}
+
+
+/* ------------- GPU PROFILER ------------- */
+
+class GpuProfiler {
+public:
+    static const unsigned int FramesInFlight = 3;       /* results of frame N are read in frame N + 3 */
+    static const unsigned int MaxScopes = 64;           /* per frame */
+
+    GpuProfiler() {
+        for (Frame& f : m_Frames) {
+            glGenQueries(MaxScopes * 2, f.queries);
+            f.scopes.reserve(MaxScopes);
+        }
+
+        /* gpu clock and cpu clock start at different time, so find the difference once */
+        GLint64 gpuNow;
+        glGetInteger64v(GL_TIMESTAMP, &gpuNow);
+        m_GpuToCpuUs = NowUs() - gpuNow / 1000.0;
+    }
+
+    ~GpuProfiler() {
+        for (Frame& f : m_Frames)
+            glDeleteQueries(MaxScopes * 2, f.queries);
+    }
+
+    /* call at start of frame, reads results of the oldest frame which uses same queries */
+    void BeginFrame() {
+        m_Current = (m_Current + 1) % FramesInFlight;
+        Frame& f = m_Frames[m_Current];
+
+        for (size_t i = 0; i < f.scopes.size(); i++) {
+            GLuint startQuery = f.queries[i * 2], endQuery = f.queries[i * 2 + 1];
+
+            GLint available = 0;
+            glGetQueryObjectiv(endQuery, GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available) {
+                m_Dropped++;        /* gpu is more than 3 frames behind, skip instead of waiting */
+                continue;
+            }
+
+            GLuint64 gpuStart, gpuEnd;
+            glGetQueryObjectui64v(startQuery, GL_QUERY_RESULT, &gpuStart);
+            glGetQueryObjectui64v(endQuery, GL_QUERY_RESULT, &gpuEnd);
+
+            double durationUs = (gpuEnd - gpuStart) / 1000.0;
+            m_TotalUs[f.scopes[i]] += durationUs;
+            if (s_TraceEvents.size() < s_MaxTraceEvents)
+                s_TraceEvents.push_back({ f.scopes[i], "gpu", 2, gpuStart / 1000.0 + m_GpuToCpuUs, durationUs });
+        }
+        f.scopes.clear();
+        f.open.clear();
+    }
+
+    void BeginScope(const char* name) {
+        Frame& f = m_Frames[m_Current];
+        ASSERT(f.scopes.size() < MaxScopes);
+        glQueryCounter(f.queries[f.scopes.size() * 2], GL_TIMESTAMP);
+        f.open.push_back((unsigned int)f.scopes.size());
+        f.scopes.push_back(name);
+    }
+
+    void EndScope() {
+        Frame& f = m_Frames[m_Current];
+        ASSERT(!f.open.empty());
+        glQueryCounter(f.queries[f.open.back() * 2 + 1], GL_TIMESTAMP);
+        f.open.pop_back();
+    }
+
+    void PrintStats(unsigned int frames) const {
+        std::cout << "[GpuProfiler] average gpu time per frame (" << m_Dropped << " results dropped)" << std::endl;
+        for (const auto& scope : m_TotalUs)
+            std::cout << "  " << scope.first << " : " << scope.second / 1000.0 / frames << " ms" << std::endl;
+    }
+
+private:
+    struct Frame {
+        GLuint queries[MaxScopes * 2];          /* start, end, start, end ... */
+        std::vector<const char*> scopes;        /* name of every scope started this frame */
+        std::vector<unsigned int> open;         /* scopes which are not ended yet (for nesting) */
+    };
+
+    Frame m_Frames[FramesInFlight];
+    unsigned int m_Current = 0;
+    double m_GpuToCpuUs = 0.0;
+    unsigned int m_Dropped = 0;
+    std::map<std::string, double> m_TotalUs;
+};
+
+
+/* cpu side named scope, shows on same timeline as gl calls */
+class CpuScope {
+public:
+    CpuScope(const char* name) : m_Name(name), m_Start(NowUs()) {}
+    ~CpuScope() {
+        if (s_TraceEvents.size() < s_MaxTraceEvents)
+            s_TraceEvents.push_back({ m_Name, "cpu", 1, m_Start, NowUs() - m_Start });
+    }
+private:
+    const char* m_Name;
+    double m_Start;
+};
+
+
+/* writes all events in chrome trace_event json format */
+static void WriteChromeTrace(const std::string& filepath) {
+
+    std::ofstream out(filepath);
+    out << "{\"traceEvents\":[\n";
+    out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"CPU\"}},\n";
+    out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,\"args\":{\"name\":\"GPU\"}}";
+
+    for (const TraceEvent& e : s_TraceEvents) {
+        std::string name;
+        for (const char* c = e.name; *c; c++) {         /* escape for json */
+            if (*c == '"' || *c == '\\') name += '\\';
+            name += *c;
+        }
+        out << ",\n{\"name\":\"" << name << "\",\"cat\":\"" << e.category << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << e.thread
+            << ",\"ts\":" << std::fixed << e.start << ",\"dur\":" << e.duration << "}";
+    }
+    out << "\n]}\n";
+
+    std::cout << "[Trace] " << s_TraceEvents.size() << " events written to " << filepath << std::endl;
+}
+
+
+
+struct ShaderProgramSource {
+    std::string VertexSource;
+    std::string FragmentSource;
+};
+
+static ShaderProgramSource ParseShader(const std::string& filepath);
+
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader);
+
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source);
+
+
+int main(void)
+{
+    /* GLFW BASIC STUFF */
+        GLFWwindow* window;
+
+        /* Initialize the GLFW library */
+        if (!glfwInit())
+            return -1;
+
+
+        /* setting version 3.3 and core profile (i.e mordern opengl) */
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);    /* most drivers only send debug messages in debug context */
+#endif
+
+
+        /* Create a windowed mode window and its OpenGL context */
+        window = glfwCreateWindow(640, 480, "Hello World", NULL, NULL);
+        if (!window)
+        {
+            glfwTerminate();
+            return -1;
+
+        }
+        /* Make the window's context current */
+        glfwMakeContextCurrent(window);
+
+        glfwSwapInterval(1);    /* controls FPS or intervel between buffer(frames) */
+
+    /*  END BASIC GLFW   */
+
+
+    /* Intitialize GLEW */
+        if (glewInit() != GLEW_OK) {
+            std::cout << "Error!" << std::endl;
+        }
+    /* END */
+
+    std::cout << glGetString(GL_VERSION) << std::endl;  /* prints the version of opengl using */
+
+    SetupGLErrorPolicy();
+
+    {   /* scope so that profiler queries are deleted before glfwTerminate destroys the context */
+
+
+    /* ------------- Generating Data to be used to display in the window ------------- */
+
+        /* ------------- Vertex Info (like position, color, texture, smoothness, normal,etc) ------------- */
+
+            // 4 positions of vertices of sqaure
+            float positions[] = {
+                -0.5f, -0.5f,    // 0
+                 0.5f, -0.5f,    // 1
+                 0.5f,  0.5f,    // 2
+                -0.5f,  0.5f     // 3
+            };
+
+            // Index data -----> position in which vertices is to be rendered to form a square
+            unsigned int indices[] = {
+                0, 1, 2,
+                2, 3, 0
+            };
+
+
+        /* ------------- VERTEX ARRAY OBJECT ------------- */
+            unsigned int vao;
+            GLCall(glGenVertexArrays(1, &vao));
+            GLCall(glBindVertexArray(vao));
+
+            unsigned int buffer;
+            GLCall(glGenBuffers(1, &buffer));
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, buffer));
+            GLCall(glBufferData(GL_ARRAY_BUFFER, 4 * 2 * sizeof(float), positions, GL_STATIC_DRAW));
+
+            GLCall(glEnableVertexAttribArray(0));
+            GLCall(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2, 0));
+
+            unsigned int ibo;       // index buffer object
+            GLCall(glGenBuffers(1, &ibo));
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo));
+            GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, 6 * sizeof(unsigned int), indices, GL_STATIC_DRAW));
+
+
+        /* ------------- SHADERS ------------- */
+
+            ShaderProgramSource shaderSource = ParseShader("res/shaders/Basic - UNFORMS.shader");
+            unsigned int shader = CreateShader(shaderSource.VertexSource, shaderSource.FragmentSource);
+            GLCall(glUseProgram(shader));
+
+            GLCall(int location = glGetUniformLocation(shader, "u_Color"));
+            ASSERT(location != -1);
+
+
+    /* ------------- END OF GENERATING DATA ------------- */
+
+
+    /* ----------- Unbound everything ----------- */
+
+            GLCall(glUseProgram(0));
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, 0));
+            GLCall(glBindVertexArray(0));
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
+
+
+    GpuProfiler gpu;
+
+
+    /* ----------- Animation Variable ----------- */
+    float r = 0.0f;
+    float increment = 0.05f;
+    const unsigned int objectCount = 500;
+    unsigned int frames = 0;
+
+
+
+    /* WHILE Loop to keep the window active till window is closed */
+    while (!glfwWindowShouldClose(window))
+    {
+        CpuScope frameScope("frame");
+        gpu.BeginFrame();
+
+        /* Render here */
+
+        gpu.BeginScope("clear");
+        GLCall(glClear(GL_COLOR_BUFFER_BIT));
+        gpu.EndScope();
+
+        {
+            CpuScope drawScope("draw squares");
+            gpu.BeginScope("draw squares");
+
+            GLCall(glUseProgram(shader));
+            GLCall(glBindVertexArray(vao));
+            for (unsigned int i = 0; i < objectCount; i++) {
+                GLCall(glUniform4f(location, r, (float)i / objectCount, 0.5f, 1.0f));
+                GLCall(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr));
+            }
+
+            gpu.EndScope();
+        }
+
+        if (r > 1.0f)
+            increment = -0.05f;
+        else if (r < 0.0f)
+            increment = 0.05f;
+
+        r += increment;
+        frames++;
+
+
+        {
+            CpuScope swapScope("swap");
+
+            /* Swap front and back buffers */
+            glfwSwapBuffers(window);
+        }
+
+        /* Poll for and process events */
+        glfwPollEvents();
+    }
+
+    PrintGLCallStats();
+    gpu.PrintStats(frames);
+    WriteChromeTrace("trace.json");
+
+    glDeleteBuffers(1, &buffer);
+    glDeleteBuffers(1, &ibo);
+    glDeleteVertexArrays(1, &vao);
+    glDeleteProgram(shader);
+    }
+
+    glfwTerminate();
+    return 0;
+}
+
+
+
+
+/* Makes and compile the shader by inputing the type and Source code */
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source) {
+
+    unsigned int id = glCreateShader(shaderType);   /* generate Shader and return id */
+    const char* src = source.c_str();               /* convert inputed string to char* */
+    GLCall(glShaderSource(id, 1, &src, nullptr));           /* attaching source code to the shader */
+    GLCall(glCompileShader(id));                            /* compile shader */
+
+    /* -------- ERROR HANDLING -------- */
+        int result;
+        GLCall(glGetShaderiv(id, GL_COMPILE_STATUS, &result));
+        if (result == GL_FALSE) {
+            int length;
+            GLCall(glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length));
+            std::vector<char> message(length + 1);      /* char Array of length 'length' (_malloca is only in MSVC) */
+            GLCall(glGetShaderInfoLog(id, length, &length, message.data()));
+
+            std::cout << "Failed To Compile " << (shaderType == GL_VERTEX_SHADER ? "vertex" : "fragment") << " shader" << std::endl;
+
+            std::cout << message.data() << std::endl;
+            GLCall(glDeleteShader(id));
+            return 0;
+        }
+
+    /* -------- END ERROR HANDLING -------- */
+
+    return id;
+
+}
+
+
+/* Creates a program Which contain vertex and fragment shader */
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader) {
+
+    GLCall(unsigned int program = glCreateProgram());                           /* generate program to store all shader and program to be run by GPU during while loop */
+    unsigned int vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
+    unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+
+    GLCall(glAttachShader(program, vs));                                        /* Attach shader to program to be run by GPU */
+    GLCall(glAttachShader(program, fs));
+    GLCall(glLinkProgram(program));
+    GLCall(glValidateProgram(program));
+    GLCall(glDeleteShader(vs));                                                 /* DELETING shader to save space as shader is already attached to program */
+    GLCall(glDeleteShader(fs));
+
+    return program;
+
+}
+
+
+/* Read file and output vertex and fragment shader source code */
+static ShaderProgramSource ParseShader(const std::string& filepath) {
+
+    std::ifstream stream(filepath);
+
+    enum class ShaderType {
+        NONE = -1, VERTEX = 0, FRAGMENT = 1
+    };
+
+    std::string line;
+    std::stringstream ss[2];
+    ShaderType type = ShaderType::NONE;
+    while (getline(stream, line)) {
+
+        if (line.find("#shader") != std::string::npos) {
+
+            if (line.find("vertex") != std::string::npos)
+                type = ShaderType::VERTEX;
+            else if (line.find("fragment") != std::string::npos)
+                type = ShaderType::FRAGMENT;
+
+        }
+        else {
+            ss[int(type)] << line << '\n';
+        }
+    }
+
+    return { ss[0].str(), ss[1].str() };
+}
@@ -0,0 +1,490 @@
+/*
+
+Frame Time (delta time animation + frame time report)
+
+in HW_8 and HW_10 animation is  r += increment  (0.05 every frame) with glfwSwapInterval(1)
+so on 60 Hz monitor color changes 3.0 per second but on 144 Hz monitor it changes 7.2 per second, speed depends on the monitor
+and nothing tells us how long a frame takes
+
+FrameClock fixes both
+
+---> delta time : time between this frame and last frame in seconds, animation is  r += speed * dt  so speed is per second on every machine
+---> benchmark mode : glfwSwapInterval(0) so frames are not waiting for monitor and we see real cost of a frame
+---> every frame cpu time (start of frame -> before swap) and present time (glfwSwapBuffers) go in a histogram
+     and at exit p50 / p95 / p99 / max are printed, so numbers from different machines and drivers can be compared
+
+p95 means 95% of frames were faster than this
+
+*/
+
+
+
+
+#include <GL\glew.h>
+
+#include <GLFW/glfw3.h>
+
+
+#include <iostream>
+#include <fstream>  // to read file
+#include <string>   // To use getline func
+#include <sstream>
+#include <vector>
+#include <chrono>
+#include <math.h>
+
+
+/* ------------ ERROR CHECK POLICY ------------ */
+/*
+GL_CHECK_NONE   -> GLCall(x) is just x, nothing is checked (release)
+GL_CHECK_ASYNC  -> GLCall(x) is just x, driver reports errors later through glDebugMessageCallback (needs KHR_debug / GL 4.3)
+GL_CHECK_STRICT -> glGetError before and after every call, stops on the line with the error (old GLCall)
+
+default is NONE for release (NDEBUG) and STRICT for debug, or pass -DGL_CHECK_POLICY=1 to compiler to choose
+*/
+#define GL_CHECK_NONE   0
+#define GL_CHECK_ASYNC  1
+#define GL_CHECK_STRICT 2
+
+#ifndef GL_CHECK_POLICY
+    #ifdef NDEBUG
+        #define GL_CHECK_POLICY GL_CHECK_NONE
+    #else
+        #define GL_CHECK_POLICY GL_CHECK_STRICT
+    #endif
+#endif
+
+
+/* ------------ MACRO ------------ */
+
+/* __debugbreak is only in MSVC, on gcc / clang SIGTRAP does same thing (debugger stops there) */
+#if defined(_MSC_VER)
+    #define DEBUG_BREAK() __debugbreak()
+#elif defined(__GNUC__) || defined(__clang__)
+    #include <signal.h>
+    #define DEBUG_BREAK() raise(SIGTRAP)
+#else
+    #include <cstdlib>
+    #define DEBUG_BREAK() std::abort()
+#endif
+
+#define ASSERT(x) if (!(x)) DEBUG_BREAK();
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+    #define GLCall(x) GLCLearError();\
+        x;\
+        ASSERT(GlLogCall(#x, __FILE__, __LINE__))
+#else
+    #define GLCall(x) x
+#endif
+
+/*
+# before a fucntion pass it as a stringand __FILE__and __LINE__ are macros to get file loc and line of fucntion
+and since MACROS HAS TO BE IN SAME LINE we use \ before line ends to write macros in multiple lines
+*/
+
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+static void GLCLearError() {
+    while (glGetError() != GL_NO_ERROR);    // glGetError get error and we get all the error until there are no arror left
+}
+
+static bool GlLogCall(const char* function, const char* file, int line) {
+    bool ok = true;
+    while (GLenum error = glGetError()) {
+        std::cout << "[OpenGl Error] (" << error << "): " << function << " " << file << ":" << line << std::endl;
+        ok = false;
+    }
+    return ok;
+}
+#endif
+
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+/* called by the driver (maybe from its own thread) when something is wrong */
+static void APIENTRY GlDebugCallback(GLenum /*source*/, GLenum type, GLuint id, GLenum severity, GLsizei /*length*/, const GLchar* message, const void* /*userParam*/) {
+
+    const char* level = severity == GL_DEBUG_SEVERITY_HIGH ? "HIGH" : severity == GL_DEBUG_SEVERITY_MEDIUM ? "MEDIUM" : "LOW";
+    std::cout << "[OpenGl Debug] (" << level << (type == GL_DEBUG_TYPE_ERROR ? ", error" : "") << ", id " << id << "): " << message << std::endl;
+}
+#endif
+
+/* call once after glewInit, sets up whatever the chosen policy needs */
+static void SetupGLErrorPolicy() {
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+    if (GLEW_VERSION_4_3 || GLEW_KHR_debug) {
+        glEnable(GL_DEBUG_OUTPUT);
+        glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);     /* driver does not have to report inside the call, so no slow down */
+        glDebugMessageCallback(GlDebugCallback, nullptr);
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);  /* skip info messages */
+        std::cout << "GL errors: async (debug callback)" << std::endl;
+    }
+    else {
+        std::cout << "GL errors: async asked but KHR_debug is not there, errors are not checked" << std::endl;
+    }
+#elif GL_CHECK_POLICY == GL_CHECK_STRICT
+    std::cout << "GL errors: strict (glGetError after every call)" << std::endl;
+#else
+    std::cout << "GL errors: off" << std::endl;
+#endif
+}
+
+
+struct ShaderProgramSource {
+    std::string VertexSource;
+    std::string FragmentSource;
+};
+
+static ShaderProgramSource ParseShader(const std::string& filepath);
+
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader);
+
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source);
+
+
+
+/* ------------- HISTOGRAM ------------- */
+
+/* times in bins of 10 us up to 100 ms, so memory is fixed and adding a frame is just one ++ */
+class FrameTimeHistogram {
+public:
+    static const unsigned int BinsPerMs = 100;
+    static const unsigned int MaxMs = 100;
+
+    FrameTimeHistogram() : m_Bins(BinsPerMs * MaxMs + 1, 0) {}
+
+    void Add(double ms) {
+        unsigned int bin = ms < 0.0 ? 0 : (unsigned int)(ms * BinsPerMs);
+        if (bin >= m_Bins.size())
+            bin = (unsigned int)m_Bins.size() - 1;      /* last bin has everything slower than MaxMs */
+        m_Bins[bin]++;
+        m_Count++;
+        if (ms > m_Max)
+            m_Max = ms;
+    }
+
+    /* p from 0 to 100, returns upper edge of the bin where p% of frames are reached */
+    double Percentile(double p) const {
+        if (m_Count == 0)
+            return 0.0;
+        unsigned long long target = (unsigned long long)ceil(m_Count * p / 100.0);
+        unsigned long long seen = 0;
+        for (size_t i = 0; i < m_Bins.size(); i++) {
+            seen += m_Bins[i];
+            if (seen >= target)
+                return i == m_Bins.size() - 1 ? m_Max : (double)(i + 1) / BinsPerMs;
+        }
+        return m_Max;
+    }
+
+    double Max() const { return m_Max; }
+    unsigned long long Count() const { return m_Count; }
+
+    void Print(const char* name) const {
+        std::cout << "  " << name << " : p50 " << Percentile(50) << " ms, p95 " << Percentile(95) << " ms, p99 " << Percentile(99)
+                  << " ms, max " << m_Max << " ms" << std::endl;
+    }
+
+private:
+    std::vector<unsigned long long> m_Bins;
+    unsigned long long m_Count = 0;
+    double m_Max = 0.0;
+};
+
+
+/* ------------- FRAME CLOCK ------------- */
+
+class FrameClock {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    FrameClock() : m_Last(Clock::now()), m_FrameStart(m_Last), m_PresentStart(m_Last) {}
+
+    /* call at start of frame, returns seconds since start of last frame */
+    float BeginFrame() {
+        Clock::time_point now = Clock::now();
+        double dt = std::chrono::duration<double>(now - m_Last).count();
+        m_Last = now;
+        m_FrameStart = now;
+
+        if (m_Frames > 0)       /* first frame has no last frame */
+            m_FrameTimes.Add(dt * 1000.0);
+        m_Frames++;
+
+        /* after a breakpoint or window drag dt can be seconds, limit it so animation does not jump */
+        return (float)(dt > 0.1 ? 0.1 : dt);
+    }
+
+    /* call just before glfwSwapBuffers */
+    void BeginPresent() {
+        m_PresentStart = Clock::now();
+        m_CpuTimes.Add(std::chrono::duration<double, std::milli>(m_PresentStart - m_FrameStart).count());
+    }
+
+    /* call just after glfwSwapBuffers */
+    void EndPresent() {
+        m_PresentTimes.Add(std::chrono::duration<double, std::milli>(Clock::now() - m_PresentStart).count());
+    }
+
+    void PrintReport() const {
+        std::cout << "[FrameClock] " << m_Frames << " frames" << std::endl;
+        m_FrameTimes.Print("frame  ");
+        m_CpuTimes.Print("cpu    ");
+        m_PresentTimes.Print("present");
+    }
+
+private:
+    Clock::time_point m_Last, m_FrameStart, m_PresentStart;
+    unsigned long long m_Frames = 0;
+    FrameTimeHistogram m_FrameTimes;    /* start to start, what the user sees */
+    FrameTimeHistogram m_CpuTimes;      /* our work on cpu */
+    FrameTimeHistogram m_PresentTimes;  /* glfwSwapBuffers, waiting for vsync / gpu shows here */
+};
+
+
+static const bool s_BenchmarkMode = false;      /* true -> glfwSwapInterval(0), frames are not capped to monitor */
+
+
+
+int main(void)
+{
+    /* GLFW BASIC STUFF */
+        GLFWwindow* window;
+
+        /* Initialize the GLFW library */
+        if (!glfwInit())
+            return -1;
+
+
+        /* setting version 3.3 and core profile (i.e mordern opengl) */
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);    /* most drivers only send debug messages in debug context */
+#endif
+
+
+        /* Create a windowed mode window and its OpenGL context */
+        window = glfwCreateWindow(640, 480, "Hello World", NULL, NULL);
+        if (!window)
+        {
+            glfwTerminate();
+            return -1;
+
+        }
+        /* Make the window's context current */
+        glfwMakeContextCurrent(window);
+
+        glfwSwapInterval(s_BenchmarkMode ? 0 : 1);    /* 0 -> as fast as possible, 1 -> wait for monitor */
+
+    /*  END BASIC GLFW   */
+
+
+    /* Intitialize GLEW */
+        if (glewInit() != GLEW_OK) {
+            std::cout << "Error!" << std::endl;
+        }
+    /* END */
+
+    std::cout << glGetString(GL_VERSION) << std::endl;  /* prints the version of opengl using */
+    std::cout << "Mode: " << (s_BenchmarkMode ? "benchmark (uncapped)" : "vsync") << std::endl;
+
+    SetupGLErrorPolicy();
+
+
+
+    /* ------------- Generating Data to be used to display in the window ------------- */
+
+        /* ------------- Vertex Info (like position, color, texture, smoothness, normal,etc) ------------- */
+
+            // 4 positions of vertices of sqaure
+            float positions[] = {
+                -0.5f, -0.5f,    // 0
+                 0.5f, -0.5f,    // 1
+                 0.5f,  0.5f,    // 2
+                -0.5f,  0.5f     // 3
+            };
+
+            // Index data -----> position in which vertices is to be rendered to form a square
+            unsigned int indices[] = {
+                0, 1, 2,
+                2, 3, 0
+            };
+
+
+        /* ------------- VERTEX ARRAY OBJECT ------------- */
+            unsigned int vao;
+            GLCall(glGenVertexArrays(1, &vao));
+            GLCall(glBindVertexArray(vao));
+
+            unsigned int buffer;
+            GLCall(glGenBuffers(1, &buffer));
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, buffer));
+            GLCall(glBufferData(GL_ARRAY_BUFFER, 4 * 2 * sizeof(float), positions, GL_STATIC_DRAW));
+
+            GLCall(glEnableVertexAttribArray(0));
+            GLCall(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2, 0));
+
+            unsigned int ibo;       // index buffer object
+            GLCall(glGenBuffers(1, &ibo));
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo));
+            GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, 6 * sizeof(unsigned int), indices, GL_STATIC_DRAW));
+
+
+        /* ------------- SHADERS ------------- */
+
+            ShaderProgramSource shaderSource = ParseShader("res/shaders/Basic - UNFORMS.shader");
+            unsigned int shader = CreateShader(shaderSource.VertexSource, shaderSource.FragmentSource);
+            GLCall(glUseProgram(shader));
+
+            GLCall(int location = glGetUniformLocation(shader, "u_Color"));
+            ASSERT(location != -1);
+
+
+    /* ------------- END OF GENERATING DATA ------------- */
+
+
+    /* ----------- Unbound everything ----------- */
+
+            GLCall(glUseProgram(0));
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, 0));
+            GLCall(glBindVertexArray(0));
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
+
+
+
+    /* ----------- Animation Variable ----------- */
+    float r = 0.0f;
+    float speed = 3.0f;         /* color change per SECOND (old 0.05 per frame at 60 Hz) */
+
+    FrameClock clock;
+
+
+
+    /* WHILE Loop to keep the window active till window is closed */
+    while (!glfwWindowShouldClose(window))
+    {
+        float dt = clock.BeginFrame();
+
+        /* Render here */
+
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        GLCall(glUseProgram(shader));
+        GLCall(glUniform4f(location, r, 0.2f, 0.5f, 1.0f));
+        GLCall(glBindVertexArray(vao));
+
+        GLCall(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr));
+
+        if (r > 1.0f)
+            speed = -3.0f;
+        else if (r < 0.0f)
+            speed = 3.0f;
+
+        r += speed * dt;
+
+
+        /* Swap front and back buffers */
+        clock.BeginPresent();
+        glfwSwapBuffers(window);
+        clock.EndPresent();
+
+        /* Poll for and process events */
+        glfwPollEvents();
+    }
+
+    clock.PrintReport();
+
+    glDeleteBuffers(1, &buffer);
+    glDeleteBuffers(1, &ibo);
+    glDeleteVertexArrays(1, &vao);
+    glDeleteProgram(shader);
+
+    glfwTerminate();
+    return 0;
+}
+
+
+
+
+/* Makes and compile the shader by inputing the type and Source code */
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source) {
+
+    unsigned int id = glCreateShader(shaderType);   /* generate Shader and return id */
+    const char* src = source.c_str();               /* convert inputed string to char* */
+    GLCall(glShaderSource(id, 1, &src, nullptr));           /* attaching source code to the shader */
+    GLCall(glCompileShader(id));                            /* compile shader */
+
+    /* -------- ERROR HANDLING -------- */
+        int result;
+        GLCall(glGetShaderiv(id, GL_COMPILE_STATUS, &result));
+        if (result == GL_FALSE) {
+            int length;
+            GLCall(glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length));
+            std::vector<char> message(length + 1);      /* char Array of length 'length' (_malloca is only in MSVC) */
+            GLCall(glGetShaderInfoLog(id, length, &length, message.data()));
+
+            std::cout << "Failed To Compile " << (shaderType == GL_VERTEX_SHADER ? "vertex" : "fragment") << " shader" << std::endl;
+
+            std::cout << message.data() << std::endl;
+            GLCall(glDeleteShader(id));
+            return 0;
+        }
+
+    /* -------- END ERROR HANDLING -------- */
+
+    return id;
+
+}
+
+
+/* Creates a program Which contain vertex and fragment shader */
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader) {
+
+    GLCall(unsigned int program = glCreateProgram());                           /* generate program to store all shader and program to be run by GPU during while loop */
+    unsigned int vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
+    unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+
+    GLCall(glAttachShader(program, vs));                                        /* Attach shader to program to be run by GPU */
+    GLCall(glAttachShader(program, fs));
+    GLCall(glLinkProgram(program));
+    GLCall(glValidateProgram(program));
+    GLCall(glDeleteShader(vs));                                                 /* DELETING shader to save space as shader is already attached to program */
+    GLCall(glDeleteShader(fs));
+
+    return program;
+
+}
+
+
+/* Read file and output vertex and fragment shader source code */
+static ShaderProgramSource ParseShader(const std::string& filepath) {
+
+    std::ifstream stream(filepath);
+
+    enum class ShaderType {
+        NONE = -1, VERTEX = 0, FRAGMENT = 1
+    };
+
+    std::string line;
+    std::stringstream ss[2];
+    ShaderType type = ShaderType::NONE;
+    while (getline(stream, line)) {
+
+        if (line.find("#shader") != std::string::npos) {
+
+            if (line.find("vertex") != std::string::npos)
+                type = ShaderType::VERTEX;
+            else if (line.find("fragment") != std::string::npos)
+                type = ShaderType::FRAGMENT;
+
+        }
+        else {
+            ss[int(type)] << line << '\n';
+        }
+    }
+
+    return { ss[0].str(), ss[1].str() };
+}
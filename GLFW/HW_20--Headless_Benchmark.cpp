@@ -0,0 +1,607 @@
+/*
+
+Headless Benchmark Runner
+
+every HW sample is its own main() with a visible 640x480 window, so none of them can be run by a script on a CI machine
+this one runs the scenes of the old samples one after other, without showing a window, and prints the results as JSON
+
+---> triangle        (HW_2)  -> glDrawArrays, no index buffer
+---> indexed_square  (HW_5)  -> glDrawElements with index buffer
+---> uniform_square  (HW_7)  -> glUniform4f + glDrawElements
+---> multi_object    (HW_9)  -> bind program, buffer, attrib pointer, ibo again for every object
+---> vao             (HW_10) -> bind program + vao for every object
+
+every scene is drawn N times per frame (N objects) for a fixed number of frames with glfwSwapInterval(0)
+and we report frames/sec, draws/sec and cpu time per frame
+
+context is made with an invisible GLFW window (GLFW_VISIBLE false), this works with mesa llvmpipe (software GL, no GPU)
+for machines with no X server at all build with -DHEADLESS_EGL to make the context with EGL pbuffer instead
+(then GLEW must be built with EGL support -> GLEW_EGL)
+
+usage:   HW_20 [objects] [frames] [output.json]
+         LIBGL_ALWAYS_SOFTWARE=1 HW_20 1000 200 bench.json    -> force llvmpipe
+
+*/
+
+
+
+
+#include <GL\glew.h>
+
+#include <GLFW/glfw3.h>
+
+#ifdef HEADLESS_EGL
+#include <EGL/egl.h>
+#endif
+
+
+#include <iostream>
+#include <fstream>  // to read file
+#include <string>   // To use getline func
+#include <sstream>
+#include <vector>
+#include <chrono>
+#include <ctime>    // std::clock -> cpu time of process
+#include <cstdlib>  // atoi
+#include <math.h>
+
+
+/* ------------ ERROR CHECK POLICY ------------ */
+/*
+GL_CHECK_NONE   -> GLCall(x) is just x, nothing is checked (release)
+GL_CHECK_ASYNC  -> GLCall(x) is just x, driver reports errors later through glDebugMessageCallback (needs KHR_debug / GL 4.3)
+GL_CHECK_STRICT -> glGetError before and after every call, stops on the line with the error (old GLCall)
+
+default is NONE for release (NDEBUG) and STRICT for debug, or pass -DGL_CHECK_POLICY=1 to compiler to choose
+*/
+#define GL_CHECK_NONE   0
+#define GL_CHECK_ASYNC  1
+#define GL_CHECK_STRICT 2
+
+#ifndef GL_CHECK_POLICY
+    #ifdef NDEBUG
+        #define GL_CHECK_POLICY GL_CHECK_NONE
+    #else
+        #define GL_CHECK_POLICY GL_CHECK_STRICT
+    #endif
+#endif
+
+
+/* ------------ MACRO ------------ */
+
+/* __debugbreak is only in MSVC, on gcc / clang SIGTRAP does same thing (debugger stops there) */
+#if defined(_MSC_VER)
+    #define DEBUG_BREAK() __debugbreak()
+#elif defined(__GNUC__) || defined(__clang__)
+    #include <signal.h>
+    #define DEBUG_BREAK() raise(SIGTRAP)
+#else
+    #include <cstdlib>
+    #define DEBUG_BREAK() std::abort()
+#endif
+
+#define ASSERT(x) if (!(x)) DEBUG_BREAK();
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+    #define GLCall(x) GLCLearError();\
+        x;\
+        ASSERT(GlLogCall(#x, __FILE__, __LINE__))
+#else
+    #define GLCall(x) x
+#endif
+
+/*
+# before a fucntion pass it as a stringand __FILE__and __LINE__ are macros to get file loc and line of fucntion
+and since MACROS HAS TO BE IN SAME LINE we use \ before line ends to write macros in multiple lines
+*/
+
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+static void GLCLearError() {
+    while (glGetError() != GL_NO_ERROR);    // glGetError get error and we get all the error until there are no arror left
+}
+
+static bool GlLogCall(const char* function, const char* file, int line) {
+    bool ok = true;
+    while (GLenum error = glGetError()) {
+        std::cerr << "[OpenGl Error] (" << error << "): " << function << " " << file << ":" << line << std::endl;
+        ok = false;
+    }
+    return ok;
+}
+#endif
+
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+/* called by the driver (maybe from its own thread) when something is wrong */
+static void APIENTRY GlDebugCallback(GLenum /*source*/, GLenum type, GLuint id, GLenum severity, GLsizei /*length*/, const GLchar* message, const void* /*userParam*/) {
+
+    const char* level = severity == GL_DEBUG_SEVERITY_HIGH ? "HIGH" : severity == GL_DEBUG_SEVERITY_MEDIUM ? "MEDIUM" : "LOW";
+    std::cerr << "[OpenGl Debug] (" << level << (type == GL_DEBUG_TYPE_ERROR ? ", error" : "") << ", id " << id << "): " << message << std::endl;
+}
+#endif
+
+/* call once after glewInit, sets up whatever the chosen policy needs */
+static void SetupGLErrorPolicy() {
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+    if (GLEW_VERSION_4_3 || GLEW_KHR_debug) {
+        glEnable(GL_DEBUG_OUTPUT);
+        glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);     /* driver does not have to report inside the call, so no slow down */
+        glDebugMessageCallback(GlDebugCallback, nullptr);
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);  /* skip info messages */
+        std::cerr << "GL errors: async (debug callback)" << std::endl;
+    }
+    else {
+        std::cerr << "GL errors: async asked but KHR_debug is not there, errors are not checked" << std::endl;
+    }
+#elif GL_CHECK_POLICY == GL_CHECK_STRICT
+    std::cerr << "GL errors: strict (glGetError after every call)" << std::endl;
+#else
+    std::cerr << "GL errors: off" << std::endl;
+#endif
+}
+
+
+struct ShaderProgramSource {
+    std::string VertexSource;
+    std::string FragmentSource;
+};
+
+static ShaderProgramSource ParseShader(const std::string& filepath);
+
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader);
+
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source);
+
+
+
+/* ------------- HEADLESS CONTEXT ------------- */
+
+/* opengl context with nothing shown on screen */
+class HeadlessContext {
+public:
+    bool Create(int width, int height) {
+#ifdef HEADLESS_EGL
+        m_Display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+        if (m_Display == EGL_NO_DISPLAY || !eglInitialize(m_Display, nullptr, nullptr))
+            return false;
+
+        EGLint configAttribs[] = {
+            EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+            EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8,
+            EGL_NONE
+        };
+        EGLConfig config;
+        EGLint configCount = 0;
+        if (!eglChooseConfig(m_Display, configAttribs, &config, 1, &configCount) || configCount == 0)
+            return false;
+
+        /* pbuffer -> offscreen surface, no window needed */
+        EGLint surfaceAttribs[] = { EGL_WIDTH, width, EGL_HEIGHT, height, EGL_NONE };
+        m_Surface = eglCreatePbufferSurface(m_Display, config, surfaceAttribs);
+        if (m_Surface == EGL_NO_SURFACE)
+            return false;
+
+        eglBindAPI(EGL_OPENGL_API);
+        EGLint contextAttribs[] = {
+            EGL_CONTEXT_MAJOR_VERSION, 3,
+            EGL_CONTEXT_MINOR_VERSION, 3,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+            EGL_NONE
+        };
+        m_Context = eglCreateContext(m_Display, config, EGL_NO_CONTEXT, contextAttribs);
+        if (m_Context == EGL_NO_CONTEXT)
+            return false;
+
+        return eglMakeCurrent(m_Display, m_Surface, m_Surface, m_Context) == EGL_TRUE;
+#else
+        if (!glfwInit())
+            return false;
+
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);       /* window exists but is never shown */
+
+        m_Window = glfwCreateWindow(width, height, "Headless Benchmark", NULL, NULL);
+        if (!m_Window)
+            return false;
+
+        glfwMakeContextCurrent(m_Window);
+        glfwSwapInterval(0);        /* never wait for monitor */
+        return true;
+#endif
+    }
+
+    void Swap() {
+#ifdef HEADLESS_EGL
+        eglSwapBuffers(m_Display, m_Surface);
+#else
+        glfwSwapBuffers(m_Window);
+#endif
+    }
+
+    void Destroy() {
+#ifdef HEADLESS_EGL
+        if (m_Display != EGL_NO_DISPLAY) {
+            eglMakeCurrent(m_Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+            if (m_Context != EGL_NO_CONTEXT) eglDestroyContext(m_Display, m_Context);
+            if (m_Surface != EGL_NO_SURFACE) eglDestroySurface(m_Display, m_Surface);
+            eglTerminate(m_Display);
+        }
+#else
+        glfwTerminate();
+#endif
+    }
+
+private:
+#ifdef HEADLESS_EGL
+    EGLDisplay m_Display = EGL_NO_DISPLAY;
+    EGLSurface m_Surface = EGL_NO_SURFACE;
+    EGLContext m_Context = EGL_NO_CONTEXT;
+#else
+    GLFWwindow* m_Window = nullptr;
+#endif
+};
+
+
+/* ------------- SCENES ------------- */
+
+/* gl objects used by all scenes, made once */
+struct SceneResources {
+    unsigned int triangleVao, triangleBuffer;
+    unsigned int squareVao, squareBuffer, squareIbo;
+    unsigned int basicShader;           /* fixed color (Basic.shader) */
+    unsigned int uniformShader;         /* u_Color (Basic - UNFORMS.shader) */
+    int location;
+};
+
+static void DrawTriangle(const SceneResources& res, unsigned int objects) {
+    GLCall(glUseProgram(res.basicShader));
+    GLCall(glBindVertexArray(res.triangleVao));
+    for (unsigned int i = 0; i < objects; i++) {
+        GLCall(glDrawArrays(GL_TRIANGLES, 0, 3));
+    }
+}
+
+static void DrawIndexedSquare(const SceneResources& res, unsigned int objects) {
+    GLCall(glUseProgram(res.basicShader));
+    GLCall(glBindVertexArray(res.squareVao));
+    for (unsigned int i = 0; i < objects; i++) {
+        GLCall(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr));
+    }
+}
+
+static void DrawUniformSquare(const SceneResources& res, unsigned int objects) {
+    GLCall(glUseProgram(res.uniformShader));
+    GLCall(glBindVertexArray(res.squareVao));
+    for (unsigned int i = 0; i < objects; i++) {
+        GLCall(glUniform4f(res.location, (float)i / objects, 0.2f, 0.5f, 1.0f));
+        GLCall(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr));
+    }
+}
+
+/* HW_9 -> everything bound again for every object (vao is bound once only because core profile needs one) */
+static void DrawMultiObject(const SceneResources& res, unsigned int objects) {
+    GLCall(glBindVertexArray(res.squareVao));
+    for (unsigned int i = 0; i < objects; i++) {
+        GLCall(glUseProgram(res.uniformShader));
+        GLCall(glUniform4f(res.location, (float)i / objects, 0.2f, 0.5f, 1.0f));
+        GLCall(glBindBuffer(GL_ARRAY_BUFFER, res.squareBuffer));
+        GLCall(glEnableVertexAttribArray(0));
+        GLCall(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2, 0));
+        GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, res.squareIbo));
+        GLCall(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr));
+    }
+}
+
+/* HW_10 -> program + vao for every object */
+static void DrawVao(const SceneResources& res, unsigned int objects) {
+    for (unsigned int i = 0; i < objects; i++) {
+        GLCall(glUseProgram(res.uniformShader));
+        GLCall(glUniform4f(res.location, (float)i / objects, 0.2f, 0.5f, 1.0f));
+        GLCall(glBindVertexArray(res.squareVao));
+        GLCall(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr));
+    }
+}
+
+struct Scene {
+    const char* name;
+    void (*draw)(const SceneResources&, unsigned int objects);
+};
+
+struct SceneResult {
+    const char* name;
+    double fps;
+    double drawsPerSec;
+    double cpuMsPerFrame;
+    double wallMsPerFrame;
+};
+
+
+/* draws one scene for some frames and measures it */
+static SceneResult RunScene(HeadlessContext& context, const SceneResources& res, const Scene& scene, unsigned int objects, unsigned int frames) {
+
+    /* few frames first so driver has compiled / uploaded everything */
+    for (int i = 0; i < 5; i++) {
+        glClear(GL_COLOR_BUFFER_BIT);
+        scene.draw(res, objects);
+        context.Swap();
+    }
+    glFinish();
+
+    std::clock_t cpuStart = std::clock();
+    auto wallStart = std::chrono::steady_clock::now();
+
+    for (unsigned int i = 0; i < frames; i++) {
+        glClear(GL_COLOR_BUFFER_BIT);
+        scene.draw(res, objects);
+        context.Swap();
+    }
+    glFinish();     /* wait for last frame, on llvmpipe gpu work is also cpu work */
+
+    double wallSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    double cpuSec = (double)(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+
+    SceneResult result;
+    result.name = scene.name;
+    result.fps = frames / wallSec;
+    result.drawsPerSec = (double)frames * objects / wallSec;
+    result.cpuMsPerFrame = cpuSec * 1000.0 / frames;
+    result.wallMsPerFrame = wallSec * 1000.0 / frames;
+    return result;
+}
+
+
+/* driver strings can have " or \ in them, json needs them escaped (and no raw control characters) */
+static std::string JsonEscape(const std::string& text) {
+    static const char hex[] = "0123456789abcdef";
+    std::string out;
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        }
+        else if ((unsigned char)c < 0x20) {
+            out += "\\u00";
+            out += hex[(unsigned char)c >> 4];
+            out += hex[c & 0xF];
+        }
+        else {
+            out += c;
+        }
+    }
+    return out;
+}
+
+static void WriteJson(std::ostream& out, const std::string& renderer, const std::string& version, unsigned int objects, unsigned int frames, const std::vector<SceneResult>& results) {
+
+    out << "{\n";
+    out << "  \"renderer\": \"" << JsonEscape(renderer) << "\",\n";
+    out << "  \"version\": \"" << JsonEscape(version) << "\",\n";
+    out << "  \"objects\": " << objects << ",\n";
+    out << "  \"frames\": " << frames << ",\n";
+    out << "  \"scenes\": [\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const SceneResult& r = results[i];
+        out << "    { \"name\": \"" << JsonEscape(r.name) << "\", \"fps\": " << r.fps << ", \"draws_per_sec\": " << r.drawsPerSec
+            << ", \"cpu_ms_per_frame\": " << r.cpuMsPerFrame << ", \"wall_ms_per_frame\": " << r.wallMsPerFrame << " }"
+            << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n";
+    out << "}\n";
+}
+
+
+
+int main(int argc, char** argv)
+{
+    int objectsArg = argc > 1 ? atoi(argv[1]) : 1000;
+    int framesArg = argc > 2 ? atoi(argv[2]) : 200;
+    std::string outputPath = argc > 3 ? argv[3] : "";
+
+    /* 0 (or not a number, atoi gives 0) would divide by 0 in RunScene and write nan / inf, which is not json */
+    if (objectsArg <= 0 || framesArg <= 0) {
+        std::cerr << "usage: HW_20 [objects] [frames] [output.json]   (objects and frames are numbers > 0)" << std::endl;
+        return 1;
+    }
+    unsigned int objects = (unsigned int)objectsArg;
+    unsigned int frames = (unsigned int)framesArg;
+
+    /* CONTEXT (no window shown) */
+        HeadlessContext context;
+        if (!context.Create(640, 480)) {
+            std::cerr << "Could not create headless OpenGL context" << std::endl;
+            context.Destroy();
+            return -1;
+        }
+
+    /* Intitialize GLEW */
+        glewExperimental = GL_TRUE;
+        if (glewInit() != GLEW_OK) {
+            std::cerr << "Error!" << std::endl;
+        }
+    /* END */
+
+    /* std::cerr for info so std::cout has only the json */
+    std::string renderer = (const char*)glGetString(GL_RENDERER);
+    std::string version = (const char*)glGetString(GL_VERSION);
+    std::cerr << version << " / " << renderer << std::endl;
+
+    SetupGLErrorPolicy();
+
+
+
+    /* ------------- Generating Data used by all scenes ------------- */
+
+        SceneResources res;
+
+        float trianglePositions[] = {
+            -0.5f, -0.5f,
+             0.0f,  0.5f,
+             0.5f, -0.5f
+        };
+
+        float squarePositions[] = {
+            -0.5f, -0.5f,    // 0
+             0.5f, -0.5f,    // 1
+             0.5f,  0.5f,    // 2
+            -0.5f,  0.5f     // 3
+        };
+
+        unsigned int indices[] = {
+            0, 1, 2,
+            2, 3, 0
+        };
+
+        GLCall(glGenVertexArrays(1, &res.triangleVao));
+        GLCall(glBindVertexArray(res.triangleVao));
+        GLCall(glGenBuffers(1, &res.triangleBuffer));
+        GLCall(glBindBuffer(GL_ARRAY_BUFFER, res.triangleBuffer));
+        GLCall(glBufferData(GL_ARRAY_BUFFER, 3 * 2 * sizeof(float), trianglePositions, GL_STATIC_DRAW));
+        GLCall(glEnableVertexAttribArray(0));
+        GLCall(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2, 0));
+
+        GLCall(glGenVertexArrays(1, &res.squareVao));
+        GLCall(glBindVertexArray(res.squareVao));
+        GLCall(glGenBuffers(1, &res.squareBuffer));
+        GLCall(glBindBuffer(GL_ARRAY_BUFFER, res.squareBuffer));
+        GLCall(glBufferData(GL_ARRAY_BUFFER, 4 * 2 * sizeof(float), squarePositions, GL_STATIC_DRAW));
+        GLCall(glEnableVertexAttribArray(0));
+        GLCall(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2, 0));
+        GLCall(glGenBuffers(1, &res.squareIbo));
+        GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, res.squareIbo));
+        GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, 6 * sizeof(unsigned int), indices, GL_STATIC_DRAW));
+
+        ShaderProgramSource basicSource = ParseShader("res/shaders/Basic.shader");
+        res.basicShader = CreateShader(basicSource.VertexSource, basicSource.FragmentSource);
+
+        ShaderProgramSource uniformSource = ParseShader("res/shaders/Basic - UNFORMS.shader");
+        res.uniformShader = CreateShader(uniformSource.VertexSource, uniformSource.FragmentSource);
+
+        GLCall(res.location = glGetUniformLocation(res.uniformShader, "u_Color"));
+        ASSERT(res.location != -1);
+
+    /* ------------- END OF GENERATING DATA ------------- */
+
+
+
+    /* ------------- RUN ALL SCENES ------------- */
+
+        Scene scenes[] = {
+            { "triangle",       DrawTriangle },
+            { "indexed_square", DrawIndexedSquare },
+            { "uniform_square", DrawUniformSquare },
+            { "multi_object",   DrawMultiObject },
+            { "vao",            DrawVao },
+        };
+
+        std::vector<SceneResult> results;
+        for (const Scene& scene : scenes) {
+            std::cerr << "running " << scene.name << " (" << objects << " objects, " << frames << " frames)" << std::endl;
+            results.push_back(RunScene(context, res, scene, objects, frames));
+        }
+
+        WriteJson(std::cout, renderer, version, objects, frames, results);
+        if (!outputPath.empty()) {
+            std::ofstream file(outputPath);
+            WriteJson(file, renderer, version, objects, frames, results);
+        }
+
+
+    glDeleteBuffers(1, &res.triangleBuffer);
+    glDeleteBuffers(1, &res.squareBuffer);
+    glDeleteBuffers(1, &res.squareIbo);
+    glDeleteVertexArrays(1, &res.triangleVao);
+    glDeleteVertexArrays(1, &res.squareVao);
+    glDeleteProgram(res.basicShader);
+    glDeleteProgram(res.uniformShader);
+
+    context.Destroy();
+    return 0;
+}
+
+
+
+
+/* Makes and compile the shader by inputing the type and Source code */
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source) {
+
+    unsigned int id = glCreateShader(shaderType);   /* generate Shader and return id */
+    const char* src = source.c_str();               /* convert inputed string to char* */
+    GLCall(glShaderSource(id, 1, &src, nullptr));           /* attaching source code to the shader */
+    GLCall(glCompileShader(id));                            /* compile shader */
+
+    /* -------- ERROR HANDLING -------- */
+        int result;
+        GLCall(glGetShaderiv(id, GL_COMPILE_STATUS, &result));
+        if (result == GL_FALSE) {
+            int length;
+            GLCall(glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length));
+            std::vector<char> message(length + 1);      /* char Array of length 'length' (_malloca is only in MSVC) */
+            GLCall(glGetShaderInfoLog(id, length, &length, message.data()));
+
+            std::cerr << "Failed To Compile " << (shaderType == GL_VERTEX_SHADER ? "vertex" : "fragment") << " shader" << std::endl;
+
+            std::cerr << message.data() << std::endl;
+            GLCall(glDeleteShader(id));
+            return 0;
+        }
+
+    /* -------- END ERROR HANDLING -------- */
+
+    return id;
+
+}
+
+
+/* Creates a program Which contain vertex and fragment shader */
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader) {
+
+    GLCall(unsigned int program = glCreateProgram());                           /* generate program to store all shader and program to be run by GPU during while loop */
+    unsigned int vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
+    unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+
+    GLCall(glAttachShader(program, vs));                                        /* Attach shader to program to be run by GPU */
+    GLCall(glAttachShader(program, fs));
+    GLCall(glLinkProgram(program));
+    GLCall(glValidateProgram(program));
+    GLCall(glDeleteShader(vs));                                                 /* DELETING shader to save space as shader is already attached to program */
+    GLCall(glDeleteShader(fs));
+
+    return program;
+
+}
+
+
+/* Read file and output vertex and fragment shader source code */
+static ShaderProgramSource ParseShader(const std::string& filepath) {
+
+    std::ifstream stream(filepath);
+
+    enum class ShaderType {
+        NONE = -1, VERTEX = 0, FRAGMENT = 1
+    };
+
+    std::string line;
+    std::stringstream ss[2];
+    ShaderType type = ShaderType::NONE;
+    while (getline(stream, line)) {
+
+        if (line.find("#shader") != std::string::npos) {
+
+            if (line.find("vertex") != std::string::npos)
+                type = ShaderType::VERTEX;
+            else if (line.find("fragment") != std::string::npos)
+                type = ShaderType::FRAGMENT;
+
+        }
+        else {
+            ss[int(type)] << line << '\n';
+        }
+    }
+
+    return { ss[0].str(), ss[1].str() };
+}
@@ -0,0 +1,631 @@
+/*
+
+Program Binary Cache
+
+CreateShader compiles vertex and fragment shader and links them every time the app starts
+with hundreds of programs this takes most of the startup time
+
+after linking, the driver can give us the finished program as binary (glGetProgramBinary)
+we save it in a file and on next start load it with glProgramBinary, so no compile and no link
+
+---> file name is a hash of vertex source + fragment source + GL_VENDOR + GL_RENDERER + GL_VERSION
+     so if shader or driver changes we get a different name (miss) and build it again
+---> GL_PROGRAM_BINARY_RETRIEVABLE_HINT has to be set before linking, or some drivers do not keep the binary
+---> driver can still refuse a binary (GL error or GL_LINK_STATUS false after glProgramBinary), then we just build again
+---> driver string is also saved in the cache folder, if driver changes all old files are deleted (they can never hit again)
+
+needs GL 4.1 or GL_ARB_get_program_binary and at least one binary format (GL_NUM_PROGRAM_BINARY_FORMATS)
+otherwise the cache just compiles like before
+
+at exit hit rate and the startup time saved are printed (compile time of every program is kept in its file)
+run it 2 times, first run is all misses and second run is all hits
+
+*/
+
+
+
+
+#include <GL\glew.h>
+
+#include <GLFW/glfw3.h>
+
+
+#include <iostream>
+#include <fstream>  // to read file
+#include <string>   // To use getline func
+#include <sstream>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>   // snprintf
+#include <filesystem>
+#include <math.h>
+
+
+/* ------------ ERROR CHECK POLICY ------------ */
+/*
+GL_CHECK_NONE   -> GLCall(x) is just x, nothing is checked (release)
+GL_CHECK_ASYNC  -> GLCall(x) is just x, driver reports errors later through glDebugMessageCallback (needs KHR_debug / GL 4.3)
+GL_CHECK_STRICT -> glGetError before and after every call, stops on the line with the error (old GLCall)
+
+default is NONE for release (NDEBUG) and STRICT for debug, or pass -DGL_CHECK_POLICY=1 to compiler to choose
+*/
+#define GL_CHECK_NONE   0
+#define GL_CHECK_ASYNC  1
+#define GL_CHECK_STRICT 2
+
+#ifndef GL_CHECK_POLICY
+    #ifdef NDEBUG
+        #define GL_CHECK_POLICY GL_CHECK_NONE
+    #else
+        #define GL_CHECK_POLICY GL_CHECK_STRICT
+    #endif
+#endif
+
+
+/* ------------ MACRO ------------ */
+
+/* __debugbreak is only in MSVC, on gcc / clang SIGTRAP does same thing (debugger stops there) */
+#if defined(_MSC_VER)
+    #define DEBUG_BREAK() __debugbreak()
+#elif defined(__GNUC__) || defined(__clang__)
+    #include <signal.h>
+    #define DEBUG_BREAK() raise(SIGTRAP)
+#else
+    #include <cstdlib>
+    #define DEBUG_BREAK() std::abort()
+#endif
+
+#define ASSERT(x) if (!(x)) DEBUG_BREAK();
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+    #define GLCall(x) GLCLearError();\
+        x;\
+        ASSERT(GlLogCall(#x, __FILE__, __LINE__))
+#else
+    #define GLCall(x) x
+#endif
+
+/*
+# before a fucntion pass it as a stringand __FILE__and __LINE__ are macros to get file loc and line of fucntion
+and since MACROS HAS TO BE IN SAME LINE we use \ before line ends to write macros in multiple lines
+*/
+
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+static void GLCLearError() {
+    while (glGetError() != GL_NO_ERROR);    // glGetError get error and we get all the error until there are no arror left
+}
+
+static bool GlLogCall(const char* function, const char* file, int line) {
+    bool ok = true;
+    while (GLenum error = glGetError()) {
+        std::cout << "[OpenGl Error] (" << error << "): " << function << " " << file << ":" << line << std::endl;
+        ok = false;
+    }
+    return ok;
+}
+#endif
+
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+/* called by the driver (maybe from its own thread) when something is wrong */
+static void APIENTRY GlDebugCallback(GLenum /*source*/, GLenum type, GLuint id, GLenum severity, GLsizei /*length*/, const GLchar* message, const void* /*userParam*/) {
+
+    const char* level = severity == GL_DEBUG_SEVERITY_HIGH ? "HIGH" : severity == GL_DEBUG_SEVERITY_MEDIUM ? "MEDIUM" : "LOW";
+    std::cout << "[OpenGl Debug] (" << level << (type == GL_DEBUG_TYPE_ERROR ? ", error" : "") << ", id " << id << "): " << message << std::endl;
+}
+#endif
+
+/* call once after glewInit, sets up whatever the chosen policy needs */
+static void SetupGLErrorPolicy() {
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+    if (GLEW_VERSION_4_3 || GLEW_KHR_debug) {
+        glEnable(GL_DEBUG_OUTPUT);
+        glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);     /* driver does not have to report inside the call, so no slow down */
+        glDebugMessageCallback(GlDebugCallback, nullptr);
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);  /* skip info messages */
+        std::cout << "GL errors: async (debug callback)" << std::endl;
+    }
+    else {
+        std::cout << "GL errors: async asked but KHR_debug is not there, errors are not checked" << std::endl;
+    }
+#elif GL_CHECK_POLICY == GL_CHECK_STRICT
+    std::cout << "GL errors: strict (glGetError after every call)" << std::endl;
+#else
+    std::cout << "GL errors: off" << std::endl;
+#endif
+}
+
+
+struct ShaderProgramSource {
+    std::string VertexSource;
+    std::string FragmentSource;
+};
+
+static ShaderProgramSource ParseShader(const std::string& filepath);
+
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader);
+
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source);
+
+
+
+/* ------------- HASH ------------- */
+
+/* FNV-1a 64 bit, simple and good enough to name files */
+static uint64_t HashBytes(const void* data, size_t size, uint64_t hash = 14695981039346656037ull) {
+    const unsigned char* bytes = (const unsigned char*)data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+static uint64_t HashString(const std::string& s, uint64_t hash = 14695981039346656037ull) {
+    hash = HashBytes(s.data(), s.size(), hash);
+    return HashBytes("\0", 1, hash);        /* separator so "ab"+"c" and "a"+"bc" are different */
+}
+
+
+/* ------------- PROGRAM CACHE ------------- */
+
+class ProgramCache {
+public:
+    ProgramCache(const std::string& directory) : m_Directory(directory) {
+
+        GLint formats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+        m_Supported = formats > 0;
+        if (!m_Supported) {
+            std::cout << "[ProgramCache] driver has no program binary formats, cache is off" << std::endl;
+            return;
+        }
+
+        m_Driver = std::string((const char*)glGetString(GL_VENDOR)) + " | " + (const char*)glGetString(GL_RENDERER) + " | " + (const char*)glGetString(GL_VERSION);
+        m_DriverHash = HashString(m_Driver);
+
+        std::filesystem::create_directories(m_Directory);
+        InvalidateIfDriverChanged();
+    }
+
+    /* same as CreateShader, but loads the program from cache if it was built before */
+    unsigned int CreateProgram(const ShaderProgramSource& source) {
+
+        auto start = std::chrono::high_resolution_clock::now();
+
+        if (!m_Supported)
+            return CreateShader(source.VertexSource, source.FragmentSource);
+
+        uint64_t key = HashString(source.FragmentSource, HashString(source.VertexSource, m_DriverHash));
+        std::string path = PathFor(key);
+
+        /* ------------- HIT -> glProgramBinary ------------- */
+        double savedCompileMs = 0.0;
+        unsigned int program = LoadBinary(path, savedCompileMs);
+        if (program) {
+            double loadMs = Elapsed(start);
+            m_Hits++;
+            m_LoadMs += loadMs;
+            m_SavedMs += savedCompileMs - loadMs;
+            return program;
+        }
+
+        /* ------------- MISS -> compile, link and store ------------- */
+        program = glCreateProgram();
+        unsigned int vs = CompileShader(GL_VERTEX_SHADER, source.VertexSource);
+        unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, source.FragmentSource);
+
+        GLCall(glAttachShader(program, vs));
+        GLCall(glAttachShader(program, fs));
+        GLCall(glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE));    /* before link! */
+        GLCall(glLinkProgram(program));
+        GLCall(glValidateProgram(program));
+        GLCall(glDetachShader(program, vs));
+        GLCall(glDetachShader(program, fs));
+        GLCall(glDeleteShader(vs));
+        GLCall(glDeleteShader(fs));
+
+        double compileMs = Elapsed(start);
+        m_Misses++;
+        m_CompileMs += compileMs;
+
+        int linked = GL_FALSE;
+        GLCall(glGetProgramiv(program, GL_LINK_STATUS, &linked));
+        if (linked == GL_TRUE)
+            StoreBinary(path, program, compileMs);      /* broken programs are not cached */
+
+        return program;
+    }
+
+    void PrintStats() const {
+        unsigned int total = m_Hits + m_Misses;
+        std::cout << "[ProgramCache] " << m_Hits << " hits, " << m_Misses << " misses (" << (total ? 100.0 * m_Hits / total : 0.0) << "% hit rate, " << m_Rejected << " rejected by driver)" << std::endl;
+        std::cout << "  compile+link on miss : " << m_CompileMs << " ms" << std::endl;
+        std::cout << "  load on hit          : " << m_LoadMs << " ms" << std::endl;
+        std::cout << "  startup time saved   : " << m_SavedMs << " ms" << std::endl;
+    }
+
+private:
+    /* at start of every cache file */
+    struct FileHeader {
+        uint32_t magic;             /* 'PBIN' */
+        uint32_t version;
+        uint64_t driverHash;
+        uint32_t binaryFormat;      /* from glGetProgramBinary, needed by glProgramBinary */
+        uint32_t binaryLength;
+        double compileMs;           /* how long building it took, to know how much a hit saves */
+    };
+    static const uint32_t Magic = 0x4E494250;
+    static const uint32_t Version = 1;
+
+    std::string PathFor(uint64_t key) const {
+        char name[32];
+        snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)key);
+        return m_Directory + "/" + name;
+    }
+
+    unsigned int LoadBinary(const std::string& path, double& compileMs) {
+
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            return 0;
+
+        FileHeader header;
+        if (!file.read((char*)&header, sizeof(header)) || header.magic != Magic || header.version != Version || header.driverHash != m_DriverHash)
+            return 0;
+
+        /* broken / cut file could ask for gigabytes, binary can not be bigger than what is left of the file */
+        std::error_code ec;
+        uintmax_t fileSize = std::filesystem::file_size(path, ec);
+        if (ec || header.binaryLength == 0 || header.binaryLength > fileSize - sizeof(header))
+            return 0;
+
+        std::vector<char> binary(header.binaryLength);
+        if (!file.read(binary.data(), binary.size()))
+            return 0;
+
+        GLCall(unsigned int program = glCreateProgram());
+
+        /* errors of earlier calls must not reject this binary (STRICT still reports them) */
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+        ASSERT(GlLogCall("(before glProgramBinary)", __FILE__, __LINE__));
+#else
+        while (glGetError() != GL_NO_ERROR);
+#endif
+
+        /* no GLCall: a format the driver does not list anymore or a broken file gives a GL error here, that is a miss and not a bug */
+        glProgramBinary(program, header.binaryFormat, binary.data(), (GLsizei)binary.size());
+        bool refused = glGetError() != GL_NO_ERROR;
+
+        int linked = GL_FALSE;
+        if (!refused) {
+            GLCall(glGetProgramiv(program, GL_LINK_STATUS, &linked));
+        }
+        if (refused || linked != GL_TRUE) {
+            /* driver does not like it anymore (driver update with same version string), build again */
+            GLCall(glDeleteProgram(program));
+            m_Rejected++;
+            return 0;
+        }
+
+        compileMs = header.compileMs;
+        return program;
+    }
+
+    void StoreBinary(const std::string& path, unsigned int program, double compileMs) {
+
+        GLint length = 0;
+        GLCall(glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length));
+        if (length <= 0)
+            return;
+
+        std::vector<char> binary(length);
+        GLenum format = 0;
+        GLCall(glGetProgramBinary(program, length, &length, &format, binary.data()));
+
+        FileHeader header = { Magic, Version, m_DriverHash, format, (uint32_t)length, compileMs };
+
+        /* write in a temp file and rename, so a crash never leaves half a file with the right name */
+        std::string temp = path + ".tmp";
+        {
+            std::ofstream file(temp, std::ios::binary);
+            file.write((const char*)&header, sizeof(header));
+            file.write(binary.data(), length);
+            if (!file)
+                return;
+        }
+        std::error_code ec;
+        std::filesystem::rename(temp, path, ec);
+    }
+
+    /* driver.txt has the driver string of the files in the folder, if it is different delete them all */
+    void InvalidateIfDriverChanged() {
+
+        std::string driverFile = m_Directory + "/driver.txt";
+        std::string cachedDriver;
+        {
+            std::ifstream in(driverFile);
+            std::getline(in, cachedDriver);
+        }
+        if (cachedDriver == m_Driver)
+            return;
+
+        unsigned int removed = 0;
+        for (const auto& entry : std::filesystem::directory_iterator(m_Directory)) {
+            if (entry.path().extension() == ".bin") {
+                std::error_code ec;
+                if (std::filesystem::remove(entry.path(), ec))
+                    removed++;
+            }
+        }
+        if (!cachedDriver.empty())
+            std::cout << "[ProgramCache] driver changed, " << removed << " old programs removed" << std::endl;
+
+        std::ofstream out(driverFile);
+        out << m_Driver << std::endl;
+    }
+
+    static double Elapsed(std::chrono::high_resolution_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+    }
+
+    std::string m_Directory;
+    std::string m_Driver;
+    uint64_t m_DriverHash = 0;
+    bool m_Supported = false;
+
+    unsigned int m_Hits = 0, m_Misses = 0, m_Rejected = 0;
+    double m_CompileMs = 0.0, m_LoadMs = 0.0, m_SavedMs = 0.0;
+};
+
+
+
+int main(void)
+{
+    /* GLFW BASIC STUFF */
+        GLFWwindow* window;
+
+        /* Initialize the GLFW library */
+        if (!glfwInit())
+            return -1;
+
+
+        /* setting version 3.3 and core profile (i.e mordern opengl) */
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);    /* most drivers only send debug messages in debug context */
+#endif
+
+
+        /* Create a windowed mode window and its OpenGL context */
+        window = glfwCreateWindow(640, 480, "Hello World", NULL, NULL);
+        if (!window)
+        {
+            glfwTerminate();
+            return -1;
+
+        }
+        /* Make the window's context current */
+        glfwMakeContextCurrent(window);
+
+        glfwSwapInterval(1);    /* controls FPS or intervel between buffer(frames) */
+
+    /*  END BASIC GLFW   */
+
+
+    /* Intitialize GLEW */
+        if (glewInit() != GLEW_OK) {
+            std::cout << "Error!" << std::endl;
+        }
+    /* END */
+
+    std::cout << glGetString(GL_VERSION) << std::endl;  /* prints the version of opengl using */
+
+    SetupGLErrorPolicy();
+
+
+
+    /* ------------- Generating Data to be used to display in the window ------------- */
+
+        /* ------------- Vertex Info (like position, color, texture, smoothness, normal,etc) ------------- */
+
+            // 4 positions of vertices of sqaure
+            float positions[] = {
+                -0.5f, -0.5f,    // 0
+                 0.5f, -0.5f,    // 1
+                 0.5f,  0.5f,    // 2
+                -0.5f,  0.5f     // 3
+            };
+
+            // Index data -----> position in which vertices is to be rendered to form a square
+            unsigned int indices[] = {
+                0, 1, 2,
+                2, 3, 0
+            };
+
+
+        /* ------------- VERTEX ARRAY OBJECT ------------- */
+            unsigned int vao;
+            GLCall(glGenVertexArrays(1, &vao));
+            GLCall(glBindVertexArray(vao));
+
+            unsigned int buffer;
+            GLCall(glGenBuffers(1, &buffer));
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, buffer));
+            GLCall(glBufferData(GL_ARRAY_BUFFER, 4 * 2 * sizeof(float), positions, GL_STATIC_DRAW));
+
+            GLCall(glEnableVertexAttribArray(0));
+            GLCall(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2, 0));
+
+            unsigned int ibo;       // index buffer object
+            GLCall(glGenBuffers(1, &ibo));
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo));
+            GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, 6 * sizeof(unsigned int), indices, GL_STATIC_DRAW));
+
+
+        /* ------------- SHADERS (through cache) ------------- */
+
+            ProgramCache cache("shader_cache");
+
+            ShaderProgramSource shaderSource = ParseShader("res/shaders/Basic - UNFORMS.shader");
+            unsigned int shader = cache.CreateProgram(shaderSource);
+
+            /* a real app has hundreds of programs, here we make 100 variants of the same shader to see the difference */
+            std::vector<unsigned int> variants;
+            for (int i = 0; i < 100; i++) {
+                ShaderProgramSource variant = shaderSource;
+                variant.FragmentSource += "// variant " + std::to_string(i) + "\n";
+                variants.push_back(cache.CreateProgram(variant));
+            }
+
+            cache.PrintStats();
+
+            GLCall(glUseProgram(shader));
+            GLCall(int location = glGetUniformLocation(shader, "u_Color"));
+            ASSERT(location != -1);
+
+
+    /* ------------- END OF GENERATING DATA ------------- */
+
+
+    /* ----------- Unbound everything ----------- */
+
+            GLCall(glUseProgram(0));
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, 0));
+            GLCall(glBindVertexArray(0));
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
+
+
+
+    /* ----------- Animation Variable ----------- */
+    float r = 0.0f;
+    float increment = 0.05f;
+
+
+
+    /* WHILE Loop to keep the window active till window is closed */
+    while (!glfwWindowShouldClose(window))
+    {
+        /* Render here */
+
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        GLCall(glUseProgram(shader));
+        GLCall(glUniform4f(location, r, 0.2f, 0.5f, 1.0f));
+        GLCall(glBindVertexArray(vao));
+
+        GLCall(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr));
+
+        if (r > 1.0f)
+            increment = -0.05f;
+        else if (r < 0.0f)
+            increment = 0.05f;
+
+        r += increment;
+
+
+        /* Swap front and back buffers */
+        glfwSwapBuffers(window);
+
+        /* Poll for and process events */
+        glfwPollEvents();
+    }
+
+    for (unsigned int program : variants)
+        glDeleteProgram(program);
+    glDeleteBuffers(1, &buffer);
+    glDeleteBuffers(1, &ibo);
+    glDeleteVertexArrays(1, &vao);
+    glDeleteProgram(shader);
+
+    glfwTerminate();
+    return 0;
+}
+
+
+
+
+/* Makes and compile the shader by inputing the type and Source code */
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source) {
+
+    unsigned int id = glCreateShader(shaderType);   /* generate Shader and return id */
+    const char* src = source.c_str();               /* convert inputed string to char* */
+    GLCall(glShaderSource(id, 1, &src, nullptr));           /* attaching source code to the shader */
+    GLCall(glCompileShader(id));                            /* compile shader */
+
+    /* -------- ERROR HANDLING -------- */
+        int result;
+        GLCall(glGetShaderiv(id, GL_COMPILE_STATUS, &result));
+        if (result == GL_FALSE) {
+            int length;
+            GLCall(glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length));
+            std::vector<char> message(length + 1);      /* char Array of length 'length' (_malloca is only in MSVC) */
+            GLCall(glGetShaderInfoLog(id, length, &length, message.data()));
+
+            std::cout << "Failed To Compile " << (shaderType == GL_VERTEX_SHADER ? "vertex" : "fragment") << " shader" << std::endl;
+
+            std::cout << message.data() << std::endl;
+            GLCall(glDeleteShader(id));
+            return 0;
+        }
+
+    /* -------- END ERROR HANDLING -------- */
+
+    return id;
+
+}
+
+
+/* Creates a program Which contain vertex and fragment shader */
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader) {
+
+    GLCall(unsigned int program = glCreateProgram());                           /* generate program to store all shader and program to be run by GPU during while loop */
+    unsigned int vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
+    unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+
+    GLCall(glAttachShader(program, vs));                                        /* Attach shader to program to be run by GPU */
+    GLCall(glAttachShader(program, fs));
+    GLCall(glLinkProgram(program));
+    GLCall(glValidateProgram(program));
+    GLCall(glDeleteShader(vs));                                                 /* DELETING shader to save space as shader is already attached to program */
+    GLCall(glDeleteShader(fs));
+
+    return program;
+
+}
+
+
+/* Read file and output vertex and fragment shader source code */
+static ShaderProgramSource ParseShader(const std::string& filepath) {
+
+    std::ifstream stream(filepath);
+
+    enum class ShaderType {
+        NONE = -1, VERTEX = 0, FRAGMENT = 1
+    };
+
+    std::string line;
+    std::stringstream ss[2];
+    ShaderType type = ShaderType::NONE;
+    while (getline(stream, line)) {
+
+        if (line.find("#shader") != std::string::npos) {
+
+            if (line.find("vertex") != std::string::npos)
+                type = ShaderType::VERTEX;
+            else if (line.find("fragment") != std::string::npos)
+                type = ShaderType::FRAGMENT;
+
+        }
+        else {
+            ss[int(type)] << line << '\n';
+        }
+    }
+
+    return { ss[0].str(), ss[1].str() };
+}
@@ -0,0 +1,584 @@
+/*
+
+Parallel Shader Compile (non blocking program building)
+
+CompileShader calls glCompileShader and right after that asks glGetShaderiv(GL_COMPILE_STATUS)
+asking for the status makes the cpu wait till compile is done, and CreateShader links and validates the same way
+so at startup every program is compiled one after other on the main thread
+
+AsyncProgramBuilder does it differently
+
+---> Submit() only starts the work -> glCompileShader for both shaders, glLinkProgram, and does NOT ask for any status
+---> with GL_KHR_parallel_shader_compile (or ARB version) driver compiles on its own threads (glMaxShaderCompilerThreadsKHR)
+     and we can ask GL_COMPLETION_STATUS_KHR which never waits, it just says done or not done
+---> Poll() is called every frame, programs which are done are checked (link status, error log) and marked ready
+---> while programs are not ready, the app draws a loading frame (progress bar made with glScissor + glClear, needs no shader)
+
+without the extension Poll() finishes a few programs every frame (each one blocks), so loading screen still moves
+
+at start wall-clock time to build N programs is measured for the old serial way and the async way
+
+*/
+
+
+
+
+#include <GL\glew.h>
+
+#include <GLFW/glfw3.h>
+
+
+#include <iostream>
+#include <fstream>  // to read file
+#include <string>   // To use getline func
+#include <sstream>
+#include <vector>
+#include <chrono>
+#include <math.h>
+
+
+/* ------------ ERROR CHECK POLICY ------------ */
+/*
+GL_CHECK_NONE   -> GLCall(x) is just x, nothing is checked (release)
+GL_CHECK_ASYNC  -> GLCall(x) is just x, driver reports errors later through glDebugMessageCallback (needs KHR_debug / GL 4.3)
+GL_CHECK_STRICT -> glGetError before and after every call, stops on the line with the error (old GLCall)
+
+default is NONE for release (NDEBUG) and STRICT for debug, or pass -DGL_CHECK_POLICY=1 to compiler to choose
+*/
+#define GL_CHECK_NONE   0
+#define GL_CHECK_ASYNC  1
+#define GL_CHECK_STRICT 2
+
+#ifndef GL_CHECK_POLICY
+    #ifdef NDEBUG
+        #define GL_CHECK_POLICY GL_CHECK_NONE
+    #else
+        #define GL_CHECK_POLICY GL_CHECK_STRICT
+    #endif
+#endif
+
+
+/* ------------ MACRO ------------ */
+
+/* __debugbreak is only in MSVC, on gcc / clang SIGTRAP does same thing (debugger stops there) */
+#if defined(_MSC_VER)
+    #define DEBUG_BREAK() __debugbreak()
+#elif defined(__GNUC__) || defined(__clang__)
+    #include <signal.h>
+    #define DEBUG_BREAK() raise(SIGTRAP)
+#else
+    #include <cstdlib>
+    #define DEBUG_BREAK() std::abort()
+#endif
+
+#define ASSERT(x) if (!(x)) DEBUG_BREAK();
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+    #define GLCall(x) GLCLearError();\
+        x;\
+        ASSERT(GlLogCall(#x, __FILE__, __LINE__))
+#else
+    #define GLCall(x) x
+#endif
+
+/*
+# before a fucntion pass it as a stringand __FILE__and __LINE__ are macros to get file loc and line of fucntion
+and since MACROS HAS TO BE IN SAME LINE we use \ before line ends to write macros in multiple lines
+*/
+
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+static void GLCLearError() {
+    while (glGetError() != GL_NO_ERROR);    // glGetError get error and we get all the error until there are no arror left
+}
+
+static bool GlLogCall(const char* function, const char* file, int line) {
+    bool ok = true;
+    while (GLenum error = glGetError()) {
+        std::cout << "[OpenGl Error] (" << error << "): " << function << " " << file << ":" << line << std::endl;
+        ok = false;
+    }
+    return ok;
+}
+#endif
+
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+/* called by the driver (maybe from its own thread) when something is wrong */
+static void APIENTRY GlDebugCallback(GLenum /*source*/, GLenum type, GLuint id, GLenum severity, GLsizei /*length*/, const GLchar* message, const void* /*userParam*/) {
+
+    const char* level = severity == GL_DEBUG_SEVERITY_HIGH ? "HIGH" : severity == GL_DEBUG_SEVERITY_MEDIUM ? "MEDIUM" : "LOW";
+    std::cout << "[OpenGl Debug] (" << level << (type == GL_DEBUG_TYPE_ERROR ? ", error" : "") << ", id " << id << "): " << message << std::endl;
+}
+#endif
+
+/* call once after glewInit, sets up whatever the chosen policy needs */
+static void SetupGLErrorPolicy() {
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+    if (GLEW_VERSION_4_3 || GLEW_KHR_debug) {
+        glEnable(GL_DEBUG_OUTPUT);
+        glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);     /* driver does not have to report inside the call, so no slow down */
+        glDebugMessageCallback(GlDebugCallback, nullptr);
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);  /* skip info messages */
+        std::cout << "GL errors: async (debug callback)" << std::endl;
+    }
+    else {
+        std::cout << "GL errors: async asked but KHR_debug is not there, errors are not checked" << std::endl;
+    }
+#elif GL_CHECK_POLICY == GL_CHECK_STRICT
+    std::cout << "GL errors: strict (glGetError after every call)" << std::endl;
+#else
+    std::cout << "GL errors: off" << std::endl;
+#endif
+}
+
+
+struct ShaderProgramSource {
+    std::string VertexSource;
+    std::string FragmentSource;
+};
+
+static ShaderProgramSource ParseShader(const std::string& filepath);
+
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader);
+
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source);
+
+
+
+/* ------------- ASYNC PROGRAM BUILDER ------------- */
+
+class AsyncProgramBuilder {
+public:
+    AsyncProgramBuilder() {
+        m_Parallel = GLEW_KHR_parallel_shader_compile || GLEW_ARB_parallel_shader_compile;
+        if (GLEW_KHR_parallel_shader_compile)
+            glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);      /* 0xFFFFFFFF -> driver can use as many threads as it wants */
+        else if (GLEW_ARB_parallel_shader_compile)
+            glMaxShaderCompilerThreadsARB(0xFFFFFFFF);
+    }
+
+    /* starts compile and link, returns a handle to ask for the program later */
+    unsigned int Submit(const ShaderProgramSource& source) {
+        Pending p;
+        p.vs = StartCompile(GL_VERTEX_SHADER, source.VertexSource);
+        p.fs = StartCompile(GL_FRAGMENT_SHADER, source.FragmentSource);
+
+        GLCall(p.program = glCreateProgram());
+        GLCall(glAttachShader(p.program, p.vs));
+        GLCall(glAttachShader(p.program, p.fs));
+        GLCall(glLinkProgram(p.program));      /* driver waits for the compiles itself, we don't */
+
+        m_Programs.push_back(p);
+        m_Remaining++;
+        return (unsigned int)m_Programs.size() - 1;
+    }
+
+    /* call every frame, finishes programs which are done. without the extension, finishes at most 'blockingBudget' */
+    void Poll(unsigned int blockingBudget = 4) {
+        for (Pending& p : m_Programs) {
+            if (p.state != State::Building)
+                continue;
+
+            if (m_Parallel) {
+                int done = GL_FALSE;
+                GLCall(glGetProgramiv(p.program, GL_COMPLETION_STATUS_KHR, &done));   /* never waits */
+                if (done == GL_FALSE)
+                    continue;
+            }
+            else {
+                if (blockingBudget == 0)
+                    return;
+                blockingBudget--;   /* the status query below waits for this one */
+            }
+
+            Finish(p);
+        }
+    }
+
+    bool AllReady() const { return m_Remaining == 0; }
+    float Progress() const { return m_Programs.empty() ? 1.0f : 1.0f - (float)m_Remaining / m_Programs.size(); }
+    bool IsParallel() const { return m_Parallel; }
+
+    /* 0 while building or if build failed */
+    unsigned int Get(unsigned int handle) const {
+        const Pending& p = m_Programs[handle];
+        return p.state == State::Ready ? p.program : 0;
+    }
+
+    unsigned int GetFailedCount() const { return m_Failed; }
+
+private:
+    enum class State { Building, Ready, Failed };
+
+    struct Pending {
+        unsigned int program = 0, vs = 0, fs = 0;
+        State state = State::Building;
+    };
+
+    static unsigned int StartCompile(unsigned int shaderType, const std::string& source) {
+        GLCall(unsigned int id = glCreateShader(shaderType));
+        const char* src = source.c_str();
+        GLCall(glShaderSource(id, 1, &src, nullptr));
+        GLCall(glCompileShader(id));
+        return id;
+    }
+
+    /* program is done (or we are ok to wait), now check status and print errors like CompileShader does */
+    void Finish(Pending& p) {
+        int linked = GL_FALSE;
+        GLCall(glGetProgramiv(p.program, GL_LINK_STATUS, &linked));
+
+        if (linked == GL_TRUE) {
+            p.state = State::Ready;
+        }
+        else {
+            PrintShaderLog(p.vs, "vertex");
+            PrintShaderLog(p.fs, "fragment");
+
+            int length = 0;
+            GLCall(glGetProgramiv(p.program, GL_INFO_LOG_LENGTH, &length));
+            std::vector<char> message(length + 1);
+            GLCall(glGetProgramInfoLog(p.program, length, &length, message.data()));
+            std::cout << "Failed To Link program" << std::endl << message.data() << std::endl;
+
+            GLCall(glDeleteProgram(p.program));
+            p.state = State::Failed;
+            m_Failed++;
+        }
+
+        GLCall(glDeleteShader(p.vs));       /* still attached (if program is alive), gets freed with the program */
+        GLCall(glDeleteShader(p.fs));
+        m_Remaining--;
+    }
+
+    static void PrintShaderLog(unsigned int shader, const char* name) {
+        int result = GL_FALSE;
+        GLCall(glGetShaderiv(shader, GL_COMPILE_STATUS, &result));
+        if (result == GL_TRUE)
+            return;
+
+        int length = 0;
+        GLCall(glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &length));
+        std::vector<char> message(length + 1);
+        GLCall(glGetShaderInfoLog(shader, length, &length, message.data()));
+        std::cout << "Failed To Compile " << name << " shader" << std::endl << message.data() << std::endl;
+    }
+
+    std::vector<Pending> m_Programs;
+    unsigned int m_Remaining = 0;
+    unsigned int m_Failed = 0;
+    bool m_Parallel = false;
+};
+
+
+/* makes 'count' different programs, the nonce makes sure driver shader cache (like mesa disk cache) does not hit */
+static std::vector<ShaderProgramSource> MakeVariants(const ShaderProgramSource& base, unsigned int count, const std::string& nonce) {
+    std::vector<ShaderProgramSource> variants;
+    for (unsigned int i = 0; i < count; i++) {
+        ShaderProgramSource v = base;
+        v.VertexSource += "// " + nonce + " variant " + std::to_string(i) + "\n";
+        v.FragmentSource += "// " + nonce + " variant " + std::to_string(i) + "\n";
+        variants.push_back(v);
+    }
+    return variants;
+}
+
+/* loading frame -> a bar filled by 'progress', only glScissor + glClear so it works before any program is ready */
+static void DrawLoadingFrame(GLFWwindow* window, float progress) {
+    int width, height;
+    glfwGetFramebufferSize(window, &width, &height);
+
+    GLCall(glClearColor(0.1f, 0.1f, 0.1f, 1.0f));
+    GLCall(glClear(GL_COLOR_BUFFER_BIT));
+
+    GLCall(glEnable(GL_SCISSOR_TEST));
+    GLCall(glScissor(width / 10, height / 2 - 10, (int)(width * 0.8f * progress), 20));
+    GLCall(glClearColor(0.2f, 0.8f, 0.3f, 1.0f));
+    GLCall(glClear(GL_COLOR_BUFFER_BIT));
+    GLCall(glDisable(GL_SCISSOR_TEST));
+
+    GLCall(glClearColor(0.0f, 0.0f, 0.0f, 1.0f));
+}
+
+
+
+int main(void)
+{
+    /* GLFW BASIC STUFF */
+        GLFWwindow* window;
+
+        /* Initialize the GLFW library */
+        if (!glfwInit())
+            return -1;
+
+
+        /* setting version 3.3 and core profile (i.e mordern opengl) */
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);    /* most drivers only send debug messages in debug context */
+#endif
+
+
+        /* Create a windowed mode window and its OpenGL context */
+        window = glfwCreateWindow(640, 480, "Hello World", NULL, NULL);
+        if (!window)
+        {
+            glfwTerminate();
+            return -1;
+
+        }
+        /* Make the window's context current */
+        glfwMakeContextCurrent(window);
+
+        glfwSwapInterval(1);    /* controls FPS or intervel between buffer(frames) */
+
+    /*  END BASIC GLFW   */
+
+
+    /* Intitialize GLEW */
+        if (glewInit() != GLEW_OK) {
+            std::cout << "Error!" << std::endl;
+        }
+    /* END */
+
+    std::cout << glGetString(GL_VERSION) << std::endl;  /* prints the version of opengl using */
+
+    SetupGLErrorPolicy();
+
+
+
+    /* ------------- Generating Data to be used to display in the window ------------- */
+
+            // 4 positions of vertices of sqaure
+            float positions[] = {
+                -0.5f, -0.5f,    // 0
+                 0.5f, -0.5f,    // 1
+                 0.5f,  0.5f,    // 2
+                -0.5f,  0.5f     // 3
+            };
+
+            // Index data -----> position in which vertices is to be rendered to form a square
+            unsigned int indices[] = {
+                0, 1, 2,
+                2, 3, 0
+            };
+
+            unsigned int vao;
+            GLCall(glGenVertexArrays(1, &vao));
+            GLCall(glBindVertexArray(vao));
+
+            unsigned int buffer;
+            GLCall(glGenBuffers(1, &buffer));
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, buffer));
+            GLCall(glBufferData(GL_ARRAY_BUFFER, 4 * 2 * sizeof(float), positions, GL_STATIC_DRAW));
+
+            GLCall(glEnableVertexAttribArray(0));
+            GLCall(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2, 0));
+
+            unsigned int ibo;       // index buffer object
+            GLCall(glGenBuffers(1, &ibo));
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo));
+            GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, 6 * sizeof(unsigned int), indices, GL_STATIC_DRAW));
+
+            GLCall(glBindVertexArray(0));
+
+
+        ShaderProgramSource shaderSource = ParseShader("res/shaders/Basic - UNFORMS.shader");
+        const unsigned int programCount = 64;
+        std::string nonce = std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+
+
+    /* ------------- SERIAL (old way) ------------- */
+
+        std::vector<ShaderProgramSource> serialSources = MakeVariants(shaderSource, programCount, nonce + " serial");
+        auto start = std::chrono::high_resolution_clock::now();
+
+        std::vector<unsigned int> serialPrograms;
+        for (const ShaderProgramSource& s : serialSources) {
+            unsigned int program = CreateShader(s.VertexSource, s.FragmentSource);
+            int linked;
+            GLCall(glGetProgramiv(program, GL_LINK_STATUS, &linked));   /* we have to know it is ok before using it */
+            serialPrograms.push_back(program);
+        }
+        double serialMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+        for (unsigned int program : serialPrograms)
+            glDeleteProgram(program);
+
+
+    /* ------------- ASYNC (submit everything, draw loading frames till ready) ------------- */
+
+        AsyncProgramBuilder builder;
+        std::cout << "Parallel shader compile: " << (builder.IsParallel() ? "yes" : "no (blocking fallback)") << std::endl;
+
+        std::vector<ShaderProgramSource> asyncSources = MakeVariants(shaderSource, programCount, nonce + " async");
+        start = std::chrono::high_resolution_clock::now();
+
+        std::vector<unsigned int> handles;
+        for (const ShaderProgramSource& s : asyncSources)
+            handles.push_back(builder.Submit(s));
+
+        double submitMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+        glfwSwapInterval(0);        /* loading frames should not wait for monitor, or we measure vsync */
+        unsigned int loadingFrames = 0;
+        while (!builder.AllReady() && !glfwWindowShouldClose(window)) {
+            builder.Poll();
+            DrawLoadingFrame(window, builder.Progress());
+            glfwSwapBuffers(window);
+            glfwPollEvents();
+            loadingFrames++;
+        }
+        glfwSwapInterval(1);
+
+        double asyncMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+        std::cout << "[Startup] " << programCount << " programs" << std::endl;
+        std::cout << "  serial : " << serialMs << " ms (main thread blocked whole time)" << std::endl;
+        std::cout << "  async  : " << asyncMs << " ms (submit took " << submitMs << " ms, " << loadingFrames << " loading frames drawn, "
+                  << builder.GetFailedCount() << " failed)" << std::endl;
+
+        unsigned int shader = builder.Get(handles[0]);     /* 0 if window was closed while loading */
+        GLCall(glUseProgram(shader));
+        int location = -1;      /* glGetUniformLocation(0, ...) is GL_INVALID_VALUE */
+        if (shader) {
+            GLCall(location = glGetUniformLocation(shader, "u_Color"));
+        }
+        ASSERT(!shader || location != -1);
+
+
+    /* ------------- END OF GENERATING DATA ------------- */
+
+
+    /* ----------- Animation Variable ----------- */
+    float r = 0.0f;
+    float increment = 0.05f;
+
+
+
+    /* WHILE Loop to keep the window active till window is closed */
+    while (!glfwWindowShouldClose(window))
+    {
+        /* Render here */
+
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        if (shader) {
+            GLCall(glUseProgram(shader));
+            GLCall(glUniform4f(location, r, 0.2f, 0.5f, 1.0f));
+            GLCall(glBindVertexArray(vao));
+            GLCall(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr));
+        }
+
+        if (r > 1.0f)
+            increment = -0.05f;
+        else if (r < 0.0f)
+            increment = 0.05f;
+
+        r += increment;
+
+
+        /* Swap front and back buffers */
+        glfwSwapBuffers(window);
+
+        /* Poll for and process events */
+        glfwPollEvents();
+    }
+
+    for (unsigned int handle : handles)
+        if (builder.Get(handle))
+            glDeleteProgram(builder.Get(handle));
+    glDeleteBuffers(1, &buffer);
+    glDeleteBuffers(1, &ibo);
+    glDeleteVertexArrays(1, &vao);
+
+    glfwTerminate();
+    return 0;
+}
+
+
+
+
+/* Makes and compile the shader by inputing the type and Source code */
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source) {
+
+    unsigned int id = glCreateShader(shaderType);   /* generate Shader and return id */
+    const char* src = source.c_str();               /* convert inputed string to char* */
+    GLCall(glShaderSource(id, 1, &src, nullptr));           /* attaching source code to the shader */
+    GLCall(glCompileShader(id));                            /* compile shader */
+
+    /* -------- ERROR HANDLING -------- */
+        int result;
+        GLCall(glGetShaderiv(id, GL_COMPILE_STATUS, &result));
+        if (result == GL_FALSE) {
+            int length;
+            GLCall(glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length));
+            std::vector<char> message(length + 1);      /* char Array of length 'length' (_malloca is only in MSVC) */
+            GLCall(glGetShaderInfoLog(id, length, &length, message.data()));
+
+            std::cout << "Failed To Compile " << (shaderType == GL_VERTEX_SHADER ? "vertex" : "fragment") << " shader" << std::endl;
+
+            std::cout << message.data() << std::endl;
+            GLCall(glDeleteShader(id));
+            return 0;
+        }
+
+    /* -------- END ERROR HANDLING -------- */
+
+    return id;
+
+}
+
+
+/* Creates a program Which contain vertex and fragment shader */
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader) {
+
+    GLCall(unsigned int program = glCreateProgram());                           /* generate program to store all shader and program to be run by GPU during while loop */
+    unsigned int vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
+    unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+
+    GLCall(glAttachShader(program, vs));                                        /* Attach shader to program to be run by GPU */
+    GLCall(glAttachShader(program, fs));
+    GLCall(glLinkProgram(program));
+    GLCall(glValidateProgram(program));
+    GLCall(glDeleteShader(vs));                                                 /* DELETING shader to save space as shader is already attached to program */
+    GLCall(glDeleteShader(fs));
+
+    return program;
+
+}
+
+
+/* Read file and output vertex and fragment shader source code */
+static ShaderProgramSource ParseShader(const std::string& filepath) {
+
+    std::ifstream stream(filepath);
+
+    enum class ShaderType {
+        NONE = -1, VERTEX = 0, FRAGMENT = 1
+    };
+
+    std::string line;
+    std::stringstream ss[2];
+    ShaderType type = ShaderType::NONE;
+    while (getline(stream, line)) {
+
+        if (line.find("#shader") != std::string::npos) {
+
+            if (line.find("vertex") != std::string::npos)
+                type = ShaderType::VERTEX;
+            else if (line.find("fragment") != std::string::npos)
+                type = ShaderType::FRAGMENT;
+
+        }
+        else {
+            ss[int(type)] << line << '\n';
+        }
+    }
+
+    return { ss[0].str(), ss[1].str() };
+}
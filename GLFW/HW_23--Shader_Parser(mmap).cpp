@@ -0,0 +1,758 @@
+/*
+
+Shader Parser (mmap, all stages)
+
+old ParseShader reads the file line by line with getline, and copies every line into one of 2 stringstreams
+---> one std::string allocation (and copy) per line, and again when .str() is called
+---> only knows "vertex" and "fragment"
+---> text before the first #shader line goes to ss[int(ShaderType::NONE)] = ss[-1] ---> out of bounds write
+
+ParseShaderFile does it in one pass over a memory mapped file (mmap on linux / mac, MapViewOfFile on windows)
+
+---> the OS maps the file into our memory, nothing is read or copied by us
+---> every stage is a std::string_view into the mapping (from line after its #shader tag till next tag)
+---> glShaderSource takes pointer + length, so the view goes to the driver as it is (no null terminator needed)
+---> tags: vertex, fragment, geometry, tess_control, tess_evaluation, compute
+---> problems are collected with their line number instead of being ignored
+     (text before first tag, unknown tag, stage defined 2 times, compute mixed with graphics stages, ...)
+---> line where every stage starts is kept, so a driver error "0:5" can be found in the file
+
+the views are valid only while the ShaderFile (and its mapping) is alive
+
+with --bench a shader library of many big files (about 64 MB) is written to the temp folder,
+parsed with old and new parser to compare time, and deleted again
+
+    HW_23           parse + show Basic - UNFORMS.shader
+    HW_23 --bench   parser benchmark first
+
+*/
+
+
+
+
+#include <GL\glew.h>
+
+#include <GLFW/glfw3.h>
+
+
+#include <iostream>
+#include <fstream>  // to read file
+#include <string>   // To use getline func
+#include <string_view>
+#include <sstream>
+#include <vector>
+#include <chrono>
+#include <cstring>  // memchr
+#include <filesystem>
+#include <math.h>
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+
+/* ------------ ERROR CHECK POLICY ------------ */
+/*
+GL_CHECK_NONE   -> GLCall(x) is just x, nothing is checked (release)
+GL_CHECK_ASYNC  -> GLCall(x) is just x, driver reports errors later through glDebugMessageCallback (needs KHR_debug / GL 4.3)
+GL_CHECK_STRICT -> glGetError before and after every call, stops on the line with the error (old GLCall)
+
+default is NONE for release (NDEBUG) and STRICT for debug, or pass -DGL_CHECK_POLICY=1 to compiler to choose
+*/
+#define GL_CHECK_NONE   0
+#define GL_CHECK_ASYNC  1
+#define GL_CHECK_STRICT 2
+
+#ifndef GL_CHECK_POLICY
+    #ifdef NDEBUG
+        #define GL_CHECK_POLICY GL_CHECK_NONE
+    #else
+        #define GL_CHECK_POLICY GL_CHECK_STRICT
+    #endif
+#endif
+
+
+/* ------------ MACRO ------------ */
+
+/* __debugbreak is only in MSVC, on gcc / clang SIGTRAP does same thing (debugger stops there) */
+#if defined(_MSC_VER)
+    #define DEBUG_BREAK() __debugbreak()
+#elif defined(__GNUC__) || defined(__clang__)
+    #include <signal.h>
+    #define DEBUG_BREAK() raise(SIGTRAP)
+#else
+    #include <cstdlib>
+    #define DEBUG_BREAK() std::abort()
+#endif
+
+#define ASSERT(x) if (!(x)) DEBUG_BREAK();
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+    #define GLCall(x) GLCLearError();\
+        x;\
+        ASSERT(GlLogCall(#x, __FILE__, __LINE__))
+#else
+    #define GLCall(x) x
+#endif
+
+/*
+# before a fucntion pass it as a stringand __FILE__and __LINE__ are macros to get file loc and line of fucntion
+and since MACROS HAS TO BE IN SAME LINE we use \ before line ends to write macros in multiple lines
+*/
+
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+static void GLCLearError() {
+    while (glGetError() != GL_NO_ERROR);    // glGetError get error and we get all the error until there are no arror left
+}
+
+static bool GlLogCall(const char* function, const char* file, int line) {
+    bool ok = true;
+    while (GLenum error = glGetError()) {
+        std::cout << "[OpenGl Error] (" << error << "): " << function << " " << file << ":" << line << std::endl;
+        ok = false;
+    }
+    return ok;
+}
+#endif
+
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+/* called by the driver (maybe from its own thread) when something is wrong */
+static void APIENTRY GlDebugCallback(GLenum /*source*/, GLenum type, GLuint id, GLenum severity, GLsizei /*length*/, const GLchar* message, const void* /*userParam*/) {
+
+    const char* level = severity == GL_DEBUG_SEVERITY_HIGH ? "HIGH" : severity == GL_DEBUG_SEVERITY_MEDIUM ? "MEDIUM" : "LOW";
+    std::cout << "[OpenGl Debug] (" << level << (type == GL_DEBUG_TYPE_ERROR ? ", error" : "") << ", id " << id << "): " << message << std::endl;
+}
+#endif
+
+/* call once after glewInit, sets up whatever the chosen policy needs */
+static void SetupGLErrorPolicy() {
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+    if (GLEW_VERSION_4_3 || GLEW_KHR_debug) {
+        glEnable(GL_DEBUG_OUTPUT);
+        glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);     /* driver does not have to report inside the call, so no slow down */
+        glDebugMessageCallback(GlDebugCallback, nullptr);
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);  /* skip info messages */
+        std::cout << "GL errors: async (debug callback)" << std::endl;
+    }
+    else {
+        std::cout << "GL errors: async asked but KHR_debug is not there, errors are not checked" << std::endl;
+    }
+#elif GL_CHECK_POLICY == GL_CHECK_STRICT
+    std::cout << "GL errors: strict (glGetError after every call)" << std::endl;
+#else
+    std::cout << "GL errors: off" << std::endl;
+#endif
+}
+
+
+
+/* ------------- MAPPED FILE ------------- */
+
+/* read only view of a whole file, unmapped in destructor */
+class MappedFile {
+public:
+    MappedFile() = default;
+
+    explicit MappedFile(const std::string& filepath) {
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return;
+
+        LARGE_INTEGER size;
+        if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping) {
+                m_Data = (const char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                CloseHandle(mapping);       /* view keeps the mapping alive */
+            }
+            m_Size = m_Data ? (size_t)size.QuadPart : 0;
+        }
+        m_Open = true;
+        CloseHandle(file);
+#else
+        int fd = open(filepath.c_str(), O_RDONLY);
+        if (fd == -1)
+            return;
+
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            void* data = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED) {
+                m_Data = (const char*)data;
+                m_Size = (size_t)st.st_size;
+            }
+        }
+        m_Open = true;      /* empty file is open but has no mapping (mmap of 0 bytes fails) */
+        close(fd);          /* mapping stays valid after close */
+#endif
+    }
+
+    ~MappedFile() { Unmap(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept { *this = std::move(other); }
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            Unmap();
+            m_Data = other.m_Data; m_Size = other.m_Size; m_Open = other.m_Open;
+            other.m_Data = nullptr; other.m_Size = 0; other.m_Open = false;
+        }
+        return *this;
+    }
+
+    bool IsOpen() const { return m_Open; }
+    std::string_view View() const { return { m_Data, m_Size }; }
+
+private:
+    void Unmap() {
+        if (!m_Data)
+            return;
+#if defined(_WIN32)
+        UnmapViewOfFile(m_Data);
+#else
+        munmap((void*)m_Data, m_Size);
+#endif
+        m_Data = nullptr;
+        m_Size = 0;
+    }
+
+    const char* m_Data = nullptr;
+    size_t m_Size = 0;
+    bool m_Open = false;
+};
+
+
+
+/* ------------- SHADER FILE ------------- */
+
+enum class ShaderStage {
+    Vertex, Fragment, Geometry, TessControl, TessEvaluation, Compute, Count
+};
+
+static const unsigned int STAGE_COUNT = (unsigned int)ShaderStage::Count;
+
+/* same order as ShaderStage */
+static const char* s_StageTags[STAGE_COUNT] = { "vertex", "fragment", "geometry", "tess_control", "tess_evaluation", "compute" };
+static const unsigned int s_StageGLTypes[STAGE_COUNT] = {
+    GL_VERTEX_SHADER, GL_FRAGMENT_SHADER, GL_GEOMETRY_SHADER, GL_TESS_CONTROL_SHADER, GL_TESS_EVALUATION_SHADER, GL_COMPUTE_SHADER
+};
+
+struct ShaderParseError {
+    unsigned int line;      /* 1 based, 0 if it is about the whole file */
+    std::string message;
+};
+
+struct ShaderFile {
+    std::string path;
+    MappedFile file;                                /* owns the memory every stage points into */
+    std::string_view stages[STAGE_COUNT];           /* empty if stage is not in the file */
+    unsigned int firstLine[STAGE_COUNT] = {};       /* file line of the first source line of the stage */
+    std::vector<ShaderParseError> errors;
+
+    bool Has(ShaderStage stage) const { return !stages[(int)stage].empty(); }
+    bool IsValid() const { return errors.empty(); }
+};
+
+
+static bool IsBlank(std::string_view line) {
+    for (char c : line)
+        if (c != ' ' && c != '\t' && c != '\r' && c != '\n')
+            return false;
+    return true;
+}
+
+static std::string_view TrimLeft(std::string_view s) {
+    size_t i = 0;
+    while (i < s.size() && (s[i] == ' ' || s[i] == '\t'))
+        i++;
+    return s.substr(i);
+}
+
+/* first word of 's', stops at space / tab / \r */
+static std::string_view FirstWord(std::string_view s) {
+    s = TrimLeft(s);
+    size_t end = 0;
+    while (end < s.size() && s[end] != ' ' && s[end] != '\t' && s[end] != '\r')
+        end++;
+    return s.substr(0, end);
+}
+
+
+/* single pass over 'source', fills stages, firstLine and errors of 'out' (views point into 'source') */
+static void ParseShaderSource(std::string_view source, ShaderFile& out) {
+
+    const int NONE = -1;
+    int current = NONE;                 /* stage we are inside of, or NONE (before first tag / after bad tag) */
+    size_t stageBegin = 0;
+    unsigned int tagLine[STAGE_COUNT] = {};
+    bool seenTag = false;
+
+    auto closeStage = [&](size_t end) {
+        if (current != NONE)
+            out.stages[current] = source.substr(stageBegin, end - stageBegin);
+    };
+
+    const char* data = source.data();
+    size_t pos = 0;
+    unsigned int lineNumber = 0;
+
+    while (pos < source.size()) {
+        lineNumber++;
+        const char* newline = (const char*)memchr(data + pos, '\n', source.size() - pos);
+        size_t lineEnd = newline ? (size_t)(newline - data) : source.size();
+        size_t next = newline ? lineEnd + 1 : lineEnd;
+        std::string_view line = source.substr(pos, lineEnd - pos);
+
+        std::string_view trimmed = TrimLeft(line);
+        if (trimmed.substr(0, 7) == "#shader") {
+
+            closeStage(pos);
+            current = NONE;
+            seenTag = true;
+
+            std::string_view tag = FirstWord(trimmed.substr(7));
+            int stage = NONE;
+            for (unsigned int i = 0; i < STAGE_COUNT; i++)
+                if (tag == s_StageTags[i])
+                    stage = (int)i;
+
+            if (stage == NONE) {
+                out.errors.push_back({ lineNumber, "unknown shader stage '" + std::string(tag) + "', text till next #shader is ignored" });
+            }
+            else if (tagLine[stage] != 0) {
+                out.errors.push_back({ lineNumber, std::string(s_StageTags[stage]) + " stage is already defined at line " + std::to_string(tagLine[stage]) + ", this one is ignored" });
+            }
+            else {
+                current = stage;
+                tagLine[stage] = lineNumber;
+                stageBegin = next;
+                out.firstLine[stage] = lineNumber + 1;
+            }
+        }
+        else if (!seenTag && !IsBlank(line) && trimmed.substr(0, 2) != "//") {
+            out.errors.push_back({ lineNumber, "text before the first #shader tag is ignored" });   /* old parser wrote this to ss[-1] */
+            seenTag = true;     /* report it only once */
+        }
+
+        pos = next;
+    }
+    closeStage(source.size());
+
+
+    /* ---- checks over the whole file ---- */
+
+    bool any = false, graphics = false;
+    for (unsigned int i = 0; i < STAGE_COUNT; i++) {
+        if (tagLine[i] == 0)
+            continue;
+        any = true;
+        if (i != (unsigned int)ShaderStage::Compute)
+            graphics = true;
+        if (IsBlank(out.stages[i]))
+            out.errors.push_back({ tagLine[i], std::string(s_StageTags[i]) + " stage is empty" });
+    }
+
+    if (!any)
+        out.errors.push_back({ 0, "no #shader tag found" });
+
+    if (graphics && tagLine[(int)ShaderStage::Compute] != 0)
+        out.errors.push_back({ tagLine[(int)ShaderStage::Compute], "compute stage can not be in the same program as graphics stages" });
+
+    if (graphics && (tagLine[(int)ShaderStage::Vertex] == 0 || tagLine[(int)ShaderStage::Fragment] == 0))
+        out.errors.push_back({ 0, "graphics program needs a vertex and a fragment stage" });
+
+    if (tagLine[(int)ShaderStage::TessControl] != 0 && tagLine[(int)ShaderStage::TessEvaluation] == 0)
+        out.errors.push_back({ tagLine[(int)ShaderStage::TessControl], "tess_control stage without tess_evaluation stage" });
+}
+
+
+/* maps the file and parses it, the returned ShaderFile owns the mapping */
+static ShaderFile ParseShaderFile(const std::string& filepath) {
+    ShaderFile out;
+    out.path = filepath;
+    out.file = MappedFile(filepath);
+
+    if (!out.file.IsOpen()) {
+        out.errors.push_back({ 0, "can not open file" });
+        return out;
+    }
+
+    ParseShaderSource(out.file.View(), out);
+    return out;
+}
+
+static void PrintParseErrors(const ShaderFile& shader) {
+    for (const ShaderParseError& e : shader.errors)
+        std::cout << "[Shader Parse] " << shader.path << ":" << e.line << ": " << e.message << std::endl;
+}
+
+
+
+/* ------------- OLD PARSER (only for the comparison) ------------- */
+
+struct ShaderProgramSource {
+    std::string VertexSource;
+    std::string FragmentSource;
+};
+
+/* the old getline ParseShader, NONE is now skipped instead of writing to ss[-1] */
+static ShaderProgramSource ParseShaderGetline(const std::string& filepath) {
+
+    std::ifstream stream(filepath);
+
+    enum class ShaderType {
+        NONE = -1, VERTEX = 0, FRAGMENT = 1
+    };
+
+    std::string line;
+    std::stringstream ss[2];
+    ShaderType type = ShaderType::NONE;
+    while (getline(stream, line)) {
+
+        if (line.find("#shader") != std::string::npos) {
+
+            if (line.find("vertex") != std::string::npos)
+                type = ShaderType::VERTEX;
+            else if (line.find("fragment") != std::string::npos)
+                type = ShaderType::FRAGMENT;
+
+        }
+        else if (type != ShaderType::NONE) {
+            ss[int(type)] << line << '\n';
+        }
+    }
+
+    return { ss[0].str(), ss[1].str() };
+}
+
+
+
+/* ------------- SHADER LIBRARY (benchmark data) ------------- */
+
+/* writes 'fileCount' shader files with vertex + fragment stage, 'linesPerStage' lines each, returns their paths */
+static std::vector<std::string> WriteShaderLibrary(const std::string& directory, unsigned int fileCount, unsigned int linesPerStage) {
+
+    std::filesystem::create_directories(directory);
+
+    std::vector<std::string> paths;
+    for (unsigned int f = 0; f < fileCount; f++) {
+        std::string path = directory + "/lib_" + std::to_string(f) + ".shader";
+        std::ofstream stream(path, std::ios::binary);
+
+        stream << "#shader vertex\n#version 330 core\nlayout(location = 0) in vec4 position;\n";
+        for (unsigned int i = 0; i < linesPerStage; i++)
+            stream << "float v_helper_" << i << "(float x) { return x * " << i << ".0 + 0.5; }   // padding so lines are not tiny\n";
+        stream << "void main() { gl_Position = position; }\n";
+
+        stream << "#shader fragment\n#version 330 core\nlayout(location = 0) out vec4 color;\n";
+        for (unsigned int i = 0; i < linesPerStage; i++)
+            stream << "float f_helper_" << i << "(float x) { return x * " << i << ".0 - 0.5; }   // padding so lines are not tiny\n";
+        stream << "void main() { color = vec4(1.0); }\n";
+
+        paths.push_back(path);
+    }
+    return paths;
+}
+
+static unsigned int CreateProgram(const ShaderFile& shader);
+
+
+
+int main(int argc, char** argv)
+{
+    /* GLFW BASIC STUFF */
+        GLFWwindow* window;
+
+        /* Initialize the GLFW library */
+        if (!glfwInit())
+            return -1;
+
+
+        /* setting version 3.3 and core profile (i.e mordern opengl) */
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);    /* most drivers only send debug messages in debug context */
+#endif
+
+
+        /* Create a windowed mode window and its OpenGL context */
+        window = glfwCreateWindow(640, 480, "Hello World", NULL, NULL);
+        if (!window)
+        {
+            glfwTerminate();
+            return -1;
+
+        }
+        /* Make the window's context current */
+        glfwMakeContextCurrent(window);
+
+        glfwSwapInterval(1);    /* controls FPS or intervel between buffer(frames) */
+
+    /*  END BASIC GLFW   */
+
+
+    /* Intitialize GLEW */
+        if (glewInit() != GLEW_OK) {
+            std::cout << "Error!" << std::endl;
+        }
+    /* END */
+
+    std::cout << glGetString(GL_VERSION) << std::endl;  /* prints the version of opengl using */
+
+    SetupGLErrorPolicy();
+
+
+
+    /* ------------- PARSER CHECKS (a broken file in memory) ------------- */
+
+        {
+            const char* broken =
+                "// comments before the first tag are fine\n"
+                "uniform vec4 u_Color;      // this is not, old parser wrote it to ss[-1]\n"
+                "#shader vertex\n"
+                "void main() {}\n"
+                "#shader pixel\n"
+                "void main() {}\n"
+                "#shader vertex\n"
+                "void main() {}\n";
+
+            ShaderFile test;
+            test.path = "<broken example>";
+            ParseShaderSource(broken, test);
+            PrintParseErrors(test);
+        }
+
+
+    /* ------------- PARSER BENCHMARK (getline vs mmap) ------------- */
+
+        if (argc > 1 && std::string(argv[1]) == "--bench") {
+            const unsigned int fileCount = 200, linesPerStage = 2000;
+            const std::string directory = (std::filesystem::temp_directory_path() / "hw23_shader_lib").string();
+            std::vector<std::string> library = WriteShaderLibrary(directory, fileCount, linesPerStage);
+
+            size_t bytes = 0;
+            for (const std::string& path : library)
+                bytes += (size_t)std::filesystem::file_size(path);
+
+            /* both parsers run 2 times and the second run is timed, so both read from the OS file cache */
+            double getlineMs = 0.0, mmapMs = 0.0;
+            size_t checkOld = 0, checkNew = 0;      /* used so the compiler can not skip the work */
+            for (int run = 0; run < 2; run++) {
+
+                auto start = std::chrono::high_resolution_clock::now();
+                for (const std::string& path : library) {
+                    ShaderProgramSource s = ParseShaderGetline(path);
+                    checkOld += s.VertexSource.size() + s.FragmentSource.size();
+                }
+                getlineMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+                start = std::chrono::high_resolution_clock::now();
+                for (const std::string& path : library) {
+                    ShaderFile s = ParseShaderFile(path);
+                    checkNew += s.stages[(int)ShaderStage::Vertex].size() + s.stages[(int)ShaderStage::Fragment].size() + s.errors.size();
+                }
+                mmapMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+            }
+
+            std::cout << "[Parse] " << fileCount << " files, " << bytes / (1024.0 * 1024.0) << " MB" << std::endl;
+            std::cout << "  getline : " << getlineMs << " ms (" << checkOld / 2 << " bytes copied)" << std::endl;
+            std::cout << "  mmap    : " << mmapMs << " ms (" << checkNew / 2 << " bytes viewed, 0 copied)" << std::endl;
+
+            std::error_code ec;
+            std::filesystem::remove_all(directory, ec);
+        }
+
+
+
+    /* ------------- Generating Data to be used to display in the window ------------- */
+
+            // 4 positions of vertices of sqaure
+            float positions[] = {
+                -0.5f, -0.5f,    // 0
+                 0.5f, -0.5f,    // 1
+                 0.5f,  0.5f,    // 2
+                -0.5f,  0.5f     // 3
+            };
+
+            // Index data -----> position in which vertices is to be rendered to form a square
+            unsigned int indices[] = {
+                0, 1, 2,
+                2, 3, 0
+            };
+
+            unsigned int vao;
+            GLCall(glGenVertexArrays(1, &vao));
+            GLCall(glBindVertexArray(vao));
+
+            unsigned int buffer;
+            GLCall(glGenBuffers(1, &buffer));
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, buffer));
+            GLCall(glBufferData(GL_ARRAY_BUFFER, 4 * 2 * sizeof(float), positions, GL_STATIC_DRAW));
+
+            GLCall(glEnableVertexAttribArray(0));
+            GLCall(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2, 0));
+
+            unsigned int ibo;       // index buffer object
+            GLCall(glGenBuffers(1, &ibo));
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo));
+            GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, 6 * sizeof(unsigned int), indices, GL_STATIC_DRAW));
+
+            GLCall(glBindVertexArray(0));
+
+
+        ShaderFile shaderFile = ParseShaderFile("res/shaders/Basic - UNFORMS.shader");
+        PrintParseErrors(shaderFile);
+
+        unsigned int shader = shaderFile.IsValid() ? CreateProgram(shaderFile) : 0;
+        GLCall(glUseProgram(shader));
+        int location = -1;      /* glGetUniformLocation(0, ...) is GL_INVALID_VALUE */
+        if (shader) {
+            GLCall(location = glGetUniformLocation(shader, "u_Color"));
+        }
+        ASSERT(!shader || location != -1);
+
+
+    /* ------------- END OF GENERATING DATA ------------- */
+
+
+    /* ----------- Animation Variable ----------- */
+    float r = 0.0f;
+    float increment = 0.05f;
+
+
+
+    /* WHILE Loop to keep the window active till window is closed */
+    while (!glfwWindowShouldClose(window))
+    {
+        /* Render here */
+
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        if (shader) {
+            GLCall(glUseProgram(shader));
+            GLCall(glUniform4f(location, r, 0.2f, 0.5f, 1.0f));
+            GLCall(glBindVertexArray(vao));
+            GLCall(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr));
+        }
+
+        if (r > 1.0f)
+            increment = -0.05f;
+        else if (r < 0.0f)
+            increment = 0.05f;
+
+        r += increment;
+
+
+        /* Swap front and back buffers */
+        glfwSwapBuffers(window);
+
+        /* Poll for and process events */
+        glfwPollEvents();
+    }
+
+    glDeleteProgram(shader);
+    glDeleteBuffers(1, &buffer);
+    glDeleteBuffers(1, &ibo);
+    glDeleteVertexArrays(1, &vao);
+
+    glfwTerminate();
+    return 0;
+}
+
+
+
+
+/* Makes and compile one stage, source is a view so it is passed with its length (no copy, no null terminator) */
+static unsigned int CompileShader(ShaderStage stage, std::string_view source, const ShaderFile& shader) {
+
+    unsigned int id = glCreateShader(s_StageGLTypes[(int)stage]);   /* generate Shader and return id */
+    const char* src = source.data();
+    int length = (int)source.size();
+    GLCall(glShaderSource(id, 1, &src, &length));           /* attaching source code to the shader */
+    GLCall(glCompileShader(id));                            /* compile shader */
+
+    /* -------- ERROR HANDLING -------- */
+        int result;
+        GLCall(glGetShaderiv(id, GL_COMPILE_STATUS, &result));
+        if (result == GL_FALSE) {
+            int logLength;
+            GLCall(glGetShaderiv(id, GL_INFO_LOG_LENGTH, &logLength));
+            std::vector<char> message(logLength + 1);
+            GLCall(glGetShaderInfoLog(id, logLength, &logLength, message.data()));
+
+            /* driver line numbers start at 1 at the first line of the stage */
+            std::cout << "Failed To Compile " << s_StageTags[(int)stage] << " shader (" << shader.path
+                      << ", driver line 1 = file line " << shader.firstLine[(int)stage] << ")" << std::endl;
+
+            std::cout << message.data() << std::endl;
+            GLCall(glDeleteShader(id));
+            return 0;
+        }
+
+    /* -------- END ERROR HANDLING -------- */
+
+    return id;
+
+}
+
+
+/* Creates a program with every stage the file has, 0 if a stage did not compile or link failed */
+static unsigned int CreateProgram(const ShaderFile& shader) {
+
+    GLCall(unsigned int program = glCreateProgram());
+
+    unsigned int ids[STAGE_COUNT] = {};
+    bool ok = true;
+    for (unsigned int i = 0; i < STAGE_COUNT; i++) {
+        if (!shader.Has((ShaderStage)i))
+            continue;
+        ids[i] = CompileShader((ShaderStage)i, shader.stages[i], shader);
+        if (ids[i] == 0) {
+            ok = false;
+            continue;
+        }
+        GLCall(glAttachShader(program, ids[i]));
+    }
+
+    if (ok) {
+        GLCall(glLinkProgram(program));
+        int linked;
+        GLCall(glGetProgramiv(program, GL_LINK_STATUS, &linked));
+        if (linked == GL_FALSE) {
+            int length;
+            GLCall(glGetProgramiv(program, GL_INFO_LOG_LENGTH, &length));
+            std::vector<char> message(length + 1);
+            GLCall(glGetProgramInfoLog(program, length, &length, message.data()));
+            std::cout << "Failed To Link " << shader.path << std::endl << message.data() << std::endl;
+            ok = false;
+        }
+    }
+
+    for (unsigned int id : ids) {
+        if (id) {
+            GLCall(glDeleteShader(id));         /* DELETING shader to save space as shader is already attached to program */
+        }
+    }
+
+    if (!ok) {
+        GLCall(glDeleteProgram(program));
+        return 0;
+    }
+    return program;
+
+}
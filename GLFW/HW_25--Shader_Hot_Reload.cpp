@@ -0,0 +1,1194 @@
+/*
+
+Shader Hot Reload (inotify, background reparse, swap at frame boundary)
+
+shaders are read and compiled once before the while loop, to see a change the app has to be started again
+
+ShaderHotReloader keeps every program it built together with the files it was made of (.shader + all its #includes)
+
+---> a watcher thread waits on inotify (linux) for files written / moved into the folders of those files
+     (editors often save with a temp file + rename, so IN_MOVED_TO is watched too, not only IN_CLOSE_WRITE)
+     on other systems it checks the last write time of every file 4 times a second
+---> events are collected till nothing happened for 50 ms (one save can make many events)
+---> only programs which depend on a changed file are parsed + preprocessed again (HW_24), still on the watcher thread
+---> finished sources are handed to the main thread, which compiles them in Update() between 2 frames (GL calls must be
+     on the context thread) and swaps the program id, so a frame never sees half of a reload
+---> if anything fails (parse, include, compile, link) the errors are printed and the old program stays
+
+every reload prints what it cost: parse on the watcher thread, compile on the main thread, and time from file event to swap
+
+run it and edit any file in res/shaders (Basic - COLOR.glsl is used by 2 programs, Basic - UNFORMS.shader by 1)
+
+*/
+
+
+
+
+#include <GL\glew.h>
+
+#include <GLFW/glfw3.h>
+
+
+#include <iostream>
+#include <fstream>  // to read file
+#include <string>   // To use getline func
+#include <string_view>
+#include <sstream>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <memory>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <cstring>  // memchr
+#include <filesystem>
+#include <math.h>
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+#if defined(__linux__)
+    #include <sys/inotify.h>
+    #include <poll.h>
+#endif
+
+
+/* ------------ ERROR CHECK POLICY ------------ */
+/*
+GL_CHECK_NONE   -> GLCall(x) is just x, nothing is checked (release)
+GL_CHECK_ASYNC  -> GLCall(x) is just x, driver reports errors later through glDebugMessageCallback (needs KHR_debug / GL 4.3)
+GL_CHECK_STRICT -> glGetError before and after every call, stops on the line with the error (old GLCall)
+
+default is NONE for release (NDEBUG) and STRICT for debug, or pass -DGL_CHECK_POLICY=1 to compiler to choose
+*/
+#define GL_CHECK_NONE   0
+#define GL_CHECK_ASYNC  1
+#define GL_CHECK_STRICT 2
+
+#ifndef GL_CHECK_POLICY
+    #ifdef NDEBUG
+        #define GL_CHECK_POLICY GL_CHECK_NONE
+    #else
+        #define GL_CHECK_POLICY GL_CHECK_STRICT
+    #endif
+#endif
+
+
+/* ------------ MACRO ------------ */
+
+/* __debugbreak is only in MSVC, on gcc / clang SIGTRAP does same thing (debugger stops there) */
+#if defined(_MSC_VER)
+    #define DEBUG_BREAK() __debugbreak()
+#elif defined(__GNUC__) || defined(__clang__)
+    #include <signal.h>
+    #define DEBUG_BREAK() raise(SIGTRAP)
+#else
+    #include <cstdlib>
+    #define DEBUG_BREAK() std::abort()
+#endif
+
+#define ASSERT(x) if (!(x)) DEBUG_BREAK();
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+    #define GLCall(x) GLCLearError();\
+        x;\
+        ASSERT(GlLogCall(#x, __FILE__, __LINE__))
+#else
+    #define GLCall(x) x
+#endif
+
+/*
+# before a fucntion pass it as a stringand __FILE__and __LINE__ are macros to get file loc and line of fucntion
+and since MACROS HAS TO BE IN SAME LINE we use \ before line ends to write macros in multiple lines
+*/
+
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+static void GLCLearError() {
+    while (glGetError() != GL_NO_ERROR);    // glGetError get error and we get all the error until there are no arror left
+}
+
+static bool GlLogCall(const char* function, const char* file, int line) {
+    bool ok = true;
+    while (GLenum error = glGetError()) {
+        std::cout << "[OpenGl Error] (" << error << "): " << function << " " << file << ":" << line << std::endl;
+        ok = false;
+    }
+    return ok;
+}
+#endif
+
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+/* called by the driver (maybe from its own thread) when something is wrong */
+static void APIENTRY GlDebugCallback(GLenum /*source*/, GLenum type, GLuint id, GLenum severity, GLsizei /*length*/, const GLchar* message, const void* /*userParam*/) {
+
+    const char* level = severity == GL_DEBUG_SEVERITY_HIGH ? "HIGH" : severity == GL_DEBUG_SEVERITY_MEDIUM ? "MEDIUM" : "LOW";
+    std::cout << "[OpenGl Debug] (" << level << (type == GL_DEBUG_TYPE_ERROR ? ", error" : "") << ", id " << id << "): " << message << std::endl;
+}
+#endif
+
+/* call once after glewInit, sets up whatever the chosen policy needs */
+static void SetupGLErrorPolicy() {
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+    if (GLEW_VERSION_4_3 || GLEW_KHR_debug) {
+        glEnable(GL_DEBUG_OUTPUT);
+        glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);     /* driver does not have to report inside the call, so no slow down */
+        glDebugMessageCallback(GlDebugCallback, nullptr);
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);  /* skip info messages */
+        std::cout << "GL errors: async (debug callback)" << std::endl;
+    }
+    else {
+        std::cout << "GL errors: async asked but KHR_debug is not there, errors are not checked" << std::endl;
+    }
+#elif GL_CHECK_POLICY == GL_CHECK_STRICT
+    std::cout << "GL errors: strict (glGetError after every call)" << std::endl;
+#else
+    std::cout << "GL errors: off" << std::endl;
+#endif
+}
+
+
+
+/* ------------- MAPPED FILE ------------- */
+
+/* read only view of a whole file, unmapped in destructor */
+class MappedFile {
+public:
+    MappedFile() = default;
+
+    explicit MappedFile(const std::string& filepath) {
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return;
+
+        LARGE_INTEGER size;
+        if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping) {
+                m_Data = (const char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                CloseHandle(mapping);       /* view keeps the mapping alive */
+            }
+            m_Size = m_Data ? (size_t)size.QuadPart : 0;
+        }
+        m_Open = true;
+        CloseHandle(file);
+#else
+        int fd = open(filepath.c_str(), O_RDONLY);
+        if (fd == -1)
+            return;
+
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            void* data = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED) {
+                m_Data = (const char*)data;
+                m_Size = (size_t)st.st_size;
+            }
+        }
+        m_Open = true;      /* empty file is open but has no mapping (mmap of 0 bytes fails) */
+        close(fd);          /* mapping stays valid after close */
+#endif
+    }
+
+    ~MappedFile() { Unmap(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept { *this = std::move(other); }
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            Unmap();
+            m_Data = other.m_Data; m_Size = other.m_Size; m_Open = other.m_Open;
+            other.m_Data = nullptr; other.m_Size = 0; other.m_Open = false;
+        }
+        return *this;
+    }
+
+    bool IsOpen() const { return m_Open; }
+    std::string_view View() const { return { m_Data, m_Size }; }
+
+private:
+    void Unmap() {
+        if (!m_Data)
+            return;
+#if defined(_WIN32)
+        UnmapViewOfFile(m_Data);
+#else
+        munmap((void*)m_Data, m_Size);
+#endif
+        m_Data = nullptr;
+        m_Size = 0;
+    }
+
+    const char* m_Data = nullptr;
+    size_t m_Size = 0;
+    bool m_Open = false;
+};
+
+
+
+/* ------------- SHADER FILE ------------- */
+
+enum class ShaderStage {
+    Vertex, Fragment, Geometry, TessControl, TessEvaluation, Compute, Count
+};
+
+static const unsigned int STAGE_COUNT = (unsigned int)ShaderStage::Count;
+
+/* same order as ShaderStage */
+static const char* s_StageTags[STAGE_COUNT] = { "vertex", "fragment", "geometry", "tess_control", "tess_evaluation", "compute" };
+static const unsigned int s_StageGLTypes[STAGE_COUNT] = {
+    GL_VERTEX_SHADER, GL_FRAGMENT_SHADER, GL_GEOMETRY_SHADER, GL_TESS_CONTROL_SHADER, GL_TESS_EVALUATION_SHADER, GL_COMPUTE_SHADER
+};
+
+struct ShaderParseError {
+    unsigned int line;      /* 1 based, 0 if it is about the whole file */
+    std::string message;
+};
+
+struct ShaderFile {
+    std::string path;
+    MappedFile file;                                /* owns the memory every stage points into */
+    std::string_view stages[STAGE_COUNT];           /* empty if stage is not in the file */
+    unsigned int firstLine[STAGE_COUNT] = {};       /* file line of the first source line of the stage */
+    std::vector<ShaderParseError> errors;
+
+    bool Has(ShaderStage stage) const { return !stages[(int)stage].empty(); }
+    bool IsValid() const { return errors.empty(); }
+};
+
+
+static bool IsBlank(std::string_view line) {
+    for (char c : line)
+        if (c != ' ' && c != '\t' && c != '\r' && c != '\n')
+            return false;
+    return true;
+}
+
+static std::string_view TrimLeft(std::string_view s) {
+    size_t i = 0;
+    while (i < s.size() && (s[i] == ' ' || s[i] == '\t'))
+        i++;
+    return s.substr(i);
+}
+
+/* first word of 's', stops at space / tab / \r */
+static std::string_view FirstWord(std::string_view s) {
+    s = TrimLeft(s);
+    size_t end = 0;
+    while (end < s.size() && s[end] != ' ' && s[end] != '\t' && s[end] != '\r')
+        end++;
+    return s.substr(0, end);
+}
+
+
+/* single pass over 'source', fills stages, firstLine and errors of 'out' (views point into 'source') */
+static void ParseShaderSource(std::string_view source, ShaderFile& out) {
+
+    const int NONE = -1;
+    int current = NONE;                 /* stage we are inside of, or NONE (before first tag / after bad tag) */
+    size_t stageBegin = 0;
+    unsigned int tagLine[STAGE_COUNT] = {};
+    bool seenTag = false;
+
+    auto closeStage = [&](size_t end) {
+        if (current != NONE)
+            out.stages[current] = source.substr(stageBegin, end - stageBegin);
+    };
+
+    const char* data = source.data();
+    size_t pos = 0;
+    unsigned int lineNumber = 0;
+
+    while (pos < source.size()) {
+        lineNumber++;
+        const char* newline = (const char*)memchr(data + pos, '\n', source.size() - pos);
+        size_t lineEnd = newline ? (size_t)(newline - data) : source.size();
+        size_t next = newline ? lineEnd + 1 : lineEnd;
+        std::string_view line = source.substr(pos, lineEnd - pos);
+
+        std::string_view trimmed = TrimLeft(line);
+        if (trimmed.substr(0, 7) == "#shader") {
+
+            closeStage(pos);
+            current = NONE;
+            seenTag = true;
+
+            std::string_view tag = FirstWord(trimmed.substr(7));
+            int stage = NONE;
+            for (unsigned int i = 0; i < STAGE_COUNT; i++)
+                if (tag == s_StageTags[i])
+                    stage = (int)i;
+
+            if (stage == NONE) {
+                out.errors.push_back({ lineNumber, "unknown shader stage '" + std::string(tag) + "', text till next #shader is ignored" });
+            }
+            else if (tagLine[stage] != 0) {
+                out.errors.push_back({ lineNumber, std::string(s_StageTags[stage]) + " stage is already defined at line " + std::to_string(tagLine[stage]) + ", this one is ignored" });
+            }
+            else {
+                current = stage;
+                tagLine[stage] = lineNumber;
+                stageBegin = next;
+                out.firstLine[stage] = lineNumber + 1;
+            }
+        }
+        else if (!seenTag && !IsBlank(line) && trimmed.substr(0, 2) != "//") {
+            out.errors.push_back({ lineNumber, "text before the first #shader tag is ignored" });   /* old parser wrote this to ss[-1] */
+            seenTag = true;     /* report it only once */
+        }
+
+        pos = next;
+    }
+    closeStage(source.size());
+
+
+    /* ---- checks over the whole file ---- */
+
+    bool any = false, graphics = false;
+    for (unsigned int i = 0; i < STAGE_COUNT; i++) {
+        if (tagLine[i] == 0)
+            continue;
+        any = true;
+        if (i != (unsigned int)ShaderStage::Compute)
+            graphics = true;
+        if (IsBlank(out.stages[i]))
+            out.errors.push_back({ tagLine[i], std::string(s_StageTags[i]) + " stage is empty" });
+    }
+
+    if (!any)
+        out.errors.push_back({ 0, "no #shader tag found" });
+
+    if (graphics && tagLine[(int)ShaderStage::Compute] != 0)
+        out.errors.push_back({ tagLine[(int)ShaderStage::Compute], "compute stage can not be in the same program as graphics stages" });
+
+    if (graphics && (tagLine[(int)ShaderStage::Vertex] == 0 || tagLine[(int)ShaderStage::Fragment] == 0))
+        out.errors.push_back({ 0, "graphics program needs a vertex and a fragment stage" });
+
+    if (tagLine[(int)ShaderStage::TessControl] != 0 && tagLine[(int)ShaderStage::TessEvaluation] == 0)
+        out.errors.push_back({ tagLine[(int)ShaderStage::TessControl], "tess_control stage without tess_evaluation stage" });
+}
+
+
+/* maps the file and parses it, the returned ShaderFile owns the mapping */
+static ShaderFile ParseShaderFile(const std::string& filepath) {
+    ShaderFile out;
+    out.path = filepath;
+    out.file = MappedFile(filepath);
+
+    if (!out.file.IsOpen()) {
+        out.errors.push_back({ 0, "can not open file" });
+        return out;
+    }
+
+    ParseShaderSource(out.file.View(), out);
+    return out;
+}
+
+static void PrintParseErrors(const ShaderFile& shader) {
+    for (const ShaderParseError& e : shader.errors)
+        std::cout << "[Shader Parse] " << shader.path << ":" << e.line << ": " << e.message << std::endl;
+}
+
+
+
+
+
+/* ------------- HASH ------------- */
+
+/* FNV-1a 64 bit */
+static uint64_t HashBytes(const void* data, size_t size, uint64_t hash = 14695981039346656037ull) {
+    const unsigned char* bytes = (const unsigned char*)data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+static uint64_t HashString(const std::string& s, uint64_t hash = 14695981039346656037ull) {
+    hash = HashBytes(s.data(), s.size(), hash);
+    return HashBytes("\0", 1, hash);        /* separator so "ab"+"c" and "a"+"bc" are different */
+}
+
+
+
+/* ------------- PREPROCESSOR ------------- */
+
+struct ShaderDefine {
+    std::string name;
+    std::string value;      /* empty -> just "#define NAME" */
+};
+
+using ShaderDefines = std::vector<ShaderDefine>;
+
+/* sorted by name, if a name is there 2 times the last one wins */
+static ShaderDefines CanonicalDefines(const ShaderDefines& defines) {
+    ShaderDefines sorted;
+    for (const ShaderDefine& d : defines) {
+        auto it = std::find_if(sorted.begin(), sorted.end(), [&](const ShaderDefine& s) { return s.name == d.name; });
+        if (it != sorted.end())
+            it->value = d.value;
+        else
+            sorted.push_back(d);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const ShaderDefine& a, const ShaderDefine& b) { return a.name < b.name; });
+    return sorted;
+}
+
+static bool IsIdentifier(const std::string& name) {
+    if (name.empty() || (name[0] >= '0' && name[0] <= '9'))
+        return false;
+    for (char c : name)
+        if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_'))
+            return false;
+    return true;
+}
+
+
+/* every stage after #include and #define are resolved, owns its text */
+struct ExpandedShader {
+    std::string path;
+    std::string stages[STAGE_COUNT];
+    bool has[STAGE_COUNT] = {};
+    std::vector<std::string> sourceFiles[STAGE_COUNT];     /* per stage, index = source string number in #line, 0 is the .shader file */
+    std::vector<std::string> errors;            /* "file:line: message" */
+    uint64_t hash = 0;                          /* of every stage text */
+
+    bool IsValid() const { return errors.empty(); }
+};
+
+
+class ShaderPreprocessor {
+public:
+    /* false if the file or one of its includes has errors (they are in out.errors) */
+    bool Expand(const std::string& filepath, const ShaderDefines& defines, ExpandedShader& out) {
+
+        out = ExpandedShader();
+        out.path = filepath;
+
+        const ShaderFile& shader = LoadShaderFile(filepath);
+        for (const ShaderParseError& e : shader.errors)
+            out.errors.push_back(filepath + ":" + std::to_string(e.line) + ": " + e.message);
+        if (!shader.IsValid())
+            return false;
+
+        std::string defineText;
+        for (const ShaderDefine& d : CanonicalDefines(defines)) {
+            if (!IsIdentifier(d.name)) {
+                out.errors.push_back(filepath + ":0: bad define name '" + d.name + "'");
+                continue;
+            }
+            defineText += "#define " + d.name + (d.value.empty() ? "" : " " + d.value) + "\n";
+        }
+
+        std::string directory = std::filesystem::path(filepath).parent_path().string();
+        out.hash = 14695981039346656037ull;
+
+        for (unsigned int i = 0; i < STAGE_COUNT; i++) {
+            if (!shader.Has((ShaderStage)i))
+                continue;
+
+            out.sourceFiles[i].push_back(filepath);
+            std::vector<std::string> included;
+
+            StageState state{ out, out.stages[i], out.sourceFiles[i], included, defineText, false };
+            ExpandText(shader.stages[i], shader.firstLine[i], 0, directory, true, state);
+            if (!state.definesWritten)                  /* stage was only comments / blank lines */
+                out.stages[i] += defineText;
+
+            out.has[i] = true;
+            out.hash = HashString(out.stages[i], HashBytes(&i, sizeof(i), out.hash));
+        }
+
+        return out.IsValid();
+    }
+
+    /* drops every mapped file, next Expand reads them again (for when files change on disk) */
+    void ClearFileCache() {
+        m_ShaderFiles.clear();
+        m_Includes.clear();
+    }
+
+    /* drops one file (.shader or include), path as it is in ExpandedShader::sourceFiles */
+    void Invalidate(const std::string& filepath) {
+        m_ShaderFiles.erase(filepath);
+        m_Includes.erase(filepath);
+    }
+
+    unsigned int GetFilesRead() const { return m_FilesRead; }
+
+private:
+    struct StageState {
+        ExpandedShader& out;
+        std::string& text;
+        std::vector<std::string>& sourceFiles;
+        std::vector<std::string>& included;     /* normalized paths already in this stage */
+        const std::string& defineText;
+        bool definesWritten;
+    };
+
+    const ShaderFile& LoadShaderFile(const std::string& filepath) {
+        auto it = m_ShaderFiles.find(filepath);
+        if (it == m_ShaderFiles.end()) {
+            it = m_ShaderFiles.emplace(filepath, std::make_unique<ShaderFile>(ParseShaderFile(filepath))).first;
+            m_FilesRead++;
+        }
+        return *it->second;
+    }
+
+    /* nullptr when the file can not be opened, that is not cached so the next Expand tries again */
+    const MappedFile* LoadInclude(const std::string& filepath) {
+        auto it = m_Includes.find(filepath);
+        if (it == m_Includes.end()) {
+            MappedFile file(filepath);
+            m_FilesRead++;
+            if (!file.IsOpen())
+                return nullptr;
+            it = m_Includes.emplace(filepath, std::move(file)).first;
+        }
+        return &it->second;
+    }
+
+    /* copies 'text' line by line into state.text, replacing #include / #pragma once, writes defines after #version of the root */
+    void ExpandText(std::string_view text, unsigned int firstLine, unsigned int sourceIndex, const std::string& directory, bool isRoot, StageState& state) {
+
+        const std::string file = state.sourceFiles[sourceIndex];      /* copy, the vector grows while includes are added */
+        const char* data = text.data();
+        size_t pos = 0;
+        unsigned int lineNumber = firstLine - 1;
+
+        while (pos < text.size()) {
+            lineNumber++;
+            const char* newline = (const char*)memchr(data + pos, '\n', text.size() - pos);
+            size_t lineEnd = newline ? (size_t)(newline - data) : text.size();
+            std::string_view line = text.substr(pos, lineEnd - pos);
+            pos = newline ? lineEnd + 1 : lineEnd;
+
+            if (!line.empty() && line.back() == '\r')       /* same text (and hash) for CRLF and LF files */
+                line.remove_suffix(1);
+
+            std::string_view trimmed = TrimLeft(line);
+
+            /* root stage: defines go after #version, or before first real line if there is no #version */
+            if (isRoot && !state.definesWritten && !IsBlank(line) && trimmed.substr(0, 2) != "//") {
+                bool version = trimmed.substr(0, 8) == "#version";
+                if (version) {
+                    state.text.append(line.data(), line.size());
+                    state.text += '\n';
+                }
+                state.text += state.defineText;
+                state.text += "#line " + std::to_string(version ? lineNumber + 1 : lineNumber) + " " + std::to_string(sourceIndex) + "\n";
+                state.definesWritten = true;
+                if (version)
+                    continue;
+            }
+
+            if (trimmed.substr(0, 8) == "#include") {
+                IncludeFile(trimmed.substr(8), file, lineNumber, sourceIndex, directory, state);
+                continue;
+            }
+
+            if (!isRoot && trimmed.substr(0, 8) == "#version") {
+                state.out.errors.push_back(file + ":" + std::to_string(lineNumber) + ": #version in an included file");
+                state.text += '\n';
+                continue;
+            }
+
+            if (!isRoot && trimmed.substr(0, 7) == "#pragma" && FirstWord(trimmed.substr(7)) == "once") {
+                state.text += '\n';     /* every include is once anyway, keep the line so numbers do not move */
+                continue;
+            }
+
+            state.text.append(line.data(), line.size());
+            state.text += '\n';
+        }
+    }
+
+    void IncludeFile(std::string_view rest, const std::string& file, unsigned int lineNumber, unsigned int sourceIndex, const std::string& directory, StageState& state) {
+
+        std::string where = file + ":" + std::to_string(lineNumber) + ": ";
+
+        rest = TrimLeft(rest);
+        char close = rest.empty() ? 0 : rest[0] == '"' ? '"' : rest[0] == '<' ? '>' : 0;
+        size_t end = close ? rest.find(close, 1) : std::string_view::npos;
+        if (end == std::string_view::npos || end == 1) {
+            state.out.errors.push_back(where + "#include needs a \"file\" or <file>");
+            state.text += '\n';
+            return;
+        }
+
+        std::string path = (std::filesystem::path(directory) / std::string(rest.substr(1, end - 1))).lexically_normal().string();
+
+        if (std::find(state.included.begin(), state.included.end(), path) != state.included.end()) {
+            state.text += '\n';         /* already in this stage */
+            return;
+        }
+
+        const MappedFile* include = LoadInclude(path);
+        if (!include) {
+            state.out.errors.push_back(where + "can not open include '" + path + "'");
+            state.sourceFiles.push_back(path);      /* still a dependency, creating / fixing the file reloads the shader */
+            state.text += '\n';
+            return;
+        }
+
+        state.included.push_back(path);
+        state.sourceFiles.push_back(path);
+        unsigned int includeIndex = (unsigned int)state.sourceFiles.size() - 1;
+
+        state.text += "#line 1 " + std::to_string(includeIndex) + "\n";
+        ExpandText(include->View(), 1, includeIndex, std::filesystem::path(path).parent_path().string(), false, state);
+        state.text += "#line " + std::to_string(lineNumber + 1) + " " + std::to_string(sourceIndex) + "\n";
+    }
+
+    std::unordered_map<std::string, std::unique_ptr<ShaderFile>> m_ShaderFiles;     /* unique_ptr so the stage views never move */
+    std::unordered_map<std::string, MappedFile> m_Includes;
+    unsigned int m_FilesRead = 0;
+};
+
+
+
+
+
+
+/* ------------- HOT RELOADER ------------- */
+
+static unsigned int CreateProgram(const ExpandedShader& shader);
+
+using Clock = std::chrono::steady_clock;
+
+static double MsBetween(Clock::time_point a, Clock::time_point b) {
+    return std::chrono::duration<double, std::milli>(b - a).count();
+}
+
+class ShaderHotReloader {
+public:
+    ShaderHotReloader() = default;
+
+    ~ShaderHotReloader() {
+        Stop();
+        for (Entry& e : m_Entries)
+            if (e.program)
+                glDeleteProgram(e.program);
+    }
+
+    ShaderHotReloader(const ShaderHotReloader&) = delete;
+    ShaderHotReloader& operator=(const ShaderHotReloader&) = delete;
+
+    /* builds the program now (main thread), call before Start(). returns id for Get() */
+    unsigned int Add(const std::string& filepath, const ShaderDefines& defines = {}) {
+        Entry e;
+        e.path = std::filesystem::path(filepath).lexically_normal().string();
+        e.defines = defines;
+
+        ExpandedShader expanded;
+        if (m_Preprocessor.Expand(e.path, e.defines, expanded))
+            e.program = CreateProgram(expanded);
+        else
+            PrintErrors(expanded);
+
+        e.files = DependencyFiles(expanded, e.path);
+        m_Entries.push_back(e);
+        return (unsigned int)m_Entries.size() - 1;
+    }
+
+    /* current program, 0 if it never built. can change after Update() */
+    unsigned int Get(unsigned int id) const { return m_Entries[id].program; }
+
+    void Start() {
+        m_Running = true;
+        m_Thread = std::thread(&ShaderHotReloader::WatchLoop, this);
+    }
+
+    void Stop() {
+        m_Running = false;
+        if (m_Thread.joinable())
+            m_Thread.join();
+    }
+
+    /* call once per frame (between frames): compiles what the watcher prepared and swaps programs, returns number swapped */
+    unsigned int Update() {
+        std::vector<Reparsed> ready;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            ready.swap(m_Ready);
+        }
+
+        unsigned int swapped = 0;
+        for (Reparsed& r : ready) {
+            Entry& e = m_Entries[r.id];
+
+            if (!r.source.IsValid()) {
+                PrintErrors(r.source);
+                std::cout << "[Reload] " << e.path << " has errors, keeping old program" << std::endl;
+                continue;
+            }
+
+            auto start = Clock::now();
+            unsigned int program = CreateProgram(r.source);
+            auto end = Clock::now();
+
+            if (!program) {
+                std::cout << "[Reload] " << e.path << " did not compile, keeping old program" << std::endl;
+                continue;
+            }
+
+            if (e.program)
+                glDeleteProgram(e.program);
+            e.program = program;
+            swapped++;
+
+            std::cout << "[Reload] " << e.path << " (changed: " << r.changed << "): parse " << r.parseMs << " ms (watcher thread), compile "
+                      << MsBetween(start, end) << " ms, event to swap " << MsBetween(r.eventTime, end) << " ms" << std::endl;
+        }
+        return swapped;
+    }
+
+private:
+    struct Entry {
+        std::string path;
+        ShaderDefines defines;
+        unsigned int program = 0;           /* main thread only */
+        std::vector<std::string> files;     /* watcher thread only after Start() */
+    };
+
+    /* made on the watcher thread, compiled on the main thread */
+    struct Reparsed {
+        unsigned int id;
+        ExpandedShader source;
+        std::string changed;
+        double parseMs;
+        Clock::time_point eventTime;
+    };
+
+    /* .shader file + every include of every stage, no duplicates */
+    static std::vector<std::string> DependencyFiles(const ExpandedShader& expanded, const std::string& path) {
+        std::vector<std::string> files{ path };
+        for (unsigned int i = 0; i < STAGE_COUNT; i++)
+            for (const std::string& f : expanded.sourceFiles[i])
+                if (std::find(files.begin(), files.end(), f) == files.end())
+                    files.push_back(f);
+        return files;
+    }
+
+    static void PrintErrors(const ExpandedShader& expanded) {
+        for (const std::string& e : expanded.errors)
+            std::cout << "[Shader Preprocess] " << e << std::endl;
+    }
+
+    /* watcher thread: the files changed at 'eventTime', reparse every program which uses one of them */
+    void Reparse(const std::vector<std::string>& changed, Clock::time_point eventTime) {
+
+        for (const std::string& f : changed)
+            m_Preprocessor.Invalidate(f);
+
+        for (unsigned int id = 0; id < m_Entries.size(); id++) {
+            Entry& e = m_Entries[id];
+
+            std::string hit;
+            for (const std::string& f : changed)
+                if (std::find(e.files.begin(), e.files.end(), f) != e.files.end())
+                    hit += (hit.empty() ? "" : ", ") + f;
+            if (hit.empty())
+                continue;
+
+            Reparsed r;
+            r.id = id;
+            r.changed = hit;
+            r.eventTime = eventTime;
+
+            auto start = Clock::now();
+            m_Preprocessor.Expand(e.path, e.defines, r.source);
+            r.parseMs = MsBetween(start, Clock::now());
+
+            /* includes can be added or removed by the edit, keep old ones too so a broken save does not lose them */
+            for (const std::string& f : DependencyFiles(r.source, e.path))
+                if (std::find(e.files.begin(), e.files.end(), f) == e.files.end())
+                    e.files.push_back(f);
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Ready.push_back(std::move(r));
+        }
+    }
+
+    /* folders of every dependency, inotify is not recursive so each one is watched */
+    std::vector<std::string> WatchedDirectories() const {
+        std::vector<std::string> dirs;
+        for (const Entry& e : m_Entries)
+            for (const std::string& f : e.files) {
+                std::string dir = std::filesystem::path(f).parent_path().string();
+                if (dir.empty())
+                    dir = ".";
+                if (std::find(dirs.begin(), dirs.end(), dir) == dirs.end())
+                    dirs.push_back(dir);
+            }
+        return dirs;
+    }
+
+#if defined(__linux__)
+    void WatchLoop() {
+        int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (fd == -1) {
+            std::cout << "[Reload] inotify_init1 failed, hot reload is off" << std::endl;
+            return;
+        }
+
+        std::unordered_map<int, std::string> watches;      /* watch descriptor -> folder */
+        auto addWatches = [&]() {
+            for (const std::string& dir : WatchedDirectories()) {
+                int wd = inotify_add_watch(fd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+                if (wd != -1)
+                    watches[wd] = dir == "." ? "" : dir;        /* same wd again if folder is already watched */
+            }
+        };
+        addWatches();
+        std::cout << "[Reload] watching " << watches.size() << " folder(s) with inotify" << std::endl;
+
+        std::vector<std::string> changed;
+        Clock::time_point firstEvent, lastEvent;
+        alignas(struct inotify_event) char buffer[4096];
+
+        while (m_Running) {
+            pollfd p{ fd, POLLIN, 0 };
+            int n = poll(&p, 1, 20);        /* short timeout so Stop() does not wait long */
+
+            if (n > 0) {
+                ssize_t length;
+                while ((length = read(fd, buffer, sizeof(buffer))) > 0) {
+                    for (char* ptr = buffer; ptr < buffer + length; ) {
+                        const inotify_event* event = (const inotify_event*)ptr;
+                        ptr += sizeof(inotify_event) + event->len;
+
+                        auto dir = watches.find(event->wd);
+                        if (event->len == 0 || dir == watches.end())
+                            continue;
+
+                        std::string path = (std::filesystem::path(dir->second) / event->name).lexically_normal().string();
+                        if (std::find(changed.begin(), changed.end(), path) == changed.end())
+                            changed.push_back(path);
+                        if (changed.size() == 1)
+                            firstEvent = Clock::now();
+                        lastEvent = Clock::now();
+                    }
+                }
+            }
+
+            /* wait till the save is over (no event for 50 ms) */
+            if (!changed.empty() && MsBetween(lastEvent, Clock::now()) > 50.0) {
+                Reparse(changed, firstEvent);
+                changed.clear();
+                addWatches();       /* a new include can be in a new folder */
+            }
+        }
+
+        close(fd);
+    }
+#else
+    /* no inotify, compare last write times */
+    void WatchLoop() {
+        std::unordered_map<std::string, std::filesystem::file_time_type> times;
+        auto scan = [&](std::vector<std::string>* changed) {
+            for (const Entry& e : m_Entries)
+                for (const std::string& f : e.files) {
+                    std::error_code ec;
+                    auto t = std::filesystem::last_write_time(f, ec);
+                    if (ec)
+                        continue;
+                    auto it = times.find(f);
+                    if (it != times.end() && it->second != t && changed &&
+                        std::find(changed->begin(), changed->end(), f) == changed->end())
+                        changed->push_back(f);
+                    times[f] = t;
+                }
+        };
+        scan(nullptr);
+        std::cout << "[Reload] watching " << times.size() << " file(s) by last write time" << std::endl;
+
+        while (m_Running) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(250));
+            std::vector<std::string> changed;
+            scan(&changed);
+            if (!changed.empty())
+                Reparse(changed, Clock::now());
+        }
+    }
+#endif
+
+    ShaderPreprocessor m_Preprocessor;      /* main thread before Start(), watcher thread after */
+    std::vector<Entry> m_Entries;           /* no Add() after Start(), so the vector never moves */
+
+    std::thread m_Thread;
+    std::atomic<bool> m_Running{ false };
+
+    std::mutex m_Mutex;
+    std::vector<Reparsed> m_Ready;
+};
+
+
+
+int main(void)
+{
+    /* GLFW BASIC STUFF */
+        GLFWwindow* window;
+
+        /* Initialize the GLFW library */
+        if (!glfwInit())
+            return -1;
+
+
+        /* setting version 3.3 and core profile (i.e mordern opengl) */
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);    /* most drivers only send debug messages in debug context */
+#endif
+
+
+        /* Create a windowed mode window and its OpenGL context */
+        window = glfwCreateWindow(640, 480, "Hello World", NULL, NULL);
+        if (!window)
+        {
+            glfwTerminate();
+            return -1;
+
+        }
+        /* Make the window's context current */
+        glfwMakeContextCurrent(window);
+
+        glfwSwapInterval(1);    /* controls FPS or intervel between buffer(frames) */
+
+    /*  END BASIC GLFW   */
+
+
+    /* Intitialize GLEW */
+        if (glewInit() != GLEW_OK) {
+            std::cout << "Error!" << std::endl;
+        }
+    /* END */
+
+    std::cout << glGetString(GL_VERSION) << std::endl;  /* prints the version of opengl using */
+
+    SetupGLErrorPolicy();
+
+
+    { /* scope so that the reloader stops its thread and deletes its programs before glfwTerminate destroys the context */
+
+    /* ------------- Generating Data to be used to display in the window ------------- */
+
+            // 4 positions of vertices of sqaure
+            float positions[] = {
+                -0.5f, -0.5f,    // 0
+                 0.5f, -0.5f,    // 1
+                 0.5f,  0.5f,    // 2
+                -0.5f,  0.5f     // 3
+            };
+
+            // Index data -----> position in which vertices is to be rendered to form a square
+            unsigned int indices[] = {
+                0, 1, 2,
+                2, 3, 0
+            };
+
+            unsigned int vao;
+            GLCall(glGenVertexArrays(1, &vao));
+            GLCall(glBindVertexArray(vao));
+
+            unsigned int buffer;
+            GLCall(glGenBuffers(1, &buffer));
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, buffer));
+            GLCall(glBufferData(GL_ARRAY_BUFFER, 4 * 2 * sizeof(float), positions, GL_STATIC_DRAW));
+
+            GLCall(glEnableVertexAttribArray(0));
+            GLCall(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2, 0));
+
+            unsigned int ibo;       // index buffer object
+            GLCall(glGenBuffers(1, &ibo));
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo));
+            GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, 6 * sizeof(unsigned int), indices, GL_STATIC_DRAW));
+
+            GLCall(glBindVertexArray(0));
+
+
+        ShaderHotReloader reloader;
+        std::vector<unsigned int> ids = {
+            reloader.Add("res/shaders/Basic - UNFORMS.shader"),
+            reloader.Add("res/shaders/Basic - FEATURES.shader", { { "USE_UNIFORM_COLOR", "" } }),
+            reloader.Add("res/shaders/Basic - FEATURES.shader", { { "USE_UNIFORM_COLOR", "" }, { "GRAYSCALE", "" } })
+        };
+        reloader.Start();
+
+        /* u_Color location is looked up again only when a program was swapped */
+        std::vector<unsigned int> shown(ids.size(), 0);
+        std::vector<int> locations(ids.size(), -1);
+
+
+    /* ------------- END OF GENERATING DATA ------------- */
+
+
+    /* ----------- Animation Variable ----------- */
+    float r = 0.0f;
+    float increment = 0.05f;
+
+
+
+    /* WHILE Loop to keep the window active till window is closed */
+    while (!glfwWindowShouldClose(window))
+    {
+        /* frame boundary -> every program the watcher reparsed is compiled and swapped here */
+        reloader.Update();
+
+        /* Render here */
+
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        int width, height;
+        glfwGetFramebufferSize(window, &width, &height);
+
+        /* one square per program, side by side */
+        GLCall(glBindVertexArray(vao));
+        for (unsigned int i = 0; i < ids.size(); i++) {
+            unsigned int program = reloader.Get(ids[i]);
+            if (!program)
+                continue;
+
+            if (program != shown[i]) {
+                shown[i] = program;
+                GLCall(locations[i] = glGetUniformLocation(program, "u_Color"));
+            }
+
+            GLCall(glViewport(i * width / (int)ids.size(), 0, width / (int)ids.size(), height));
+            GLCall(glUseProgram(program));
+            if (locations[i] != -1) {
+                GLCall(glUniform4f(locations[i], r, 0.2f, 0.5f, 1.0f));
+            }
+            GLCall(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr));
+        }
+        GLCall(glViewport(0, 0, width, height));
+
+        if (r > 1.0f)
+            increment = -0.05f;
+        else if (r < 0.0f)
+            increment = 0.05f;
+
+        r += increment;
+
+
+        /* Swap front and back buffers */
+        glfwSwapBuffers(window);
+
+        /* Poll for and process events */
+        glfwPollEvents();
+    }
+
+    glDeleteBuffers(1, &buffer);
+    glDeleteBuffers(1, &ibo);
+    glDeleteVertexArrays(1, &vao);
+
+    }
+
+    glfwTerminate();
+    return 0;
+}
+
+
+
+
+/* Makes and compile one stage of the expanded shader */
+static unsigned int CompileShader(ShaderStage stage, const ExpandedShader& shader) {
+
+    const std::string& source = shader.stages[(int)stage];
+    unsigned int id = glCreateShader(s_StageGLTypes[(int)stage]);   /* generate Shader and return id */
+    const char* src = source.c_str();
+    GLCall(glShaderSource(id, 1, &src, nullptr));           /* attaching source code to the shader */
+    GLCall(glCompileShader(id));                            /* compile shader */
+
+    /* -------- ERROR HANDLING -------- */
+        int result;
+        GLCall(glGetShaderiv(id, GL_COMPILE_STATUS, &result));
+        if (result == GL_FALSE) {
+            int length;
+            GLCall(glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length));
+            std::vector<char> message(length + 1);
+            GLCall(glGetShaderInfoLog(id, length, &length, message.data()));
+
+            std::cout << "Failed To Compile " << s_StageTags[(int)stage] << " shader of " << shader.path << std::endl;
+            std::cout << message.data() << std::endl;
+
+            /* error lines look like "source:line", this says which file each source number is */
+            const std::vector<std::string>& files = shader.sourceFiles[(int)stage];
+            for (size_t i = 0; i < files.size(); i++)
+                std::cout << "  source " << i << " = " << files[i] << std::endl;
+
+            GLCall(glDeleteShader(id));
+            return 0;
+        }
+
+    /* -------- END ERROR HANDLING -------- */
+
+    return id;
+
+}
+
+
+/* Creates a program with every stage of the expanded shader, 0 if a stage did not compile or link failed */
+static unsigned int CreateProgram(const ExpandedShader& shader) {
+
+    GLCall(unsigned int program = glCreateProgram());
+
+    unsigned int ids[STAGE_COUNT] = {};
+    bool ok = true;
+    for (unsigned int i = 0; i < STAGE_COUNT; i++) {
+        if (!shader.has[i])
+            continue;
+        ids[i] = CompileShader((ShaderStage)i, shader);
+        if (ids[i] == 0) {
+            ok = false;
+            continue;
+        }
+        GLCall(glAttachShader(program, ids[i]));
+    }
+
+    if (ok) {
+        GLCall(glLinkProgram(program));
+        int linked;
+        GLCall(glGetProgramiv(program, GL_LINK_STATUS, &linked));
+        if (linked == GL_FALSE) {
+            int length;
+            GLCall(glGetProgramiv(program, GL_INFO_LOG_LENGTH, &length));
+            std::vector<char> message(length + 1);
+            GLCall(glGetProgramInfoLog(program, length, &length, message.data()));
+            std::cout << "Failed To Link " << shader.path << std::endl << message.data() << std::endl;
+            ok = false;
+        }
+    }
+
+    for (unsigned int id : ids) {
+        if (id) {
+            GLCall(glDeleteShader(id));         /* DELETING shader to save space as shader is already attached to program */
+        }
+    }
+
+    if (!ok) {
+        GLCall(glDeleteProgram(program));
+        return 0;
+    }
+    return program;
+
+}
@@ -0,0 +1,660 @@
+/*
+
+Uniform Reflection (cached location table per program)
+
+HW_7 - HW_10 ask glGetUniformLocation(shader, "u_Color") with a string, with many uniforms and objects
+this is a string compare inside the driver for every uniform every frame
+
+after linking the program can tell us everything it has
+
+---> glGetActiveUniform / glGetActiveAttrib give name, type and array size of every ACTIVE uniform / attribute
+     (active = really used, a uniform the shader never reads is removed by the linker)
+---> ProgramReflection asks this once and keeps it in a flat hash table (open addressing, linear probing)
+     keyed by a 32 bit FNV-1a hash of the name
+---> HashName is constexpr, so  constexpr uint32_t U_COLOR = HashName("u_Color");  is computed by the compiler
+     and setting a uniform is a table lookup with an integer, no strings at runtime
+---> arrays can be found as "u_Tint" and "u_Tint[0]"
+---> typed setters (SetUniform4f, ...) check the type against the reflected one and print a mismatch once
+---> setting a uniform which is not in the program (optimized away, or typo) does nothing
+     instead of ASSERT(location != -1) stopping the app
+
+setters use glUniform* so the program has to be bound (glUseProgram) like before
+
+at start the table is printed and the cost of 1M lookups is measured for glGetUniformLocation vs the table
+
+*/
+
+
+
+
+#include <GL\glew.h>
+
+#include <GLFW/glfw3.h>
+
+
+#include <iostream>
+#include <fstream>  // to read file
+#include <string>   // To use getline func
+#include <string_view>
+#include <sstream>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <math.h>
+
+
+/* ------------ ERROR CHECK POLICY ------------ */
+/*
+GL_CHECK_NONE   -> GLCall(x) is just x, nothing is checked (release)
+GL_CHECK_ASYNC  -> GLCall(x) is just x, driver reports errors later through glDebugMessageCallback (needs KHR_debug / GL 4.3)
+GL_CHECK_STRICT -> glGetError before and after every call, stops on the line with the error (old GLCall)
+
+default is NONE for release (NDEBUG) and STRICT for debug, or pass -DGL_CHECK_POLICY=1 to compiler to choose
+*/
+#define GL_CHECK_NONE   0
+#define GL_CHECK_ASYNC  1
+#define GL_CHECK_STRICT 2
+
+#ifndef GL_CHECK_POLICY
+    #ifdef NDEBUG
+        #define GL_CHECK_POLICY GL_CHECK_NONE
+    #else
+        #define GL_CHECK_POLICY GL_CHECK_STRICT
+    #endif
+#endif
+
+
+/* ------------ MACRO ------------ */
+
+/* __debugbreak is only in MSVC, on gcc / clang SIGTRAP does same thing (debugger stops there) */
+#if defined(_MSC_VER)
+    #define DEBUG_BREAK() __debugbreak()
+#elif defined(__GNUC__) || defined(__clang__)
+    #include <signal.h>
+    #define DEBUG_BREAK() raise(SIGTRAP)
+#else
+    #include <cstdlib>
+    #define DEBUG_BREAK() std::abort()
+#endif
+
+#define ASSERT(x) if (!(x)) DEBUG_BREAK();
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+    #define GLCall(x) GLCLearError();\
+        x;\
+        ASSERT(GlLogCall(#x, __FILE__, __LINE__))
+#else
+    #define GLCall(x) x
+#endif
+
+/*
+# before a fucntion pass it as a stringand __FILE__and __LINE__ are macros to get file loc and line of fucntion
+and since MACROS HAS TO BE IN SAME LINE we use \ before line ends to write macros in multiple lines
+*/
+
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+static void GLCLearError() {
+    while (glGetError() != GL_NO_ERROR);    // glGetError get error and we get all the error until there are no arror left
+}
+
+static bool GlLogCall(const char* function, const char* file, int line) {
+    bool ok = true;
+    while (GLenum error = glGetError()) {
+        std::cout << "[OpenGl Error] (" << error << "): " << function << " " << file << ":" << line << std::endl;
+        ok = false;
+    }
+    return ok;
+}
+#endif
+
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+/* called by the driver (maybe from its own thread) when something is wrong */
+static void APIENTRY GlDebugCallback(GLenum /*source*/, GLenum type, GLuint id, GLenum severity, GLsizei /*length*/, const GLchar* message, const void* /*userParam*/) {
+
+    const char* level = severity == GL_DEBUG_SEVERITY_HIGH ? "HIGH" : severity == GL_DEBUG_SEVERITY_MEDIUM ? "MEDIUM" : "LOW";
+    std::cout << "[OpenGl Debug] (" << level << (type == GL_DEBUG_TYPE_ERROR ? ", error" : "") << ", id " << id << "): " << message << std::endl;
+}
+#endif
+
+/* call once after glewInit, sets up whatever the chosen policy needs */
+static void SetupGLErrorPolicy() {
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+    if (GLEW_VERSION_4_3 || GLEW_KHR_debug) {
+        glEnable(GL_DEBUG_OUTPUT);
+        glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);     /* driver does not have to report inside the call, so no slow down */
+        glDebugMessageCallback(GlDebugCallback, nullptr);
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);  /* skip info messages */
+        std::cout << "GL errors: async (debug callback)" << std::endl;
+    }
+    else {
+        std::cout << "GL errors: async asked but KHR_debug is not there, errors are not checked" << std::endl;
+    }
+#elif GL_CHECK_POLICY == GL_CHECK_STRICT
+    std::cout << "GL errors: strict (glGetError after every call)" << std::endl;
+#else
+    std::cout << "GL errors: off" << std::endl;
+#endif
+}
+
+
+
+struct ShaderProgramSource {
+    std::string VertexSource;
+    std::string FragmentSource;
+};
+
+static ShaderProgramSource ParseShader(const std::string& filepath);
+
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader);
+
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source);
+
+
+
+/* ------------- REFLECTION ------------- */
+
+/* FNV-1a 32 bit, constexpr so names used in code are hashed at compile time */
+constexpr uint32_t HashName(std::string_view name) {
+    uint32_t hash = 2166136261u;
+    for (char c : name) {
+        hash ^= (unsigned char)c;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static const char* GLTypeName(unsigned int type) {
+    switch (type) {
+        case GL_FLOAT:          return "float";
+        case GL_FLOAT_VEC2:     return "vec2";
+        case GL_FLOAT_VEC3:     return "vec3";
+        case GL_FLOAT_VEC4:     return "vec4";
+        case GL_INT:            return "int";
+        case GL_INT_VEC2:       return "ivec2";
+        case GL_INT_VEC3:       return "ivec3";
+        case GL_INT_VEC4:       return "ivec4";
+        case GL_UNSIGNED_INT:   return "uint";
+        case GL_BOOL:           return "bool";
+        case GL_FLOAT_MAT3:     return "mat3";
+        case GL_FLOAT_MAT4:     return "mat4";
+        case GL_SAMPLER_2D:     return "sampler2D";
+        case GL_SAMPLER_CUBE:   return "samplerCube";
+        default:                return "other";
+    }
+}
+
+static bool IsSampler(unsigned int type) {
+    return type == GL_SAMPLER_1D || type == GL_SAMPLER_2D || type == GL_SAMPLER_3D || type == GL_SAMPLER_CUBE ||
+           type == GL_SAMPLER_2D_ARRAY || type == GL_SAMPLER_2D_SHADOW || type == GL_SAMPLER_BUFFER;
+}
+
+
+/* one active uniform or attribute */
+struct ShaderVariable {
+    uint32_t hash;
+    int location;
+    unsigned int type;      /* GL_FLOAT_VEC4, ... */
+    int size;               /* array length, 1 if not an array */
+    std::string name;       /* arrays are there 2 times, "u_Tint" and "u_Tint[0]" */
+    bool typeWarned;        /* mismatch printed already */
+};
+
+/* flat hash table: variables in one vector, slots hold their index (-1 = empty), size is power of 2 */
+class VariableTable {
+public:
+    void Build(std::vector<ShaderVariable> variables) {
+        m_Variables = std::move(variables);
+
+        size_t capacity = 8;
+        while (capacity < m_Variables.size() * 2)       /* at most half full, probes stay short */
+            capacity *= 2;
+        m_Slots.assign(capacity, -1);
+        m_Mask = (uint32_t)capacity - 1;
+
+        for (int i = 0; i < (int)m_Variables.size(); i++) {
+            uint32_t slot = m_Variables[i].hash & m_Mask;
+            while (m_Slots[slot] != -1) {
+                if (m_Variables[m_Slots[slot]].hash == m_Variables[i].hash)
+                    std::cout << "[Reflection] hash collision: " << m_Variables[m_Slots[slot]].name << " and " << m_Variables[i].name << std::endl;
+                slot = (slot + 1) & m_Mask;
+            }
+            m_Slots[slot] = i;
+        }
+    }
+
+    /* nullptr if not there */
+    ShaderVariable* Find(uint32_t hash) {
+        if (m_Slots.empty())
+            return nullptr;
+        uint32_t slot = hash & m_Mask;
+        while (m_Slots[slot] != -1) {
+            ShaderVariable& v = m_Variables[m_Slots[slot]];
+            if (v.hash == hash)
+                return &v;
+            slot = (slot + 1) & m_Mask;
+        }
+        return nullptr;
+    }
+
+    const std::vector<ShaderVariable>& GetAll() const { return m_Variables; }
+
+private:
+    std::vector<ShaderVariable> m_Variables;
+    std::vector<int> m_Slots;
+    uint32_t m_Mask = 0;
+};
+
+
+/* owns a linked program and what it has inside, setters take precomputed name hashes */
+class ShaderProgram {
+public:
+    explicit ShaderProgram(unsigned int program)
+        : m_Program(program) {
+        if (m_Program)
+            Reflect();
+    }
+
+    ~ShaderProgram() {
+        if (m_Program)
+            glDeleteProgram(m_Program);
+    }
+
+    ShaderProgram(const ShaderProgram&) = delete;
+    ShaderProgram& operator=(const ShaderProgram&) = delete;
+
+    unsigned int GetID() const { return m_Program; }
+    void Bind() const { GLCall(glUseProgram(m_Program)); }
+
+    /* -1 if not active (same as glGetUniformLocation / glGetAttribLocation) */
+    int GetUniformLocation(uint32_t nameHash) {
+        ShaderVariable* u = m_Uniforms.Find(nameHash);
+        return u ? u->location : -1;
+    }
+    int GetAttribLocation(uint32_t nameHash) {
+        ShaderVariable* a = m_Attribs.Find(nameHash);
+        return a ? a->location : -1;
+    }
+
+    /* setters, program must be bound. uniform not in the program -> nothing happens */
+    void SetUniform1i(uint32_t nameHash, int v) {
+        if (ShaderVariable* u = Check(nameHash, GL_INT, "SetUniform1i")) {
+            GLCall(glUniform1i(u->location, v));
+        }
+    }
+    void SetUniform1f(uint32_t nameHash, float v) {
+        if (ShaderVariable* u = Check(nameHash, GL_FLOAT, "SetUniform1f")) {
+            GLCall(glUniform1f(u->location, v));
+        }
+    }
+    void SetUniform2f(uint32_t nameHash, float x, float y) {
+        if (ShaderVariable* u = Check(nameHash, GL_FLOAT_VEC2, "SetUniform2f")) {
+            GLCall(glUniform2f(u->location, x, y));
+        }
+    }
+    void SetUniform4f(uint32_t nameHash, float x, float y, float z, float w) {
+        if (ShaderVariable* u = Check(nameHash, GL_FLOAT_VEC4, "SetUniform4f")) {
+            GLCall(glUniform4f(u->location, x, y, z, w));
+        }
+    }
+    /* 'count' elements starting at the hash's element ("u_Tint" = element 0), clamped to the array size */
+    void SetUniform4fv(uint32_t nameHash, int count, const float* values) {
+        if (ShaderVariable* u = Check(nameHash, GL_FLOAT_VEC4, "SetUniform4fv")) {
+            GLCall(glUniform4fv(u->location, count < u->size ? count : u->size, values));
+        }
+    }
+    void SetUniformMat4f(uint32_t nameHash, const float* matrix) {
+        if (ShaderVariable* u = Check(nameHash, GL_FLOAT_MAT4, "SetUniformMat4f")) {
+            GLCall(glUniformMatrix4fv(u->location, 1, GL_FALSE, matrix));
+        }
+    }
+
+    void PrintReflection() const {
+        std::cout << "[Reflection] program " << m_Program << std::endl;
+        for (const ShaderVariable& a : m_Attribs.GetAll())
+            std::cout << "  attrib  " << GLTypeName(a.type) << " " << a.name << " (location " << a.location << ")" << std::endl;
+        for (const ShaderVariable& u : m_Uniforms.GetAll())
+            if (u.name.find('[') == std::string::npos)      /* "name[0]" is the same uniform again */
+                std::cout << "  uniform " << GLTypeName(u.type) << " " << u.name << (u.size > 1 ? "[" + std::to_string(u.size) + "]" : "")
+                          << " (location " << u.location << ")" << std::endl;
+    }
+
+private:
+    ShaderVariable* Check(uint32_t nameHash, unsigned int type, const char* setter) {
+        ShaderVariable* u = m_Uniforms.Find(nameHash);
+        if (!u)
+            return nullptr;         /* optimized away or not in this program */
+
+        bool ok = u->type == type || (type == GL_INT && (IsSampler(u->type) || u->type == GL_BOOL));
+        if (!ok) {
+            if (!u->typeWarned)
+                std::cout << "[Reflection] " << setter << " on " << GLTypeName(u->type) << " " << u->name << ", ignored" << std::endl;
+            u->typeWarned = true;
+            return nullptr;
+        }
+        return u;
+    }
+
+    void Reflect() {
+        std::vector<ShaderVariable> uniforms, attribs;
+
+        int count = 0, maxLength = 0;
+        GLCall(glGetProgramiv(m_Program, GL_ACTIVE_UNIFORMS, &count));
+        GLCall(glGetProgramiv(m_Program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength));
+        std::vector<char> buffer(maxLength + 1);
+
+        for (int i = 0; i < count; i++) {
+            int length = 0, size = 0;
+            unsigned int type = 0;
+            GLCall(glGetActiveUniform(m_Program, i, (int)buffer.size(), &length, &size, &type, buffer.data()));
+            std::string name(buffer.data(), length);
+
+            GLCall(int location = glGetUniformLocation(m_Program, name.c_str()));
+            if (location == -1)
+                continue;       /* inside a uniform block, has no location */
+
+            /* arrays come as "u_Tint[0]", keep both names */
+            size_t bracket = name.find("[0]");
+            if (bracket != std::string::npos && bracket + 3 == name.size()) {
+                std::string base = name.substr(0, bracket);
+                uniforms.push_back({ HashName(base), location, type, size, base, false });
+            }
+            uniforms.push_back({ HashName(name), location, type, size, name, false });
+        }
+
+        GLCall(glGetProgramiv(m_Program, GL_ACTIVE_ATTRIBUTES, &count));
+        GLCall(glGetProgramiv(m_Program, GL_ACTIVE_ATTRIBUTE_MAX_LENGTH, &maxLength));
+        buffer.assign(maxLength + 1, 0);
+
+        for (int i = 0; i < count; i++) {
+            int length = 0, size = 0;
+            unsigned int type = 0;
+            GLCall(glGetActiveAttrib(m_Program, i, (int)buffer.size(), &length, &size, &type, buffer.data()));
+            std::string name(buffer.data(), length);
+
+            GLCall(int location = glGetAttribLocation(m_Program, name.c_str()));
+            if (location == -1)
+                continue;       /* built in like gl_VertexID */
+            attribs.push_back({ HashName(name), location, type, size, name, false });
+        }
+
+        m_Uniforms.Build(std::move(uniforms));
+        m_Attribs.Build(std::move(attribs));
+    }
+
+    unsigned int m_Program;
+    VariableTable m_Uniforms;
+    VariableTable m_Attribs;
+};
+
+
+/* names used in this file, hashed by the compiler */
+constexpr uint32_t U_COLOR  = HashName("u_Color");
+constexpr uint32_t U_TINT   = HashName("u_Tint");
+constexpr uint32_t U_OFFSET = HashName("u_Offset");
+constexpr uint32_t U_SCALE  = HashName("u_Scale");
+constexpr uint32_t U_UNUSED = HashName("u_Unused");
+constexpr uint32_t A_POSITION = HashName("position");
+
+static_assert(U_COLOR != U_TINT && U_OFFSET != U_SCALE, "uniform name hashes collide");
+
+
+
+int main(void)
+{
+    /* GLFW BASIC STUFF */
+        GLFWwindow* window;
+
+        /* Initialize the GLFW library */
+        if (!glfwInit())
+            return -1;
+
+
+        /* setting version 3.3 and core profile (i.e mordern opengl) */
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);    /* most drivers only send debug messages in debug context */
+#endif
+
+
+        /* Create a windowed mode window and its OpenGL context */
+        window = glfwCreateWindow(640, 480, "Hello World", NULL, NULL);
+        if (!window)
+        {
+            glfwTerminate();
+            return -1;
+
+        }
+        /* Make the window's context current */
+        glfwMakeContextCurrent(window);
+
+        glfwSwapInterval(1);    /* controls FPS or intervel between buffer(frames) */
+
+    /*  END BASIC GLFW   */
+
+
+    /* Intitialize GLEW */
+        if (glewInit() != GLEW_OK) {
+            std::cout << "Error!" << std::endl;
+        }
+    /* END */
+
+    std::cout << glGetString(GL_VERSION) << std::endl;  /* prints the version of opengl using */
+
+    SetupGLErrorPolicy();
+
+
+    { /* scope so that ShaderProgram deletes its program before glfwTerminate destroys the context */
+
+    /* ------------- Generating Data to be used to display in the window ------------- */
+
+            // 4 positions of vertices of sqaure
+            float positions[] = {
+                -0.5f, -0.5f,    // 0
+                 0.5f, -0.5f,    // 1
+                 0.5f,  0.5f,    // 2
+                -0.5f,  0.5f     // 3
+            };
+
+            // Index data -----> position in which vertices is to be rendered to form a square
+            unsigned int indices[] = {
+                0, 1, 2,
+                2, 3, 0
+            };
+
+            ShaderProgramSource shaderSource = ParseShader("res/shaders/Basic - REFLECTION.shader");
+            ShaderProgram shader(CreateShader(shaderSource.VertexSource, shaderSource.FragmentSource));
+            shader.PrintReflection();
+
+            int positionLocation = shader.GetAttribLocation(A_POSITION);       /* layout(location = 0) in the shader */
+            ASSERT(positionLocation != -1);
+
+            unsigned int vao;
+            GLCall(glGenVertexArrays(1, &vao));
+            GLCall(glBindVertexArray(vao));
+
+            unsigned int buffer;
+            GLCall(glGenBuffers(1, &buffer));
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, buffer));
+            GLCall(glBufferData(GL_ARRAY_BUFFER, 4 * 2 * sizeof(float), positions, GL_STATIC_DRAW));
+
+            GLCall(glEnableVertexAttribArray(positionLocation));
+            GLCall(glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2, 0));
+
+            unsigned int ibo;       // index buffer object
+            GLCall(glGenBuffers(1, &ibo));
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo));
+            GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, 6 * sizeof(unsigned int), indices, GL_STATIC_DRAW));
+
+            GLCall(glBindVertexArray(0));
+
+            shader.Bind();
+
+
+    /* ------------- LOOKUP COST (string vs hash table) ------------- */
+
+        {
+            const unsigned int lookups = 1000000;
+            const char* names[] = { "u_Color", "u_Tint", "u_Offset", "u_Scale" };
+            const uint32_t hashes[] = { U_COLOR, U_TINT, U_OFFSET, U_SCALE };
+
+            long long checkString = 0, checkHash = 0;      /* so the compiler can not skip the loops */
+
+            auto start = std::chrono::high_resolution_clock::now();
+            for (unsigned int i = 0; i < lookups; i++)
+                checkString += glGetUniformLocation(shader.GetID(), names[i & 3]);
+            double stringMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+            start = std::chrono::high_resolution_clock::now();
+            for (unsigned int i = 0; i < lookups; i++)
+                checkHash += shader.GetUniformLocation(hashes[i & 3]);
+            double hashMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+            std::cout << "[Lookup] " << lookups << " uniform locations" << std::endl;
+            std::cout << "  glGetUniformLocation : " << stringMs << " ms" << std::endl;
+            std::cout << "  reflection table     : " << hashMs << " ms" << (checkString == checkHash ? "" : " (DIFFERENT RESULTS)") << std::endl;
+        }
+
+
+    /* ------------- END OF GENERATING DATA ------------- */
+
+
+    /* ----------- Animation Variable ----------- */
+    float r = 0.0f;
+    float increment = 0.05f;
+
+    const float tint[] = {
+        1.0f, 1.0f, 1.0f, 1.0f,
+        1.0f, 0.8f, 0.8f, 1.0f
+    };
+
+
+
+    /* WHILE Loop to keep the window active till window is closed */
+    while (!glfwWindowShouldClose(window))
+    {
+        /* Render here */
+
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        shader.Bind();
+        shader.SetUniform4f(U_COLOR, r, 0.2f, 0.5f, 1.0f);
+        shader.SetUniform4fv(U_TINT, 2, tint);
+        shader.SetUniform2f(U_OFFSET, 0.0f, 0.0f);
+        shader.SetUniform1f(U_SCALE, 0.5f + r * 0.5f);
+        shader.SetUniform1f(U_UNUSED, r);       /* removed by the linker -> does nothing, no ASSERT */
+
+        GLCall(glBindVertexArray(vao));
+        GLCall(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr));
+
+        if (r > 1.0f)
+            increment = -0.05f;
+        else if (r < 0.0f)
+            increment = 0.05f;
+
+        r += increment;
+
+
+        /* Swap front and back buffers */
+        glfwSwapBuffers(window);
+
+        /* Poll for and process events */
+        glfwPollEvents();
+    }
+
+    glDeleteBuffers(1, &buffer);
+    glDeleteBuffers(1, &ibo);
+    glDeleteVertexArrays(1, &vao);
+
+    }
+
+    glfwTerminate();
+    return 0;
+}
+
+
+
+
+/* Makes and compile the shader by inputing the type and Source code */
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source) {
+
+    unsigned int id = glCreateShader(shaderType);   /* generate Shader and return id */
+    const char* src = source.c_str();               /* convert inputed string to char* */
+    GLCall(glShaderSource(id, 1, &src, nullptr));           /* attaching source code to the shader */
+    GLCall(glCompileShader(id));                            /* compile shader */
+
+    /* -------- ERROR HANDLING -------- */
+        int result;
+        GLCall(glGetShaderiv(id, GL_COMPILE_STATUS, &result));
+        if (result == GL_FALSE) {
+            int length;
+            GLCall(glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length));
+            std::vector<char> message(length + 1);      /* char Array of length 'length' (_malloca is only in MSVC) */
+            GLCall(glGetShaderInfoLog(id, length, &length, message.data()));
+
+            std::cout << "Failed To Compile " << (shaderType == GL_VERTEX_SHADER ? "vertex" : "fragment") << " shader" << std::endl;
+
+            std::cout << message.data() << std::endl;
+            GLCall(glDeleteShader(id));
+            return 0;
+        }
+
+    /* -------- END ERROR HANDLING -------- */
+
+    return id;
+
+}
+
+
+/* Creates a program Which contain vertex and fragment shader */
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader) {
+
+    GLCall(unsigned int program = glCreateProgram());                           /* generate program to store all shader and program to be run by GPU during while loop */
+    unsigned int vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
+    unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+
+    GLCall(glAttachShader(program, vs));                                        /* Attach shader to program to be run by GPU */
+    GLCall(glAttachShader(program, fs));
+    GLCall(glLinkProgram(program));
+    GLCall(glValidateProgram(program));
+    GLCall(glDeleteShader(vs));                                                 /* DELETING shader to save space as shader is already attached to program */
+    GLCall(glDeleteShader(fs));
+
+    return program;
+
+}
+
+
+/* Read file and output vertex and fragment shader source code */
+static ShaderProgramSource ParseShader(const std::string& filepath) {
+
+    std::ifstream stream(filepath);
+
+    enum class ShaderType {
+        NONE = -1, VERTEX = 0, FRAGMENT = 1
+    };
+
+    std::string line;
+    std::stringstream ss[2];
+    ShaderType type = ShaderType::NONE;
+    while (getline(stream, line)) {
+
+        if (line.find("#shader") != std::string::npos) {
+
+            if (line.find("vertex") != std::string::npos)
+                type = ShaderType::VERTEX;
+            else if (line.find("fragment") != std::string::npos)
+                type = ShaderType::FRAGMENT;
+
+        }
+        else {
+            ss[int(type)] << line << '\n';
+        }
+    }
+
+    return { ss[0].str(), ss[1].str() };
+}
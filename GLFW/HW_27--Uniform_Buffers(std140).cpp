@@ -0,0 +1,709 @@
+/*
+
+Uniform Buffers (std140 layout, one buffer per frame, range per draw)
+
+every object sets its data with glUniform4f / glUniform2f / ... right before its draw call (HW_7 - HW_10)
+that is a few driver calls per object, and data shared by every program (camera, time) has to be set again in every program
+
+with a Uniform Buffer Object (UBO) the uniforms of a block live in a normal buffer
+
+---> layout(std140) fixes where every member is in memory (vec3 / arrays / mat4 have 16 byte alignment, ...)
+     Std140Layout computes the same offsets in C++ and CheckAgainst() compares them with what the driver
+     reports for the block (glGetActiveUniformsiv GL_UNIFORM_OFFSET / ARRAY_STRIDE / MATRIX_STRIDE)
+---> FrameUniformBuffer is one big buffer: frame data at the start, then one slot per object
+     the CPU fills all of it, and it is uploaded ONCE per frame (orphan + glBufferSubData)
+---> FrameData block is bound to binding point 0 once per frame, every program that has it sees it
+---> per draw only glBindBufferRange(binding point 1, offset of the object) is called
+     offsets must be multiples of GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT (often 256), so every slot is padded to it
+
+GL 3.3 has no layout(binding = N) in GLSL, so glUniformBlockBinding sets the binding point of each block after linking
+
+at start 10k draws are timed with glUniform calls per draw and with the UBO
+
+*/
+
+
+
+
+#include <GL\glew.h>
+
+#include <GLFW/glfw3.h>
+
+
+#include <iostream>
+#include <fstream>  // to read file
+#include <string>   // To use getline func
+#include <sstream>
+#include <vector>
+#include <chrono>
+#include <cstring>  // memcpy
+#include <math.h>
+
+
+/* ------------ ERROR CHECK POLICY ------------ */
+/*
+GL_CHECK_NONE   -> GLCall(x) is just x, nothing is checked (release)
+GL_CHECK_ASYNC  -> GLCall(x) is just x, driver reports errors later through glDebugMessageCallback (needs KHR_debug / GL 4.3)
+GL_CHECK_STRICT -> glGetError before and after every call, stops on the line with the error (old GLCall)
+
+default is NONE for release (NDEBUG) and STRICT for debug, or pass -DGL_CHECK_POLICY=1 to compiler to choose
+*/
+#define GL_CHECK_NONE   0
+#define GL_CHECK_ASYNC  1
+#define GL_CHECK_STRICT 2
+
+#ifndef GL_CHECK_POLICY
+    #ifdef NDEBUG
+        #define GL_CHECK_POLICY GL_CHECK_NONE
+    #else
+        #define GL_CHECK_POLICY GL_CHECK_STRICT
+    #endif
+#endif
+
+
+/* ------------ MACRO ------------ */
+
+/* __debugbreak is only in MSVC, on gcc / clang SIGTRAP does same thing (debugger stops there) */
+#if defined(_MSC_VER)
+    #define DEBUG_BREAK() __debugbreak()
+#elif defined(__GNUC__) || defined(__clang__)
+    #include <signal.h>
+    #define DEBUG_BREAK() raise(SIGTRAP)
+#else
+    #include <cstdlib>
+    #define DEBUG_BREAK() std::abort()
+#endif
+
+#define ASSERT(x) if (!(x)) DEBUG_BREAK();
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+    #define GLCall(x) GLCLearError();\
+        x;\
+        ASSERT(GlLogCall(#x, __FILE__, __LINE__))
+#else
+    #define GLCall(x) x
+#endif
+
+/*
+# before a fucntion pass it as a stringand __FILE__and __LINE__ are macros to get file loc and line of fucntion
+and since MACROS HAS TO BE IN SAME LINE we use \ before line ends to write macros in multiple lines
+*/
+
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+static void GLCLearError() {
+    while (glGetError() != GL_NO_ERROR);    // glGetError get error and we get all the error until there are no arror left
+}
+
+static bool GlLogCall(const char* function, const char* file, int line) {
+    bool ok = true;
+    while (GLenum error = glGetError()) {
+        std::cout << "[OpenGl Error] (" << error << "): " << function << " " << file << ":" << line << std::endl;
+        ok = false;
+    }
+    return ok;
+}
+#endif
+
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+/* called by the driver (maybe from its own thread) when something is wrong */
+static void APIENTRY GlDebugCallback(GLenum /*source*/, GLenum type, GLuint id, GLenum severity, GLsizei /*length*/, const GLchar* message, const void* /*userParam*/) {
+
+    const char* level = severity == GL_DEBUG_SEVERITY_HIGH ? "HIGH" : severity == GL_DEBUG_SEVERITY_MEDIUM ? "MEDIUM" : "LOW";
+    std::cout << "[OpenGl Debug] (" << level << (type == GL_DEBUG_TYPE_ERROR ? ", error" : "") << ", id " << id << "): " << message << std::endl;
+}
+#endif
+
+/* call once after glewInit, sets up whatever the chosen policy needs */
+static void SetupGLErrorPolicy() {
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+    if (GLEW_VERSION_4_3 || GLEW_KHR_debug) {
+        glEnable(GL_DEBUG_OUTPUT);
+        glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);     /* driver does not have to report inside the call, so no slow down */
+        glDebugMessageCallback(GlDebugCallback, nullptr);
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);  /* skip info messages */
+        std::cout << "GL errors: async (debug callback)" << std::endl;
+    }
+    else {
+        std::cout << "GL errors: async asked but KHR_debug is not there, errors are not checked" << std::endl;
+    }
+#elif GL_CHECK_POLICY == GL_CHECK_STRICT
+    std::cout << "GL errors: strict (glGetError after every call)" << std::endl;
+#else
+    std::cout << "GL errors: off" << std::endl;
+#endif
+}
+
+
+
+struct ShaderProgramSource {
+    std::string VertexSource;
+    std::string FragmentSource;
+};
+
+static ShaderProgramSource ParseShader(const std::string& filepath);
+
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader);
+
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source);
+
+
+
+/* ------------- STD140 LAYOUT ------------- */
+
+static size_t AlignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+enum class Std140Type { Float, Vec2, Vec3, Vec4, Mat4 };
+
+struct Std140Member {
+    std::string name;
+    Std140Type type;
+    unsigned int count;         /* array length, 1 = not an array */
+    size_t offset;
+    size_t arrayStride;         /* 0 if not an array */
+    size_t matrixStride;        /* 0 if not a matrix */
+};
+
+/* members in the same order as in the GLSL block, offsets follow std140 rules */
+class Std140Layout {
+public:
+    Std140Layout& Add(const std::string& name, Std140Type type, unsigned int count = 1) {
+        size_t alignment = 0, size = 0;
+        switch (type) {
+            case Std140Type::Float: alignment = 4;  size = 4;  break;
+            case Std140Type::Vec2:  alignment = 8;  size = 8;  break;
+            case Std140Type::Vec3:  alignment = 16; size = 12; break;
+            case Std140Type::Vec4:  alignment = 16; size = 16; break;
+            case Std140Type::Mat4:  alignment = 16; size = 64; break;   /* 4 columns, each like a vec4 */
+        }
+
+        Std140Member m{ name, type, count, 0, 0, type == Std140Type::Mat4 ? 16u : 0u };
+        if (count > 1) {
+            alignment = AlignUp(alignment, 16);         /* array elements are aligned like vec4 */
+            m.arrayStride = AlignUp(size, 16);
+            size = m.arrayStride * count;
+        }
+
+        m.offset = AlignUp(m_Size, alignment);
+        m_Size = m.offset + size;
+        m_Members.push_back(m);
+        return *this;
+    }
+
+    /* whole block is padded to vec4 */
+    size_t Size() const { return AlignUp(m_Size, 16); }
+
+    size_t Offset(const std::string& name) const {
+        const Std140Member* m = Find(name);
+        ASSERT(m != nullptr);
+        return m ? m->offset : 0;
+    }
+
+    /* compares every member with the block the driver made, prints differences. false if block does not match */
+    bool CheckAgainst(unsigned int program, const char* blockName) const {
+
+        GLCall(unsigned int block = glGetUniformBlockIndex(program, blockName));
+        if (block == GL_INVALID_INDEX) {
+            std::cout << "[std140] block " << blockName << " is not in program " << program << std::endl;
+            return false;
+        }
+
+        int dataSize = 0, count = 0;
+        GLCall(glGetActiveUniformBlockiv(program, block, GL_UNIFORM_BLOCK_DATA_SIZE, &dataSize));
+        GLCall(glGetActiveUniformBlockiv(program, block, GL_UNIFORM_BLOCK_ACTIVE_UNIFORMS, &count));
+
+        std::vector<int> indicesInt(count);
+        GLCall(glGetActiveUniformBlockiv(program, block, GL_UNIFORM_BLOCK_ACTIVE_UNIFORM_INDICES, indicesInt.data()));
+        std::vector<unsigned int> indices(indicesInt.begin(), indicesInt.end());
+
+        std::vector<int> offsets(count), types(count), sizes(count), arrayStrides(count), matrixStrides(count);
+        if (count > 0) {
+            GLCall(glGetActiveUniformsiv(program, count, indices.data(), GL_UNIFORM_OFFSET, offsets.data()));
+            GLCall(glGetActiveUniformsiv(program, count, indices.data(), GL_UNIFORM_TYPE, types.data()));
+            GLCall(glGetActiveUniformsiv(program, count, indices.data(), GL_UNIFORM_SIZE, sizes.data()));
+            GLCall(glGetActiveUniformsiv(program, count, indices.data(), GL_UNIFORM_ARRAY_STRIDE, arrayStrides.data()));
+            GLCall(glGetActiveUniformsiv(program, count, indices.data(), GL_UNIFORM_MATRIX_STRIDE, matrixStrides.data()));
+        }
+
+        bool ok = true;
+        auto mismatch = [&](const std::string& what) {
+            std::cout << "[std140] " << blockName << ": " << what << std::endl;
+            ok = false;
+        };
+
+        std::vector<bool> seen(m_Members.size(), false);
+        for (int i = 0; i < count; i++) {
+            char buffer[256];
+            int length = 0;
+            GLCall(glGetActiveUniformName(program, indices[i], sizeof(buffer), &length, buffer));
+            std::string name(buffer, length);
+            if (name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0)
+                name.resize(name.size() - 3);
+
+            const Std140Member* m = Find(name);
+            if (!m) {
+                mismatch(name + " is in the shader but not in the C++ layout");
+                continue;
+            }
+            seen[m - m_Members.data()] = true;
+
+            if ((unsigned int)types[i] != GLType(m->type))
+                mismatch(name + " has other type in the shader");
+            if ((size_t)offsets[i] != m->offset)
+                mismatch(name + " offset " + std::to_string(m->offset) + " in C++, " + std::to_string(offsets[i]) + " in shader");
+            if ((unsigned int)sizes[i] != m->count)
+                mismatch(name + " array size " + std::to_string(m->count) + " in C++, " + std::to_string(sizes[i]) + " in shader");
+            if (m->count > 1 && (size_t)arrayStrides[i] != m->arrayStride)
+                mismatch(name + " array stride " + std::to_string(m->arrayStride) + " in C++, " + std::to_string(arrayStrides[i]) + " in shader");
+            if (m->matrixStride && (size_t)matrixStrides[i] != m->matrixStride)
+                mismatch(name + " matrix stride " + std::to_string(m->matrixStride) + " in C++, " + std::to_string(matrixStrides[i]) + " in shader");
+        }
+
+        for (size_t i = 0; i < m_Members.size(); i++)
+            if (!seen[i])
+                mismatch(m_Members[i].name + " is in the C++ layout but not in the shader");
+
+        if ((size_t)dataSize > Size())
+            mismatch("size " + std::to_string(Size()) + " in C++, " + std::to_string(dataSize) + " in shader");
+
+        return ok;
+    }
+
+private:
+    const Std140Member* Find(const std::string& name) const {
+        for (const Std140Member& m : m_Members)
+            if (m.name == name)
+                return &m;
+        return nullptr;
+    }
+
+    static unsigned int GLType(Std140Type type) {
+        switch (type) {
+            case Std140Type::Float: return GL_FLOAT;
+            case Std140Type::Vec2:  return GL_FLOAT_VEC2;
+            case Std140Type::Vec3:  return GL_FLOAT_VEC3;
+            case Std140Type::Vec4:  return GL_FLOAT_VEC4;
+            case Std140Type::Mat4:  return GL_FLOAT_MAT4;
+        }
+        return 0;
+    }
+
+    std::vector<Std140Member> m_Members;
+    size_t m_Size = 0;
+};
+
+
+
+/* ------------- FRAME UNIFORM BUFFER ------------- */
+
+static const unsigned int FRAME_BINDING = 0;        /* FrameData block */
+static const unsigned int OBJECT_BINDING = 1;       /* ObjectData block */
+
+/* sets binding points of the blocks the program has (GL 3.3 can not do it in GLSL) */
+static void BindUniformBlocks(unsigned int program) {
+    GLCall(unsigned int frame = glGetUniformBlockIndex(program, "FrameData"));
+    if (frame != GL_INVALID_INDEX) {
+        GLCall(glUniformBlockBinding(program, frame, FRAME_BINDING));
+    }
+    GLCall(unsigned int object = glGetUniformBlockIndex(program, "ObjectData"));
+    if (object != GL_INVALID_INDEX) {
+        GLCall(glUniformBlockBinding(program, object, OBJECT_BINDING));
+    }
+}
+
+/* [frame data][object 0][object 1]... every part starts at a multiple of GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT */
+class FrameUniformBuffer {
+public:
+    FrameUniformBuffer(size_t frameDataSize, size_t objectSize, unsigned int maxObjects)
+        : m_FrameDataSize(frameDataSize), m_ObjectSize(objectSize), m_MaxObjects(maxObjects) {
+
+        int alignment = 256;
+        GLCall(glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment));
+        m_Alignment = (size_t)alignment;
+
+        m_ObjectStride = AlignUp(objectSize, m_Alignment);
+        m_ObjectsBegin = AlignUp(frameDataSize, m_Alignment);
+        m_Staging.assign(m_ObjectsBegin + m_ObjectStride * maxObjects, 0);
+
+        GLCall(glGenBuffers(1, &m_Buffer));
+        GLCall(glBindBuffer(GL_UNIFORM_BUFFER, m_Buffer));
+        GLCall(glBufferData(GL_UNIFORM_BUFFER, m_Staging.size(), nullptr, GL_STREAM_DRAW));
+    }
+
+    ~FrameUniformBuffer() {
+        glDeleteBuffers(1, &m_Buffer);
+    }
+
+    FrameUniformBuffer(const FrameUniformBuffer&) = delete;
+    FrameUniformBuffer& operator=(const FrameUniformBuffer&) = delete;
+
+    unsigned char* FrameData() { return m_Staging.data(); }
+    unsigned char* ObjectData(unsigned int index) { return m_Staging.data() + m_ObjectsBegin + m_ObjectStride * index; }
+
+    /* once per frame: uploads frame data + first 'objectCount' objects and binds frame data to its binding point */
+    void Upload(unsigned int objectCount) {
+        ASSERT(objectCount <= m_MaxObjects);
+        size_t bytes = m_ObjectsBegin + m_ObjectStride * objectCount;
+
+        GLCall(glBindBuffer(GL_UNIFORM_BUFFER, m_Buffer));
+        GLCall(glBufferData(GL_UNIFORM_BUFFER, m_Staging.size(), nullptr, GL_STREAM_DRAW));     /* orphan, GPU may still read last frame */
+        GLCall(glBufferSubData(GL_UNIFORM_BUFFER, 0, bytes, m_Staging.data()));
+        GLCall(glBindBufferRange(GL_UNIFORM_BUFFER, FRAME_BINDING, m_Buffer, 0, m_FrameDataSize));
+
+        m_BytesUploaded = bytes;
+    }
+
+    /* per draw */
+    void BindObject(unsigned int index) {
+        GLCall(glBindBufferRange(GL_UNIFORM_BUFFER, OBJECT_BINDING, m_Buffer, m_ObjectsBegin + m_ObjectStride * index, m_ObjectSize));
+    }
+
+    size_t GetAlignment() const { return m_Alignment; }
+    size_t GetObjectStride() const { return m_ObjectStride; }
+    size_t GetBytesUploaded() const { return m_BytesUploaded; }
+
+private:
+    unsigned int m_Buffer = 0;
+    size_t m_FrameDataSize, m_ObjectSize;
+    unsigned int m_MaxObjects;
+    size_t m_Alignment = 256, m_ObjectStride = 0, m_ObjectsBegin = 0;
+    size_t m_BytesUploaded = 0;
+    std::vector<unsigned char> m_Staging;
+};
+
+static void WriteFloats(unsigned char* dst, size_t offset, const float* values, size_t count) {
+    memcpy(dst + offset, values, count * sizeof(float));
+}
+
+
+
+struct Object {
+    float r, g, b;
+    float x, y;
+};
+
+
+
+int main(void)
+{
+    /* GLFW BASIC STUFF */
+        GLFWwindow* window;
+
+        /* Initialize the GLFW library */
+        if (!glfwInit())
+            return -1;
+
+
+        /* setting version 3.3 and core profile (i.e mordern opengl) */
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);    /* most drivers only send debug messages in debug context */
+#endif
+
+
+        /* Create a windowed mode window and its OpenGL context */
+        window = glfwCreateWindow(640, 480, "Hello World", NULL, NULL);
+        if (!window)
+        {
+            glfwTerminate();
+            return -1;
+
+        }
+        /* Make the window's context current */
+        glfwMakeContextCurrent(window);
+
+        glfwSwapInterval(1);    /* controls FPS or intervel between buffer(frames) */
+
+    /*  END BASIC GLFW   */
+
+
+    /* Intitialize GLEW */
+        if (glewInit() != GLEW_OK) {
+            std::cout << "Error!" << std::endl;
+        }
+    /* END */
+
+    std::cout << glGetString(GL_VERSION) << std::endl;  /* prints the version of opengl using */
+
+    SetupGLErrorPolicy();
+
+
+    { /* scope so that FrameUniformBuffer deletes its buffer before glfwTerminate destroys the context */
+
+    /* ------------- Generating Data to be used to display in the window ------------- */
+
+            // 4 positions of vertices of sqaure
+            float positions[] = {
+                -0.5f, -0.5f,    // 0
+                 0.5f, -0.5f,    // 1
+                 0.5f,  0.5f,    // 2
+                -0.5f,  0.5f     // 3
+            };
+
+            // Index data -----> position in which vertices is to be rendered to form a square
+            unsigned int indices[] = {
+                0, 1, 2,
+                2, 3, 0
+            };
+
+            unsigned int vao;
+            GLCall(glGenVertexArrays(1, &vao));
+            GLCall(glBindVertexArray(vao));
+
+            unsigned int buffer;
+            GLCall(glGenBuffers(1, &buffer));
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, buffer));
+            GLCall(glBufferData(GL_ARRAY_BUFFER, 4 * 2 * sizeof(float), positions, GL_STATIC_DRAW));
+
+            GLCall(glEnableVertexAttribArray(0));
+            GLCall(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2, 0));
+
+            unsigned int ibo;       // index buffer object
+            GLCall(glGenBuffers(1, &ibo));
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo));
+            GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, 6 * sizeof(unsigned int), indices, GL_STATIC_DRAW));
+
+            GLCall(glBindVertexArray(0));
+
+
+        /* glUniform way (same data as the UBO, u_Tint set once per frame in this program) */
+        ShaderProgramSource uniformSource = ParseShader("res/shaders/Basic - REFLECTION.shader");
+        unsigned int uniformShader = CreateShader(uniformSource.VertexSource, uniformSource.FragmentSource);
+        GLCall(int colorLocation = glGetUniformLocation(uniformShader, "u_Color"));
+        GLCall(int offsetLocation = glGetUniformLocation(uniformShader, "u_Offset"));
+        GLCall(int scaleLocation = glGetUniformLocation(uniformShader, "u_Scale"));
+        GLCall(int tintLocation = glGetUniformLocation(uniformShader, "u_Tint"));
+        ASSERT(colorLocation != -1 && offsetLocation != -1 && scaleLocation != -1 && tintLocation != -1);
+
+        /* UBO way */
+        ShaderProgramSource uboSource = ParseShader("res/shaders/Basic - UBO.shader");
+        unsigned int uboShader = CreateShader(uboSource.VertexSource, uboSource.FragmentSource);
+        BindUniformBlocks(uboShader);
+
+        /* same order as the blocks in Basic - UBO.shader */
+        Std140Layout frameLayout, objectLayout;
+        frameLayout.Add("u_Tint", Std140Type::Vec4, 2).Add("u_Time", Std140Type::Float);
+        objectLayout.Add("u_Color", Std140Type::Vec4).Add("u_Offset", Std140Type::Vec2).Add("u_Scale", Std140Type::Float);
+
+        bool frameOk = frameLayout.CheckAgainst(uboShader, "FrameData");
+        bool objectOk = objectLayout.CheckAgainst(uboShader, "ObjectData");
+        bool layoutsOk = frameOk && objectOk;
+        std::cout << "[std140] FrameData " << frameLayout.Size() << " bytes, ObjectData " << objectLayout.Size() << " bytes, "
+                  << (layoutsOk ? "match the shader" : "DO NOT match the shader") << std::endl;
+
+        /* offsets looked up once, writing is a memcpy at a known place */
+        const size_t tintOffset = frameLayout.Offset("u_Tint"), timeOffset = frameLayout.Offset("u_Time");
+        const size_t colorOffset = objectLayout.Offset("u_Color"), posOffset = objectLayout.Offset("u_Offset"), scaleOffset = objectLayout.Offset("u_Scale");
+
+        /* 100 x 100 grid of small squares */
+        const unsigned int side = 100, objectCount = side * side;
+        const float scale = 1.8f / side;
+        std::vector<Object> objects;
+        for (unsigned int i = 0; i < objectCount; i++) {
+            float fx = (float)(i % side) / side, fy = (float)(i / side) / side;
+            objects.push_back({ fx, fy, 0.5f, -0.9f + scale * 0.5f + fx * 1.8f, -0.9f + scale * 0.5f + fy * 1.8f });
+        }
+
+        FrameUniformBuffer ubo(frameLayout.Size(), objectLayout.Size(), objectCount);
+        const float tint[] = { 1.0f, 1.0f, 1.0f, 1.0f,  1.0f, 0.9f, 0.9f, 1.0f };
+
+        /* fills and uploads the whole frame, then one range bind + draw per object */
+        auto drawWithUBO = [&](float time, float pulse) {
+            WriteFloats(ubo.FrameData(), tintOffset, tint, 8);
+            WriteFloats(ubo.FrameData(), timeOffset, &time, 1);
+            for (unsigned int i = 0; i < objectCount; i++) {
+                const Object& o = objects[i];
+                float color[] = { o.r * pulse, o.g, o.b, 1.0f };
+                float pos[] = { o.x, o.y };
+                unsigned char* data = ubo.ObjectData(i);
+                WriteFloats(data, colorOffset, color, 4);
+                WriteFloats(data, posOffset, pos, 2);
+                WriteFloats(data, scaleOffset, &scale, 1);
+            }
+            ubo.Upload(objectCount);
+
+            GLCall(glUseProgram(uboShader));
+            GLCall(glBindVertexArray(vao));
+            for (unsigned int i = 0; i < objectCount; i++) {
+                ubo.BindObject(i);
+                GLCall(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr));
+            }
+        };
+
+
+    /* ------------- BENCHMARK (10k draws) ------------- */
+
+        glfwSwapInterval(0);
+
+        const int benchFrames = 100;
+
+        /* glUniform calls per draw like HW_10 */
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int frame = 0; frame < benchFrames; frame++) {
+            glClear(GL_COLOR_BUFFER_BIT);
+            GLCall(glUseProgram(uniformShader));
+            GLCall(glUniform4fv(tintLocation, 2, tint));
+            GLCall(glBindVertexArray(vao));
+            for (const Object& o : objects) {
+                GLCall(glUniform4f(colorLocation, o.r, o.g, o.b, 1.0f));
+                GLCall(glUniform2f(offsetLocation, o.x, o.y));
+                GLCall(glUniform1f(scaleLocation, scale));
+                GLCall(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr));
+            }
+            glFinish();
+        }
+        double uniformMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count() / benchFrames;
+
+        start = std::chrono::high_resolution_clock::now();
+        for (int frame = 0; frame < benchFrames; frame++) {
+            glClear(GL_COLOR_BUFFER_BIT);
+            drawWithUBO(0.0f, 1.0f);
+            glFinish();
+        }
+        double uboMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count() / benchFrames;
+
+        std::cout << "[Benchmark] " << objectCount << " draws, " << benchFrames << " frames" << std::endl;
+        std::cout << "  glUniform per draw : " << uniformMs << " ms/frame (" << objectCount * 3 << " glUniform calls per frame)" << std::endl;
+        std::cout << "  UBO range per draw : " << uboMs << " ms/frame (1 upload of " << ubo.GetBytesUploaded() / 1024 << " KB, "
+                  << objectCount << " glBindBufferRange, offset alignment " << ubo.GetAlignment() << " -> " << ubo.GetObjectStride() << " bytes per object)" << std::endl;
+
+        glfwSwapInterval(1);
+
+    /* ------------- END BENCHMARK ------------- */
+
+
+    /* ------------- END OF GENERATING DATA ------------- */
+
+
+    /* ----------- Animation Variable ----------- */
+    float r = 0.0f;
+    float increment = 0.05f;
+    float time = 0.0f;
+
+
+
+    /* WHILE Loop to keep the window active till window is closed */
+    while (!glfwWindowShouldClose(window))
+    {
+        /* Render here */
+
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        drawWithUBO(time, r);
+        time += 0.05f;
+
+        if (r > 1.0f)
+            increment = -0.05f;
+        else if (r < 0.0f)
+            increment = 0.05f;
+
+        r += increment;
+
+
+        /* Swap front and back buffers */
+        glfwSwapBuffers(window);
+
+        /* Poll for and process events */
+        glfwPollEvents();
+    }
+
+    glDeleteProgram(uniformShader);
+    glDeleteProgram(uboShader);
+    glDeleteBuffers(1, &buffer);
+    glDeleteBuffers(1, &ibo);
+    glDeleteVertexArrays(1, &vao);
+
+    }
+
+    glfwTerminate();
+    return 0;
+}
+
+
+
+
+/* Makes and compile the shader by inputing the type and Source code */
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source) {
+
+    unsigned int id = glCreateShader(shaderType);   /* generate Shader and return id */
+    const char* src = source.c_str();               /* convert inputed string to char* */
+    GLCall(glShaderSource(id, 1, &src, nullptr));           /* attaching source code to the shader */
+    GLCall(glCompileShader(id));                            /* compile shader */
+
+    /* -------- ERROR HANDLING -------- */
+        int result;
+        GLCall(glGetShaderiv(id, GL_COMPILE_STATUS, &result));
+        if (result == GL_FALSE) {
+            int length;
+            GLCall(glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length));
+            std::vector<char> message(length + 1);      /* char Array of length 'length' (_malloca is only in MSVC) */
+            GLCall(glGetShaderInfoLog(id, length, &length, message.data()));
+
+            std::cout << "Failed To Compile " << (shaderType == GL_VERTEX_SHADER ? "vertex" : "fragment") << " shader" << std::endl;
+
+            std::cout << message.data() << std::endl;
+            GLCall(glDeleteShader(id));
+            return 0;
+        }
+
+    /* -------- END ERROR HANDLING -------- */
+
+    return id;
+
+}
+
+
+/* Creates a program Which contain vertex and fragment shader */
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader) {
+
+    GLCall(unsigned int program = glCreateProgram());                           /* generate program to store all shader and program to be run by GPU during while loop */
+    unsigned int vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
+    unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+
+    GLCall(glAttachShader(program, vs));                                        /* Attach shader to program to be run by GPU */
+    GLCall(glAttachShader(program, fs));
+    GLCall(glLinkProgram(program));
+    GLCall(glValidateProgram(program));
+    GLCall(glDeleteShader(vs));                                                 /* DELETING shader to save space as shader is already attached to program */
+    GLCall(glDeleteShader(fs));
+
+    return program;
+
+}
+
+
+/* Read file and output vertex and fragment shader source code */
+static ShaderProgramSource ParseShader(const std::string& filepath) {
+
+    std::ifstream stream(filepath);
+
+    enum class ShaderType {
+        NONE = -1, VERTEX = 0, FRAGMENT = 1
+    };
+
+    std::string line;
+    std::stringstream ss[2];
+    ShaderType type = ShaderType::NONE;
+    while (getline(stream, line)) {
+
+        if (line.find("#shader") != std::string::npos) {
+
+            if (line.find("vertex") != std::string::npos)
+                type = ShaderType::VERTEX;
+            else if (line.find("fragment") != std::string::npos)
+                type = ShaderType::FRAGMENT;
+
+        }
+        else {
+            ss[int(type)] << line << '\n';
+        }
+    }
+
+    return { ss[0].str(), ss[1].str() };
+}
@@ -0,0 +1,270 @@
+/*
+
+Embed Shaders (header generator, build step for HW_28--Embedded_Shaders.cpp)
+
+not an OpenGL sample, a small command line tool
+
+    embed_shaders <shader folder> <output header>
+    embed_shaders res/shaders EmbeddedShaders.h
+
+every .shader file in the folder is split into its vertex and fragment stage (same #shader tags as ParseShader)
+and written to the header as constexpr std::string_view, so the app has the text inside the exe
+
+---> the text is a raw string literal R"SHADER(...)SHADER", nothing has to be escaped
+     (if the text has )SHADER" in it, the delimiter gets a number: SHADER1, SHADER2, ...)
+---> MSVC does not allow a single string literal longer than about 16 KB, so long stages are written
+     as many literals next to each other (split at line ends), the compiler joins them
+---> \r is removed, so the same file with CRLF or LF gives the same text and the same hash
+---> the hash of every shader (FNV-1a 64 of vertex + fragment) is constexpr, computed by the compiler
+---> files with #include need the preprocessor (HW_24) at runtime, they are skipped with a warning
+---> header is only written when its content changed, so the build does not recompile everything each time
+
+as build step (Visual Studio: Project Properties -> Build Events -> Pre-Build Event -> Command Line)
+
+    "$(OutDir)embed_shaders.exe" "$(ProjectDir)res\shaders" "$(ProjectDir)EmbeddedShaders.h"
+
+with CMake: add_executable(embed_shaders ...) + add_custom_command(OUTPUT EmbeddedShaders.h ... DEPENDS <.shader files>)
+
+*/
+
+
+
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <sstream>
+#include <vector>
+#include <algorithm>
+#include <filesystem>
+
+
+
+struct EmbeddedShader {
+    std::string file;           /* file name, like "Basic - UNFORMS.shader" */
+    std::string identifier;     /* C++ name, like "Basic_UNFORMS" */
+    std::string vertex;
+    std::string fragment;
+};
+
+
+/* "Basic - UNFORMS.shader" -> "Basic_UNFORMS" */
+static std::string MakeIdentifier(const std::string& stem) {
+    std::string id;
+    for (char c : stem) {
+        bool alnum = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+        if (alnum)
+            id += c;
+        else if (!id.empty() && id.back() != '_')
+            id += '_';
+    }
+    while (!id.empty() && id.back() == '_')
+        id.pop_back();
+    if (id.empty() || (id[0] >= '0' && id[0] <= '9'))
+        id = "Shader_" + id;
+    return id;
+}
+
+
+/* same tags as ParseShader, false (and message) if the file can not be embedded */
+static bool SplitShader(const std::filesystem::path& path, EmbeddedShader& out, std::string& error) {
+
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream) {
+        error = "can not open file";
+        return false;
+    }
+
+    enum class ShaderType {
+        NONE = -1, VERTEX = 0, FRAGMENT = 1
+    };
+
+    std::string line;
+    std::string stages[2];
+    bool found[2] = { false, false };
+    ShaderType type = ShaderType::NONE;
+    unsigned int lineNumber = 0;
+
+    while (getline(stream, line)) {
+        lineNumber++;
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+
+        if (line.find("#shader") != std::string::npos) {
+            if (line.find("vertex") != std::string::npos)
+                type = ShaderType::VERTEX;
+            else if (line.find("fragment") != std::string::npos)
+                type = ShaderType::FRAGMENT;
+            else {
+                error = "line " + std::to_string(lineNumber) + ": only vertex and fragment stages can be embedded";
+                return false;
+            }
+            found[int(type)] = true;
+        }
+        else if (line.find("#include") != std::string::npos) {
+            error = "line " + std::to_string(lineNumber) + ": has #include, needs the preprocessor at runtime";
+            return false;
+        }
+        else if (type != ShaderType::NONE) {
+            stages[int(type)] += line + '\n';
+        }
+        else if (line.find_first_not_of(" \t") != std::string::npos) {
+            error = "line " + std::to_string(lineNumber) + ": text before the first #shader tag";
+            return false;
+        }
+    }
+
+    if (!found[0] || !found[1]) {
+        error = "needs a vertex and a fragment stage";
+        return false;
+    }
+
+    out.vertex = stages[0];
+    out.fragment = stages[1];
+    return true;
+}
+
+
+/* raw string literal(s) for 'text', split at line ends so no piece is longer than 'maxPiece' */
+static std::string RawLiteral(const std::string& text, size_t maxPiece = 8000) {
+
+    std::string delimiter = "SHADER";
+    for (int i = 1; text.find(")" + delimiter + "\"") != std::string::npos; i++)
+        delimiter = "SHADER" + std::to_string(i);
+
+    if (text.empty())
+        return "\"\"";
+
+    std::string out;
+    size_t begin = 0;
+    while (begin < text.size()) {
+        size_t end = begin + maxPiece;
+        if (end >= text.size())
+            end = text.size();
+        else {
+            size_t newline = text.rfind('\n', end - 1);
+            end = (newline != std::string::npos && newline >= begin) ? newline + 1 : end;   /* a single huge line is just cut */
+        }
+
+        if (!out.empty())
+            out += "\n        ";
+        out += "R\"" + delimiter + "(" + text.substr(begin, end - begin) + ")" + delimiter + "\"";
+        begin = end;
+    }
+    return out;
+}
+
+
+static std::string MakeHeader(const std::vector<EmbeddedShader>& shaders, const std::string& folder) {
+
+    std::ostringstream h;
+    h << "/*\n\n"
+      << "GENERATED by HW_28--Embed_Shaders(generator).cpp from " << folder << ", do not edit\n"
+      << "run the generator again after changing a .shader file (or add it as build step)\n\n"
+      << "*/\n\n"
+      << "#pragma once\n\n"
+      << "#include <string_view>\n"
+      << "#include <cstdint>\n\n\n"
+      << "namespace EmbeddedShaders {\n\n"
+      << "    /* FNV-1a 64 bit, constexpr so every hash below is computed by the compiler */\n"
+      << "    constexpr uint64_t Hash(std::string_view text, uint64_t hash = 14695981039346656037ull) {\n"
+      << "        for (char c : text) {\n"
+      << "            hash ^= (unsigned char)c;\n"
+      << "            hash *= 1099511628211ull;\n"
+      << "        }\n"
+      << "        return hash;\n"
+      << "    }\n\n"
+      << "    struct Shader {\n"
+      << "        std::string_view file;          /* name of the .shader file, used to find an override */\n"
+      << "        std::string_view vertex;\n"
+      << "        std::string_view fragment;\n"
+      << "        uint64_t hash;                  /* of vertex + fragment, key for program caches */\n"
+      << "    };\n\n"
+      << "    constexpr Shader Make(std::string_view file, std::string_view vertex, std::string_view fragment) {\n"
+      << "        return { file, vertex, fragment, Hash(fragment, Hash(std::string_view(\"\\0\", 1), Hash(vertex))) };\n"
+      << "    }\n\n\n";
+
+    for (const EmbeddedShader& s : shaders) {
+        h << "    /* " << s.file << " */\n"
+          << "    inline constexpr Shader " << s.identifier << " = Make(\"" << s.file << "\",\n"
+          << "        " << RawLiteral(s.vertex) << ",\n"
+          << "        " << RawLiteral(s.fragment) << ");\n\n";
+    }
+
+    h << "\n    inline constexpr Shader All[] = {\n";
+    for (const EmbeddedShader& s : shaders)
+        h << "        " << s.identifier << ",\n";
+    h << "    };\n\n"
+      << "}\n";
+
+    return h.str();
+}
+
+
+
+int main(int argc, char** argv)
+{
+    if (argc != 3) {
+        std::cout << "usage: " << argv[0] << " <shader folder> <output header>" << std::endl;
+        return 1;
+    }
+
+    std::filesystem::path folder = argv[1];
+    std::filesystem::path output = argv[2];
+
+    std::error_code ec;
+    if (!std::filesystem::is_directory(folder, ec)) {
+        std::cout << "embed_shaders: " << folder.string() << " is not a folder" << std::endl;
+        return 1;
+    }
+
+    /* sorted, so the header is the same on every machine */
+    std::vector<std::filesystem::path> files;
+    for (const auto& entry : std::filesystem::directory_iterator(folder))
+        if (entry.is_regular_file() && entry.path().extension() == ".shader")
+            files.push_back(entry.path());
+    std::sort(files.begin(), files.end());
+
+    std::vector<EmbeddedShader> shaders;
+    for (const std::filesystem::path& path : files) {
+        EmbeddedShader s;
+        s.file = path.filename().string();
+        s.identifier = MakeIdentifier(path.stem().string());
+
+        std::string error;
+        if (!SplitShader(path, s, error)) {
+            std::cout << "embed_shaders: skipping " << s.file << " (" << error << ")" << std::endl;
+            continue;
+        }
+
+        for (const EmbeddedShader& other : shaders)
+            if (other.identifier == s.identifier) {
+                std::cout << "embed_shaders: " << s.file << " and " << other.file << " both become " << s.identifier << std::endl;
+                return 1;
+            }
+
+        shaders.push_back(s);
+    }
+
+    std::string header = MakeHeader(shaders, folder.generic_string());
+
+    /* unchanged -> do not touch the file (keeps its time, nothing is rebuilt) */
+    std::ifstream old(output, std::ios::binary);
+    std::stringstream oldContent;
+    oldContent << old.rdbuf();
+    if (old && oldContent.str() == header) {
+        std::cout << "embed_shaders: " << output.string() << " is up to date (" << shaders.size() << " shaders)" << std::endl;
+        return 0;
+    }
+    old.close();
+
+    std::ofstream out(output, std::ios::binary);
+    out << header;
+    if (!out) {
+        std::cout << "embed_shaders: can not write " << output.string() << std::endl;
+        return 1;
+    }
+
+    std::cout << "embed_shaders: wrote " << shaders.size() << " shaders to " << output.string() << std::endl;
+    return 0;
+}
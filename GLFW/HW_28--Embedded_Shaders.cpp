@@ -0,0 +1,483 @@
+/*
+
+Embedded Shaders (shader text inside the exe, hash computed by the compiler)
+
+every sample loads its .shader file from res/shaders at runtime, relative to the working folder
+(start the exe from another folder and there is no shader), and parses it every start, HW_2 has the text in string literals
+
+HW_28--Embed_Shaders(generator).cpp is a build step which writes EmbeddedShaders.h
+every .shader file is there already split into vertex and fragment as constexpr std::string_view
+
+---> no file is opened and nothing is parsed at startup, the views point into the exe
+---> EmbeddedShaders::Basic_UNFORMS.hash is constexpr (computed by the compiler), the program cache uses it as key
+     without hashing anything at runtime
+---> for development shaders can still be changed without building again:
+     if the override folder has a file with the same name, that file is parsed and used instead
+     (folder is argv[1], debug builds use res/shaders when no folder is given, release builds use only embedded)
+
+run the generator again after changing a .shader file that should be shipped:
+
+    embed_shaders res/shaders EmbeddedShaders.h
+
+at start every embedded shader is built, with how long getting the sources took (embedded vs parsing the files)
+
+*/
+
+
+
+
+#include <GL\glew.h>
+
+#include <GLFW/glfw3.h>
+
+
+#include <iostream>
+#include <fstream>  // to read file
+#include <string>   // To use getline func
+#include <string_view>
+#include <sstream>
+#include <vector>
+#include <unordered_map>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <math.h>
+
+#include "EmbeddedShaders.h"
+
+
+/* ------------ ERROR CHECK POLICY ------------ */
+/*
+GL_CHECK_NONE   -> GLCall(x) is just x, nothing is checked (release)
+GL_CHECK_ASYNC  -> GLCall(x) is just x, driver reports errors later through glDebugMessageCallback (needs KHR_debug / GL 4.3)
+GL_CHECK_STRICT -> glGetError before and after every call, stops on the line with the error (old GLCall)
+
+default is NONE for release (NDEBUG) and STRICT for debug, or pass -DGL_CHECK_POLICY=1 to compiler to choose
+*/
+#define GL_CHECK_NONE   0
+#define GL_CHECK_ASYNC  1
+#define GL_CHECK_STRICT 2
+
+#ifndef GL_CHECK_POLICY
+    #ifdef NDEBUG
+        #define GL_CHECK_POLICY GL_CHECK_NONE
+    #else
+        #define GL_CHECK_POLICY GL_CHECK_STRICT
+    #endif
+#endif
+
+
+/* ------------ MACRO ------------ */
+
+/* __debugbreak is only in MSVC, on gcc / clang SIGTRAP does same thing (debugger stops there) */
+#if defined(_MSC_VER)
+    #define DEBUG_BREAK() __debugbreak()
+#elif defined(__GNUC__) || defined(__clang__)
+    #include <signal.h>
+    #define DEBUG_BREAK() raise(SIGTRAP)
+#else
+    #include <cstdlib>
+    #define DEBUG_BREAK() std::abort()
+#endif
+
+#define ASSERT(x) if (!(x)) DEBUG_BREAK();
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+    #define GLCall(x) GLCLearError();\
+        x;\
+        ASSERT(GlLogCall(#x, __FILE__, __LINE__))
+#else
+    #define GLCall(x) x
+#endif
+
+/*
+# before a fucntion pass it as a stringand __FILE__and __LINE__ are macros to get file loc and line of fucntion
+and since MACROS HAS TO BE IN SAME LINE we use \ before line ends to write macros in multiple lines
+*/
+
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+static void GLCLearError() {
+    while (glGetError() != GL_NO_ERROR);    // glGetError get error and we get all the error until there are no arror left
+}
+
+static bool GlLogCall(const char* function, const char* file, int line) {
+    bool ok = true;
+    while (GLenum error = glGetError()) {
+        std::cout << "[OpenGl Error] (" << error << "): " << function << " " << file << ":" << line << std::endl;
+        ok = false;
+    }
+    return ok;
+}
+#endif
+
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+/* called by the driver (maybe from its own thread) when something is wrong */
+static void APIENTRY GlDebugCallback(GLenum /*source*/, GLenum type, GLuint id, GLenum severity, GLsizei /*length*/, const GLchar* message, const void* /*userParam*/) {
+
+    const char* level = severity == GL_DEBUG_SEVERITY_HIGH ? "HIGH" : severity == GL_DEBUG_SEVERITY_MEDIUM ? "MEDIUM" : "LOW";
+    std::cout << "[OpenGl Debug] (" << level << (type == GL_DEBUG_TYPE_ERROR ? ", error" : "") << ", id " << id << "): " << message << std::endl;
+}
+#endif
+
+/* call once after glewInit, sets up whatever the chosen policy needs */
+static void SetupGLErrorPolicy() {
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+    if (GLEW_VERSION_4_3 || GLEW_KHR_debug) {
+        glEnable(GL_DEBUG_OUTPUT);
+        glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);     /* driver does not have to report inside the call, so no slow down */
+        glDebugMessageCallback(GlDebugCallback, nullptr);
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);  /* skip info messages */
+        std::cout << "GL errors: async (debug callback)" << std::endl;
+    }
+    else {
+        std::cout << "GL errors: async asked but KHR_debug is not there, errors are not checked" << std::endl;
+    }
+#elif GL_CHECK_POLICY == GL_CHECK_STRICT
+    std::cout << "GL errors: strict (glGetError after every call)" << std::endl;
+#else
+    std::cout << "GL errors: off" << std::endl;
+#endif
+}
+
+
+
+struct ShaderProgramSource {
+    std::string VertexSource;
+    std::string FragmentSource;
+};
+
+static ShaderProgramSource ParseShader(const std::string& filepath);
+
+static int CreateShader(std::string_view vertexShader, std::string_view fragmentShader);
+
+static unsigned int CompileShader(unsigned int shaderType, std::string_view source);
+
+
+/* keys are known by the compiler */
+static_assert(EmbeddedShaders::Basic_UNFORMS.hash != EmbeddedShaders::Basic.hash, "embedded shader hashes collide");
+constexpr uint64_t BASIC_UNFORMS_KEY = EmbeddedShaders::Basic_UNFORMS.hash;
+
+
+
+/* ------------- PROGRAM CACHE ------------- */
+
+/* one program per shader text, embedded shaders are keyed by their constexpr hash */
+class EmbeddedProgramCache {
+public:
+    explicit EmbeddedProgramCache(const std::string& overrideFolder)
+        : m_OverrideFolder(overrideFolder) {}
+
+    ~EmbeddedProgramCache() {
+        for (auto& [key, program] : m_Programs)
+            glDeleteProgram(program);
+    }
+
+    EmbeddedProgramCache(const EmbeddedProgramCache&) = delete;
+    EmbeddedProgramCache& operator=(const EmbeddedProgramCache&) = delete;
+
+    unsigned int Get(const EmbeddedShaders::Shader& shader) {
+
+        /* development: a file with the same name in the override folder wins */
+        if (!m_OverrideFolder.empty()) {
+            std::filesystem::path path = std::filesystem::path(m_OverrideFolder) / std::string(shader.file);
+            std::error_code ec;
+            if (std::filesystem::is_regular_file(path, ec)) {
+                auto start = std::chrono::high_resolution_clock::now();
+                ShaderProgramSource source = ParseShader(path.string());
+                uint64_t key = EmbeddedShaders::Hash(source.FragmentSource, EmbeddedShaders::Hash(std::string_view("\0", 1), EmbeddedShaders::Hash(source.VertexSource)));
+                m_SourceMs += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+                if (key != shader.hash) {
+                    m_Overridden++;         /* file is different from what is in the exe */
+                    return Build(key, source.VertexSource, source.FragmentSource);
+                }
+            }
+        }
+
+        m_Embedded++;
+        return Build(shader.hash, shader.vertex, shader.fragment);      /* no hashing, no I/O */
+    }
+
+    unsigned int GetEmbeddedCount() const { return m_Embedded; }
+    unsigned int GetOverriddenCount() const { return m_Overridden; }
+    double GetSourceMs() const { return m_SourceMs; }
+
+private:
+    unsigned int Build(uint64_t key, std::string_view vertex, std::string_view fragment) {
+        auto it = m_Programs.find(key);
+        if (it != m_Programs.end())
+            return it->second;
+
+        unsigned int program = CreateShader(vertex, fragment);
+        m_Programs[key] = program;
+        return program;
+    }
+
+    std::string m_OverrideFolder;
+    std::unordered_map<uint64_t, unsigned int> m_Programs;
+    unsigned int m_Embedded = 0, m_Overridden = 0;
+    double m_SourceMs = 0.0;        /* time spent reading + parsing override files */
+};
+
+
+
+int main(int argc, char** argv)
+{
+    /* override folder: argv[1], or res/shaders in debug builds */
+    std::string overrideFolder = argc > 1 ? argv[1] : "";
+#ifndef NDEBUG
+    std::error_code ec;
+    if (overrideFolder.empty() && std::filesystem::is_directory("res/shaders", ec))
+        overrideFolder = "res/shaders";
+#endif
+
+    /* GLFW BASIC STUFF */
+        GLFWwindow* window;
+
+        /* Initialize the GLFW library */
+        if (!glfwInit())
+            return -1;
+
+
+        /* setting version 3.3 and core profile (i.e mordern opengl) */
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);    /* most drivers only send debug messages in debug context */
+#endif
+
+
+        /* Create a windowed mode window and its OpenGL context */
+        window = glfwCreateWindow(640, 480, "Hello World", NULL, NULL);
+        if (!window)
+        {
+            glfwTerminate();
+            return -1;
+
+        }
+        /* Make the window's context current */
+        glfwMakeContextCurrent(window);
+
+        glfwSwapInterval(1);    /* controls FPS or intervel between buffer(frames) */
+
+    /*  END BASIC GLFW   */
+
+
+    /* Intitialize GLEW */
+        if (glewInit() != GLEW_OK) {
+            std::cout << "Error!" << std::endl;
+        }
+    /* END */
+
+    std::cout << glGetString(GL_VERSION) << std::endl;  /* prints the version of opengl using */
+
+    SetupGLErrorPolicy();
+
+
+    { /* scope so that the cache deletes its programs before glfwTerminate destroys the context */
+
+    /* ------------- Generating Data to be used to display in the window ------------- */
+
+            // 4 positions of vertices of sqaure
+            float positions[] = {
+                -0.5f, -0.5f,    // 0
+                 0.5f, -0.5f,    // 1
+                 0.5f,  0.5f,    // 2
+                -0.5f,  0.5f     // 3
+            };
+
+            // Index data -----> position in which vertices is to be rendered to form a square
+            unsigned int indices[] = {
+                0, 1, 2,
+                2, 3, 0
+            };
+
+            unsigned int vao;
+            GLCall(glGenVertexArrays(1, &vao));
+            GLCall(glBindVertexArray(vao));
+
+            unsigned int buffer;
+            GLCall(glGenBuffers(1, &buffer));
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, buffer));
+            GLCall(glBufferData(GL_ARRAY_BUFFER, 4 * 2 * sizeof(float), positions, GL_STATIC_DRAW));
+
+            GLCall(glEnableVertexAttribArray(0));
+            GLCall(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2, 0));
+
+            unsigned int ibo;       // index buffer object
+            GLCall(glGenBuffers(1, &ibo));
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo));
+            GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, 6 * sizeof(unsigned int), indices, GL_STATIC_DRAW));
+
+            GLCall(glBindVertexArray(0));
+
+
+    /* ------------- BUILD EVERY EMBEDDED SHADER ------------- */
+
+        /* what loading from files would cost (only when the files are there) */
+        double fileMs = -1.0;
+        if (!overrideFolder.empty()) {
+            auto start = std::chrono::high_resolution_clock::now();
+            for (const EmbeddedShaders::Shader& shader : EmbeddedShaders::All)
+                ParseShader((std::filesystem::path(overrideFolder) / std::string(shader.file)).string());
+            fileMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+        }
+
+        EmbeddedProgramCache cache(overrideFolder);
+        auto start = std::chrono::high_resolution_clock::now();
+        for (const EmbeddedShaders::Shader& shader : EmbeddedShaders::All)
+            cache.Get(shader);
+        double buildMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+        std::cout << "[Embedded] " << sizeof(EmbeddedShaders::All) / sizeof(EmbeddedShaders::All[0]) << " shaders in the exe, override folder: "
+                  << (overrideFolder.empty() ? "none" : overrideFolder) << std::endl;
+        std::cout << "  " << cache.GetEmbeddedCount() << " used embedded text, " << cache.GetOverriddenCount()
+                  << " overridden by a changed file (" << cache.GetSourceMs() << " ms checking the override folder)" << std::endl;
+        if (fileMs >= 0.0)
+            std::cout << "  reading + parsing all of them from files would take " << fileMs << " ms" << std::endl;
+        std::cout << "  build (compile + link) " << buildMs << " ms" << std::endl;
+
+        unsigned int shader = cache.Get(EmbeddedShaders::Basic_UNFORMS);     /* cached already, no compile */
+        GLCall(glUseProgram(shader));
+        GLCall(int location = glGetUniformLocation(shader, "u_Color"));
+        ASSERT(location != -1);
+
+        std::cout << "  Basic - UNFORMS key " << std::hex << BASIC_UNFORMS_KEY << std::dec << " (constexpr)" << std::endl;
+
+
+    /* ------------- END OF GENERATING DATA ------------- */
+
+
+    /* ----------- Animation Variable ----------- */
+    float r = 0.0f;
+    float increment = 0.05f;
+
+
+
+    /* WHILE Loop to keep the window active till window is closed */
+    while (!glfwWindowShouldClose(window))
+    {
+        /* Render here */
+
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        GLCall(glUseProgram(shader));
+        GLCall(glUniform4f(location, r, 0.2f, 0.5f, 1.0f));
+        GLCall(glBindVertexArray(vao));
+        GLCall(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr));
+
+        if (r > 1.0f)
+            increment = -0.05f;
+        else if (r < 0.0f)
+            increment = 0.05f;
+
+        r += increment;
+
+
+        /* Swap front and back buffers */
+        glfwSwapBuffers(window);
+
+        /* Poll for and process events */
+        glfwPollEvents();
+    }
+
+    glDeleteBuffers(1, &buffer);
+    glDeleteBuffers(1, &ibo);
+    glDeleteVertexArrays(1, &vao);
+
+    }
+
+    glfwTerminate();
+    return 0;
+}
+
+
+
+
+/* Makes and compile the shader by inputing the type and Source code, view is passed with its length (no null terminator needed) */
+static unsigned int CompileShader(unsigned int shaderType, std::string_view source) {
+
+    unsigned int id = glCreateShader(shaderType);   /* generate Shader and return id */
+    const char* src = source.data();
+    int sourceLength = (int)source.size();
+    GLCall(glShaderSource(id, 1, &src, &sourceLength));     /* attaching source code to the shader */
+    GLCall(glCompileShader(id));                            /* compile shader */
+
+    /* -------- ERROR HANDLING -------- */
+        int result;
+        GLCall(glGetShaderiv(id, GL_COMPILE_STATUS, &result));
+        if (result == GL_FALSE) {
+            int length;
+            GLCall(glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length));
+            std::vector<char> message(length + 1);      /* char Array of length 'length' (_malloca is only in MSVC) */
+            GLCall(glGetShaderInfoLog(id, length, &length, message.data()));
+
+            std::cout << "Failed To Compile " << (shaderType == GL_VERTEX_SHADER ? "vertex" : "fragment") << " shader" << std::endl;
+
+            std::cout << message.data() << std::endl;
+            GLCall(glDeleteShader(id));
+            return 0;
+        }
+
+    /* -------- END ERROR HANDLING -------- */
+
+    return id;
+
+}
+
+
+/* Creates a program Which contain vertex and fragment shader */
+static int CreateShader(std::string_view vertexShader, std::string_view fragmentShader) {
+
+    GLCall(unsigned int program = glCreateProgram());                           /* generate program to store all shader and program to be run by GPU during while loop */
+    unsigned int vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
+    unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+
+    GLCall(glAttachShader(program, vs));                                        /* Attach shader to program to be run by GPU */
+    GLCall(glAttachShader(program, fs));
+    GLCall(glLinkProgram(program));
+    GLCall(glValidateProgram(program));
+    GLCall(glDeleteShader(vs));                                                 /* DELETING shader to save space as shader is already attached to program */
+    GLCall(glDeleteShader(fs));
+
+    return program;
+
+}
+
+
+/* Read file and output vertex and fragment shader source code */
+static ShaderProgramSource ParseShader(const std::string& filepath) {
+
+    std::ifstream stream(filepath);
+
+    enum class ShaderType {
+        NONE = -1, VERTEX = 0, FRAGMENT = 1
+    };
+
+    std::string line;
+    std::stringstream ss[2];
+    ShaderType type = ShaderType::NONE;
+    while (getline(stream, line)) {
+
+        if (!line.empty() && line.back() == '\r')     /* generator removes \r too, so an unchanged file has the embedded hash */
+            line.pop_back();
+
+        if (line.find("#shader") != std::string::npos) {
+
+            if (line.find("vertex") != std::string::npos)
+                type = ShaderType::VERTEX;
+            else if (line.find("fragment") != std::string::npos)
+                type = ShaderType::FRAGMENT;
+
+        }
+        else if (type != ShaderType::NONE) {
+            ss[int(type)] << line << '\n';
+        }
+    }
+
+    return { ss[0].str(), ss[1].str() };
+}
@@ -0,0 +1,624 @@
+/*
+
+Vertex Layout (compile time layout, packed attribute formats)
+
+the vertex format is written by hand:  glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2, 0)
+and the buffer size too:  4 * 2 * sizeof(float)   (HW_5 - HW_8 had 6 * 2 for 4 vertices -> read past the array)
+one wrong number and the GPU reads garbage, nothing tells us
+
+VertexLayout<Attr<location, Format>...> knows everything at compile time
+
+---> Stride and Offset<i>() are constexpr (sum of the sizes before), checked with static_assert against
+     sizeof / offsetof of the C++ vertex struct, so struct and layout can not drift apart
+---> Apply() makes the glEnableVertexAttribArray + glVertexAttribPointer calls with those constants
+     (glVertexAttribIPointer for integer formats)
+---> locations must be unique and every attribute starts at a multiple of 4 bytes (static_assert)
+
+smaller formats, shader still sees vec4 (GPU converts when fetching)
+
+---> Half4         4 x 16 bit float  (GL_HALF_FLOAT)                     8 bytes instead of 12 / 16
+---> Snorm1010102  x, y, z 10 bit + w 2 bit signed normalized (-1..1)    4 bytes instead of 12, good for normals
+---> UByte4N       4 x uint8 normalized (0..1)                           4 bytes instead of 16, good for colors
+
+a 512 x 512 grid is made with floats (40 bytes per vertex) and packed (16 bytes per vertex) and both are timed
+
+*/
+
+
+
+
+#include <GL\glew.h>
+
+#include <GLFW/glfw3.h>
+
+
+#include <iostream>
+#include <fstream>  // to read file
+#include <string>   // To use getline func
+#include <sstream>
+#include <vector>
+#include <chrono>
+#include <utility>  // index_sequence
+#include <cstddef>  // offsetof
+#include <cstdint>
+#include <cstring>  // memcpy
+#include <math.h>
+
+
+/* ------------ ERROR CHECK POLICY ------------ */
+/*
+GL_CHECK_NONE   -> GLCall(x) is just x, nothing is checked (release)
+GL_CHECK_ASYNC  -> GLCall(x) is just x, driver reports errors later through glDebugMessageCallback (needs KHR_debug / GL 4.3)
+GL_CHECK_STRICT -> glGetError before and after every call, stops on the line with the error (old GLCall)
+
+default is NONE for release (NDEBUG) and STRICT for debug, or pass -DGL_CHECK_POLICY=1 to compiler to choose
+*/
+#define GL_CHECK_NONE   0
+#define GL_CHECK_ASYNC  1
+#define GL_CHECK_STRICT 2
+
+#ifndef GL_CHECK_POLICY
+    #ifdef NDEBUG
+        #define GL_CHECK_POLICY GL_CHECK_NONE
+    #else
+        #define GL_CHECK_POLICY GL_CHECK_STRICT
+    #endif
+#endif
+
+
+/* ------------ MACRO ------------ */
+
+/* __debugbreak is only in MSVC, on gcc / clang SIGTRAP does same thing (debugger stops there) */
+#if defined(_MSC_VER)
+    #define DEBUG_BREAK() __debugbreak()
+#elif defined(__GNUC__) || defined(__clang__)
+    #include <signal.h>
+    #define DEBUG_BREAK() raise(SIGTRAP)
+#else
+    #include <cstdlib>
+    #define DEBUG_BREAK() std::abort()
+#endif
+
+#define ASSERT(x) if (!(x)) DEBUG_BREAK();
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+    #define GLCall(x) GLCLearError();\
+        x;\
+        ASSERT(GlLogCall(#x, __FILE__, __LINE__))
+#else
+    #define GLCall(x) x
+#endif
+
+/*
+# before a fucntion pass it as a stringand __FILE__and __LINE__ are macros to get file loc and line of fucntion
+and since MACROS HAS TO BE IN SAME LINE we use \ before line ends to write macros in multiple lines
+*/
+
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+static void GLCLearError() {
+    while (glGetError() != GL_NO_ERROR);    // glGetError get error and we get all the error until there are no arror left
+}
+
+static bool GlLogCall(const char* function, const char* file, int line) {
+    bool ok = true;
+    while (GLenum error = glGetError()) {
+        std::cout << "[OpenGl Error] (" << error << "): " << function << " " << file << ":" << line << std::endl;
+        ok = false;
+    }
+    return ok;
+}
+#endif
+
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+/* called by the driver (maybe from its own thread) when something is wrong */
+static void APIENTRY GlDebugCallback(GLenum /*source*/, GLenum type, GLuint id, GLenum severity, GLsizei /*length*/, const GLchar* message, const void* /*userParam*/) {
+
+    const char* level = severity == GL_DEBUG_SEVERITY_HIGH ? "HIGH" : severity == GL_DEBUG_SEVERITY_MEDIUM ? "MEDIUM" : "LOW";
+    std::cout << "[OpenGl Debug] (" << level << (type == GL_DEBUG_TYPE_ERROR ? ", error" : "") << ", id " << id << "): " << message << std::endl;
+}
+#endif
+
+/* call once after glewInit, sets up whatever the chosen policy needs */
+static void SetupGLErrorPolicy() {
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+    if (GLEW_VERSION_4_3 || GLEW_KHR_debug) {
+        glEnable(GL_DEBUG_OUTPUT);
+        glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);     /* driver does not have to report inside the call, so no slow down */
+        glDebugMessageCallback(GlDebugCallback, nullptr);
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);  /* skip info messages */
+        std::cout << "GL errors: async (debug callback)" << std::endl;
+    }
+    else {
+        std::cout << "GL errors: async asked but KHR_debug is not there, errors are not checked" << std::endl;
+    }
+#elif GL_CHECK_POLICY == GL_CHECK_STRICT
+    std::cout << "GL errors: strict (glGetError after every call)" << std::endl;
+#else
+    std::cout << "GL errors: off" << std::endl;
+#endif
+}
+
+
+
+struct ShaderProgramSource {
+    std::string VertexSource;
+    std::string FragmentSource;
+};
+
+static ShaderProgramSource ParseShader(const std::string& filepath);
+
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader);
+
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source);
+
+
+
+/* ------------- ATTRIBUTE FORMATS ------------- */
+
+/* how one attribute is stored in the buffer */
+template<int ComponentCount, unsigned int GLType, size_t ByteSize, bool IsNormalized = false, bool IsInteger = false>
+struct AttribFormat {
+    static constexpr int Components = ComponentCount;
+    static constexpr unsigned int Type = GLType;
+    static constexpr size_t Size = ByteSize;
+    static constexpr bool Normalized = IsNormalized;
+    static constexpr bool Integer = IsInteger;      /* shader sees int / uint, not float */
+};
+
+using Float2       = AttribFormat<2, GL_FLOAT, 8>;
+using Float3       = AttribFormat<3, GL_FLOAT, 12>;
+using Float4       = AttribFormat<4, GL_FLOAT, 16>;
+using Half2        = AttribFormat<2, GL_HALF_FLOAT, 4>;
+using Half4        = AttribFormat<4, GL_HALF_FLOAT, 8>;
+using Snorm1010102 = AttribFormat<4, GL_INT_2_10_10_10_REV, 4, true>;
+using UByte4N      = AttribFormat<4, GL_UNSIGNED_BYTE, 4, true>;
+using UInt1        = AttribFormat<1, GL_UNSIGNED_INT, 4, false, true>;
+
+template<unsigned int Location, typename Format>
+struct Attr {
+    static constexpr unsigned int location = Location;
+    using format = Format;
+};
+
+
+/* ------------- VERTEX LAYOUT ------------- */
+
+/* attributes one after other in one buffer, in the order given */
+template<typename... Attrs>
+class VertexLayout {
+public:
+    static_assert(sizeof...(Attrs) > 0, "VertexLayout needs at least one attribute");
+
+    static constexpr size_t Count = sizeof...(Attrs);
+    static constexpr size_t Stride = (Attrs::format::Size + ...);
+
+    template<size_t Index>
+    static constexpr size_t Offset() {
+        static_assert(Index < Count, "attribute index out of range");
+        constexpr size_t sizes[] = { Attrs::format::Size... };
+        size_t offset = 0;
+        for (size_t i = 0; i < Index; i++)
+            offset += sizes[i];
+        return offset;
+    }
+
+    /* enables and sets every attribute for the buffer bound to GL_ARRAY_BUFFER (VAO must be bound) */
+    static void Apply(size_t baseOffset = 0) {
+        ApplyAll(baseOffset, std::index_sequence_for<Attrs...>{});
+    }
+
+private:
+    static constexpr bool UniqueLocations() {
+        constexpr unsigned int locations[] = { Attrs::location... };
+        for (size_t i = 0; i < Count; i++)
+            for (size_t j = i + 1; j < Count; j++)
+                if (locations[i] == locations[j])
+                    return false;
+        return true;
+    }
+
+    static constexpr bool Aligned() {
+        constexpr size_t sizes[] = { Attrs::format::Size... };
+        for (size_t i = 0; i < Count; i++)
+            if (sizes[i] % 4 != 0)          /* then next offset would not be a multiple of 4 */
+                return false;
+        return true;
+    }
+
+    static_assert(UniqueLocations(), "two attributes have the same location");
+    static_assert(Aligned(), "attribute sizes must be multiples of 4 bytes (some GPUs are slow or wrong otherwise)");
+
+    template<size_t... Index>
+    static void ApplyAll(size_t baseOffset, std::index_sequence<Index...>) {
+        (ApplyOne<Attrs, Offset<Index>()>(baseOffset), ...);
+    }
+
+    template<typename A, size_t AttribOffset>
+    static void ApplyOne(size_t baseOffset) {
+        using F = typename A::format;
+        const void* pointer = (const void*)(baseOffset + AttribOffset);
+
+        GLCall(glEnableVertexAttribArray(A::location));
+        if constexpr (F::Integer) {
+            GLCall(glVertexAttribIPointer(A::location, F::Components, F::Type, (int)Stride, pointer));
+        }
+        else {
+            GLCall(glVertexAttribPointer(A::location, F::Components, F::Type, F::Normalized ? GL_TRUE : GL_FALSE, (int)Stride, pointer));
+        }
+    }
+};
+
+
+
+/* ------------- PACKING ------------- */
+
+/* float -> 16 bit float, rounds to nearest even, too big -> infinity */
+static uint16_t FloatToHalf(float value) {
+    uint32_t x;
+    memcpy(&x, &value, sizeof(x));
+
+    uint32_t sign = (x >> 16) & 0x8000;
+    uint32_t exponent8 = (x >> 23) & 0xFF;
+    uint32_t mantissa = x & 0x7FFFFF;
+
+    if (exponent8 == 0xFF)                                  /* inf or nan */
+        return (uint16_t)(sign | 0x7C00 | (mantissa ? 0x200 : 0));
+
+    int exponent = (int)exponent8 - 127 + 15;
+    if (exponent >= 31)                                     /* too big */
+        return (uint16_t)(sign | 0x7C00);
+
+    if (exponent <= 0) {                                    /* subnormal half (or 0) */
+        if (exponent < -10)
+            return (uint16_t)sign;
+        mantissa |= 0x800000;
+        uint32_t shift = (uint32_t)(14 - exponent);
+        uint32_t half = mantissa >> shift;
+        uint32_t rest = mantissa & ((1u << shift) - 1), halfway = 1u << (shift - 1);
+        if (rest > halfway || (rest == halfway && (half & 1)))
+            half++;
+        return (uint16_t)(sign | half);
+    }
+
+    uint32_t half = sign | ((uint32_t)exponent << 10) | (mantissa >> 13);
+    uint32_t rest = mantissa & 0x1FFF;
+    if (rest > 0x1000 || (rest == 0x1000 && (half & 1)))
+        half++;                                             /* carry into exponent is still right */
+    return (uint16_t)half;
+}
+
+/* -1..1 -> signed 'bits' bit integer */
+static uint32_t PackSnorm(float value, int bits) {
+    float clamped = value < -1.0f ? -1.0f : value > 1.0f ? 1.0f : value;
+    int max = (1 << (bits - 1)) - 1;
+    int i = (int)lroundf(clamped * max);
+    return (uint32_t)i & ((1u << bits) - 1);
+}
+
+/* GL_INT_2_10_10_10_REV: x in low bits, w in the 2 high bits */
+static uint32_t PackSnorm1010102(float x, float y, float z, float w = 0.0f) {
+    return PackSnorm(x, 10) | (PackSnorm(y, 10) << 10) | (PackSnorm(z, 10) << 20) | (PackSnorm(w, 2) << 30);
+}
+
+static uint8_t PackUnorm8(float value) {
+    float clamped = value < 0.0f ? 0.0f : value > 1.0f ? 1.0f : value;
+    return (uint8_t)lroundf(clamped * 255.0f);
+}
+
+
+
+/* ------------- VERTICES ------------- */
+
+struct FloatVertex {
+    float position[3];
+    float normal[3];
+    float color[4];
+};
+using FloatLayout = VertexLayout<Attr<0, Float3>, Attr<1, Float3>, Attr<2, Float4>>;
+
+static_assert(sizeof(FloatVertex) == FloatLayout::Stride, "FloatVertex and FloatLayout differ");
+static_assert(offsetof(FloatVertex, normal) == FloatLayout::Offset<1>(), "FloatVertex and FloatLayout differ");
+static_assert(offsetof(FloatVertex, color) == FloatLayout::Offset<2>(), "FloatVertex and FloatLayout differ");
+
+
+struct PackedVertex {
+    uint16_t position[4];       /* half floats, w = 1 */
+    uint32_t normal;            /* 2_10_10_10 */
+    uint8_t color[4];
+};
+using PackedLayout = VertexLayout<Attr<0, Half4>, Attr<1, Snorm1010102>, Attr<2, UByte4N>>;
+
+static_assert(sizeof(PackedVertex) == PackedLayout::Stride, "PackedVertex and PackedLayout differ");
+static_assert(offsetof(PackedVertex, normal) == PackedLayout::Offset<1>(), "PackedVertex and PackedLayout differ");
+static_assert(offsetof(PackedVertex, color) == PackedLayout::Offset<2>(), "PackedVertex and PackedLayout differ");
+
+
+/* wavy grid, 'side' x 'side' vertices, same data in both formats */
+static void MakeGrid(unsigned int side, std::vector<FloatVertex>& floats, std::vector<PackedVertex>& packed, std::vector<unsigned int>& indices) {
+
+    for (unsigned int j = 0; j < side; j++) {
+        for (unsigned int i = 0; i < side; i++) {
+            float u = (float)i / (side - 1), v = (float)j / (side - 1);
+            float x = -0.9f + 1.8f * u, y = -0.9f + 1.8f * v;
+            float height = 0.05f * sinf(x * 12.0f) * cosf(y * 9.0f);
+
+            /* normal from the slope of the height */
+            float dx = 0.05f * 12.0f * cosf(x * 12.0f) * cosf(y * 9.0f);
+            float dy = -0.05f * 9.0f * sinf(x * 12.0f) * sinf(y * 9.0f);
+            float length = sqrtf(dx * dx + dy * dy + 1.0f);
+            float n[3] = { -dx / length, -dy / length, 1.0f / length };
+
+            float c[4] = { 0.3f + u * 0.6f, 0.4f + height * 6.0f, 0.9f - v * 0.5f, 1.0f };
+
+            floats.push_back({ { x, y, height }, { n[0], n[1], n[2] }, { c[0], c[1], c[2], c[3] } });
+            packed.push_back({ { FloatToHalf(x), FloatToHalf(y), FloatToHalf(height), FloatToHalf(1.0f) },
+                               PackSnorm1010102(n[0], n[1], n[2]),
+                               { PackUnorm8(c[0]), PackUnorm8(c[1]), PackUnorm8(c[2]), PackUnorm8(c[3]) } });
+        }
+    }
+
+    for (unsigned int j = 0; j + 1 < side; j++) {
+        for (unsigned int i = 0; i + 1 < side; i++) {
+            unsigned int a = j * side + i, b = a + 1, c = a + side, d = c + 1;
+            indices.insert(indices.end(), { a, b, d, d, c, a });
+        }
+    }
+}
+
+/* VAO with one vertex buffer described by 'Layout' and the shared index buffer */
+template<typename Layout, typename Vertex>
+static unsigned int MakeVertexArray(const std::vector<Vertex>& vertices, unsigned int ibo, unsigned int& vbo) {
+    static_assert(sizeof(Vertex) == Layout::Stride, "vertex struct does not match the layout");
+
+    unsigned int vao;
+    GLCall(glGenVertexArrays(1, &vao));
+    GLCall(glBindVertexArray(vao));
+
+    GLCall(glGenBuffers(1, &vbo));
+    GLCall(glBindBuffer(GL_ARRAY_BUFFER, vbo));
+    GLCall(glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), vertices.data(), GL_STATIC_DRAW));     /* size from the type, not by hand */
+
+    Layout::Apply();
+    GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo));
+
+    GLCall(glBindVertexArray(0));
+    return vao;
+}
+
+
+
+int main(void)
+{
+    /* GLFW BASIC STUFF */
+        GLFWwindow* window;
+
+        /* Initialize the GLFW library */
+        if (!glfwInit())
+            return -1;
+
+
+        /* setting version 3.3 and core profile (i.e mordern opengl) */
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);    /* most drivers only send debug messages in debug context */
+#endif
+
+
+        /* Create a windowed mode window and its OpenGL context */
+        window = glfwCreateWindow(640, 480, "Hello World", NULL, NULL);
+        if (!window)
+        {
+            glfwTerminate();
+            return -1;
+
+        }
+        /* Make the window's context current */
+        glfwMakeContextCurrent(window);
+
+        glfwSwapInterval(1);    /* controls FPS or intervel between buffer(frames) */
+
+    /*  END BASIC GLFW   */
+
+
+    /* Intitialize GLEW */
+        if (glewInit() != GLEW_OK) {
+            std::cout << "Error!" << std::endl;
+        }
+    /* END */
+
+    std::cout << glGetString(GL_VERSION) << std::endl;  /* prints the version of opengl using */
+
+    SetupGLErrorPolicy();
+
+
+
+    /* ------------- Generating Data to be used to display in the window ------------- */
+
+            const unsigned int side = 512;
+            std::vector<FloatVertex> floatVertices;
+            std::vector<PackedVertex> packedVertices;
+            std::vector<unsigned int> indices;
+            MakeGrid(side, floatVertices, packedVertices, indices);
+
+            unsigned int ibo;       // index buffer object, same for both
+            GLCall(glGenBuffers(1, &ibo));
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo));
+            GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW));
+
+            unsigned int floatVbo, packedVbo;
+            unsigned int floatVao = MakeVertexArray<FloatLayout>(floatVertices, ibo, floatVbo);
+            unsigned int packedVao = MakeVertexArray<PackedLayout>(packedVertices, ibo, packedVbo);
+
+
+        ShaderProgramSource shaderSource = ParseShader("res/shaders/Basic - PACKED.shader");
+        unsigned int shader = CreateShader(shaderSource.VertexSource, shaderSource.FragmentSource);
+        GLCall(glUseProgram(shader));
+        GLCall(int location = glGetUniformLocation(shader, "u_Light"));
+        ASSERT(location != -1);
+        GLCall(glUniform3f(location, 0.3f, 0.5f, 1.0f));
+
+
+
+    /* ------------- BENCHMARK (same grid, 2 vertex formats) ------------- */
+
+        glfwSwapInterval(0);
+
+        const int benchFrames = 50, drawsPerFrame = 20;
+        const int indexCount = (int)indices.size();
+
+        auto runFrames = [&](unsigned int vao) {
+            GLCall(glBindVertexArray(vao));
+            GLCall(glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr));    /* warm up */
+            glFinish();
+
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int frame = 0; frame < benchFrames; frame++) {
+                glClear(GL_COLOR_BUFFER_BIT);
+                for (int d = 0; d < drawsPerFrame; d++) {
+                    GLCall(glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr));
+                }
+                glFinish();
+            }
+            return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count() / benchFrames;
+        };
+
+        double floatMs = runFrames(floatVao);
+        double packedMs = runFrames(packedVao);
+
+        std::cout << "[Benchmark] " << floatVertices.size() << " vertices, " << drawsPerFrame << " draws per frame" << std::endl;
+        std::cout << "  float  : " << FloatLayout::Stride << " bytes/vertex, VBO " << floatVertices.size() * sizeof(FloatVertex) / 1024 << " KB, "
+                  << floatMs << " ms/frame" << std::endl;
+        std::cout << "  packed : " << PackedLayout::Stride << " bytes/vertex, VBO " << packedVertices.size() * sizeof(PackedVertex) / 1024 << " KB, "
+                  << packedMs << " ms/frame" << std::endl;
+
+        glfwSwapInterval(1);
+
+
+    /* ------------- END OF GENERATING DATA ------------- */
+
+
+    /* ----------- Animation Variable ----------- */
+    float angle = 0.0f;
+
+
+
+    /* WHILE Loop to keep the window active till window is closed */
+    while (!glfwWindowShouldClose(window))
+    {
+        /* Render here */
+
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        GLCall(glUseProgram(shader));
+        GLCall(glUniform3f(location, cosf(angle), sinf(angle), 0.7f));     /* light goes around */
+        GLCall(glBindVertexArray(packedVao));
+        GLCall(glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr));
+
+        angle += 0.02f;
+
+
+        /* Swap front and back buffers */
+        glfwSwapBuffers(window);
+
+        /* Poll for and process events */
+        glfwPollEvents();
+    }
+
+    glDeleteProgram(shader);
+    glDeleteBuffers(1, &floatVbo);
+    glDeleteBuffers(1, &packedVbo);
+    glDeleteBuffers(1, &ibo);
+    glDeleteVertexArrays(1, &floatVao);
+    glDeleteVertexArrays(1, &packedVao);
+
+    glfwTerminate();
+    return 0;
+}
+
+
+
+
+/* Makes and compile the shader by inputing the type and Source code */
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source) {
+
+    unsigned int id = glCreateShader(shaderType);   /* generate Shader and return id */
+    const char* src = source.c_str();               /* convert inputed string to char* */
+    GLCall(glShaderSource(id, 1, &src, nullptr));           /* attaching source code to the shader */
+    GLCall(glCompileShader(id));                            /* compile shader */
+
+    /* -------- ERROR HANDLING -------- */
+        int result;
+        GLCall(glGetShaderiv(id, GL_COMPILE_STATUS, &result));
+        if (result == GL_FALSE) {
+            int length;
+            GLCall(glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length));
+            std::vector<char> message(length + 1);      /* char Array of length 'length' (_malloca is only in MSVC) */
+            GLCall(glGetShaderInfoLog(id, length, &length, message.data()));
+
+            std::cout << "Failed To Compile " << (shaderType == GL_VERTEX_SHADER ? "vertex" : "fragment") << " shader" << std::endl;
+
+            std::cout << message.data() << std::endl;
+            GLCall(glDeleteShader(id));
+            return 0;
+        }
+
+    /* -------- END ERROR HANDLING -------- */
+
+    return id;
+
+}
+
+
+/* Creates a program Which contain vertex and fragment shader */
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader) {
+
+    GLCall(unsigned int program = glCreateProgram());                           /* generate program to store all shader and program to be run by GPU during while loop */
+    unsigned int vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
+    unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+
+    GLCall(glAttachShader(program, vs));                                        /* Attach shader to program to be run by GPU */
+    GLCall(glAttachShader(program, fs));
+    GLCall(glLinkProgram(program));
+    GLCall(glValidateProgram(program));
+    GLCall(glDeleteShader(vs));                                                 /* DELETING shader to save space as shader is already attached to program */
+    GLCall(glDeleteShader(fs));
+
+    return program;
+
+}
+
+
+/* Read file and output vertex and fragment shader source code */
+static ShaderProgramSource ParseShader(const std::string& filepath) {
+
+    std::ifstream stream(filepath);
+
+    enum class ShaderType {
+        NONE = -1, VERTEX = 0, FRAGMENT = 1
+    };
+
+    std::string line;
+    std::stringstream ss[2];
+    ShaderType type = ShaderType::NONE;
+    while (getline(stream, line)) {
+
+        if (line.find("#shader") != std::string::npos) {
+
+            if (line.find("vertex") != std::string::npos)
+                type = ShaderType::VERTEX;
+            else if (line.find("fragment") != std::string::npos)
+                type = ShaderType::FRAGMENT;
+
+        }
+        else {
+            ss[int(type)] << line << '\n';
+        }
+    }
+
+    return { ss[0].str(), ss[1].str() };
+}
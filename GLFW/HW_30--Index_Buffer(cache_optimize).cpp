@@ -0,0 +1,813 @@
+/*
+
+Index Buffer (automatic index width, vertex cache optimization)
+
+every sample has  unsigned int indices[]  +  GL_UNSIGNED_INT,  4 bytes per index even for a square with 4 vertices
+
+---> IndexBuffer looks at the biggest index and stores the indices as
+         GL_UNSIGNED_BYTE   max index < 256        1 byte
+         GL_UNSIGNED_SHORT  max index < 65536      2 bytes
+         GL_UNSIGNED_INT    everything else        4 bytes
+     glDrawElements gets GetType() instead of a hard coded GL_UNSIGNED_INT
+     (some GPUs convert 8 bit indices in the driver, so bytes can be turned off with allowBytes = false)
+
+the GPU keeps the last few transformed vertices (post transform cache), an index that is still in there
+does not run the vertex shader again, how often it runs depends on the order of the triangles
+
+---> ACMR (average cache miss ratio) = vertex shader runs / triangles, simulated with a FIFO cache
+     1.0 - 0.5 is good (a big grid can get near 0.5), 3.0 is the worst (nothing is reused)
+---> OptimizeVertexCache() reorders the triangles (Tom Forsyth, "Linear-Speed Vertex Cache Optimisation"):
+     every vertex gets a score from its place in a simulated LRU cache and how many triangles still use it,
+     the triangle with the best score is drawn next
+---> OptimizeVertexFetch() renumbers the vertices in the order the new index buffer uses them first,
+     so the vertex buffer is read from front to back (less memory traffic / cache misses when fetching)
+
+both are fast enough to run when a mesh is loaded (online) and can also run in a tool before shipping (offline)
+
+a 225 x 225 grid (100352 triangles) with triangles and vertices in random order (like many exported meshes)
+is optimized at start: ACMR before / after, index memory before / after, optimize time and draw time
+
+*/
+
+
+
+
+#include <GL\glew.h>
+
+#include <GLFW/glfw3.h>
+
+
+#include <iostream>
+#include <fstream>  // to read file
+#include <string>   // To use getline func
+#include <sstream>
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <chrono>
+#include <cstdint>
+#include <math.h>
+
+
+/* ------------ ERROR CHECK POLICY ------------ */
+/*
+GL_CHECK_NONE   -> GLCall(x) is just x, nothing is checked (release)
+GL_CHECK_ASYNC  -> GLCall(x) is just x, driver reports errors later through glDebugMessageCallback (needs KHR_debug / GL 4.3)
+GL_CHECK_STRICT -> glGetError before and after every call, stops on the line with the error (old GLCall)
+
+default is NONE for release (NDEBUG) and STRICT for debug, or pass -DGL_CHECK_POLICY=1 to compiler to choose
+*/
+#define GL_CHECK_NONE   0
+#define GL_CHECK_ASYNC  1
+#define GL_CHECK_STRICT 2
+
+#ifndef GL_CHECK_POLICY
+    #ifdef NDEBUG
+        #define GL_CHECK_POLICY GL_CHECK_NONE
+    #else
+        #define GL_CHECK_POLICY GL_CHECK_STRICT
+    #endif
+#endif
+
+
+/* ------------ MACRO ------------ */
+
+/* __debugbreak is only in MSVC, on gcc / clang SIGTRAP does same thing (debugger stops there) */
+#if defined(_MSC_VER)
+    #define DEBUG_BREAK() __debugbreak()
+#elif defined(__GNUC__) || defined(__clang__)
+    #include <signal.h>
+    #define DEBUG_BREAK() raise(SIGTRAP)
+#else
+    #include <cstdlib>
+    #define DEBUG_BREAK() std::abort()
+#endif
+
+#define ASSERT(x) if (!(x)) DEBUG_BREAK();
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+    #define GLCall(x) GLCLearError();\
+        x;\
+        ASSERT(GlLogCall(#x, __FILE__, __LINE__))
+#else
+    #define GLCall(x) x
+#endif
+
+/*
+# before a fucntion pass it as a stringand __FILE__and __LINE__ are macros to get file loc and line of fucntion
+and since MACROS HAS TO BE IN SAME LINE we use \ before line ends to write macros in multiple lines
+*/
+
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+static void GLCLearError() {
+    while (glGetError() != GL_NO_ERROR);    // glGetError get error and we get all the error until there are no arror left
+}
+
+static bool GlLogCall(const char* function, const char* file, int line) {
+    bool ok = true;
+    while (GLenum error = glGetError()) {
+        std::cout << "[OpenGl Error] (" << error << "): " << function << " " << file << ":" << line << std::endl;
+        ok = false;
+    }
+    return ok;
+}
+#endif
+
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+/* called by the driver (maybe from its own thread) when something is wrong */
+static void APIENTRY GlDebugCallback(GLenum /*source*/, GLenum type, GLuint id, GLenum severity, GLsizei /*length*/, const GLchar* message, const void* /*userParam*/) {
+
+    const char* level = severity == GL_DEBUG_SEVERITY_HIGH ? "HIGH" : severity == GL_DEBUG_SEVERITY_MEDIUM ? "MEDIUM" : "LOW";
+    std::cout << "[OpenGl Debug] (" << level << (type == GL_DEBUG_TYPE_ERROR ? ", error" : "") << ", id " << id << "): " << message << std::endl;
+}
+#endif
+
+/* call once after glewInit, sets up whatever the chosen policy needs */
+static void SetupGLErrorPolicy() {
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+    if (GLEW_VERSION_4_3 || GLEW_KHR_debug) {
+        glEnable(GL_DEBUG_OUTPUT);
+        glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);     /* driver does not have to report inside the call, so no slow down */
+        glDebugMessageCallback(GlDebugCallback, nullptr);
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);  /* skip info messages */
+        std::cout << "GL errors: async (debug callback)" << std::endl;
+    }
+    else {
+        std::cout << "GL errors: async asked but KHR_debug is not there, errors are not checked" << std::endl;
+    }
+#elif GL_CHECK_POLICY == GL_CHECK_STRICT
+    std::cout << "GL errors: strict (glGetError after every call)" << std::endl;
+#else
+    std::cout << "GL errors: off" << std::endl;
+#endif
+}
+
+
+
+struct ShaderProgramSource {
+    std::string VertexSource;
+    std::string FragmentSource;
+};
+
+static ShaderProgramSource ParseShader(const std::string& filepath);
+
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader);
+
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source);
+
+
+
+/* ------------- INDEX BUFFER ------------- */
+
+static size_t IndexTypeSize(unsigned int type) {
+    return type == GL_UNSIGNED_BYTE ? 1 : type == GL_UNSIGNED_SHORT ? 2 : 4;
+}
+
+/* smallest type that holds 'maxIndex', but not smaller than 'minType' */
+static unsigned int ChooseIndexType(unsigned int maxIndex, unsigned int minType = GL_UNSIGNED_BYTE) {
+    size_t minSize = IndexTypeSize(minType);
+    if (minSize <= 1 && maxIndex <= 0xFF)
+        return GL_UNSIGNED_BYTE;
+    if (minSize <= 2 && maxIndex <= 0xFFFF)
+        return GL_UNSIGNED_SHORT;
+    return GL_UNSIGNED_INT;
+}
+
+template<typename T>
+static std::vector<T> NarrowIndices(const unsigned int* indices, size_t count) {
+    std::vector<T> narrow(count);
+    for (size_t i = 0; i < count; i++)
+        narrow[i] = (T)indices[i];
+    return narrow;
+}
+
+/* indices are always given as unsigned int, the buffer stores them as small as possible */
+class IndexBuffer {
+public:
+    /* binds to GL_ELEMENT_ARRAY_BUFFER, so the VAO which is bound keeps it */
+    IndexBuffer(const unsigned int* indices, size_t count, unsigned int minType = GL_UNSIGNED_BYTE)
+        : m_Count(count) {
+
+        unsigned int maxIndex = 0;
+        for (size_t i = 0; i < count; i++)
+            maxIndex = std::max(maxIndex, indices[i]);
+        m_Type = ChooseIndexType(maxIndex, minType);
+        m_Size = count * IndexTypeSize(m_Type);
+
+        GLCall(glGenBuffers(1, &m_Buffer));
+        GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_Buffer));
+
+        if (m_Type == GL_UNSIGNED_BYTE) {
+            std::vector<uint8_t> narrow = NarrowIndices<uint8_t>(indices, count);
+            GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_Size, narrow.data(), GL_STATIC_DRAW));
+        }
+        else if (m_Type == GL_UNSIGNED_SHORT) {
+            std::vector<uint16_t> narrow = NarrowIndices<uint16_t>(indices, count);
+            GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_Size, narrow.data(), GL_STATIC_DRAW));
+        }
+        else {
+            GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_Size, indices, GL_STATIC_DRAW));     /* no copy needed */
+        }
+    }
+
+    explicit IndexBuffer(const std::vector<unsigned int>& indices, unsigned int minType = GL_UNSIGNED_BYTE)
+        : IndexBuffer(indices.data(), indices.size(), minType) {}
+
+    ~IndexBuffer() {
+        glDeleteBuffers(1, &m_Buffer);
+    }
+
+    IndexBuffer(const IndexBuffer&) = delete;
+    IndexBuffer& operator=(const IndexBuffer&) = delete;
+
+    void Bind() const {
+        GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_Buffer));
+    }
+
+    /* the VAO with this buffer must be bound */
+    void Draw() const {
+        GLCall(glDrawElements(GL_TRIANGLES, (int)m_Count, m_Type, nullptr));
+    }
+
+    unsigned int GetType() const { return m_Type; }
+    size_t GetCount() const { return m_Count; }
+    size_t GetSize() const { return m_Size; }
+
+private:
+    unsigned int m_Buffer = 0;
+    unsigned int m_Type = GL_UNSIGNED_INT;
+    size_t m_Count = 0, m_Size = 0;
+};
+
+static const char* IndexTypeName(unsigned int type) {
+    return type == GL_UNSIGNED_BYTE ? "GL_UNSIGNED_BYTE" : type == GL_UNSIGNED_SHORT ? "GL_UNSIGNED_SHORT" : "GL_UNSIGNED_INT";
+}
+
+
+
+/* ------------- CACHE SIMULATION ------------- */
+
+struct VertexCacheStats {
+    double acmr = 0.0;          /* vertex shader runs per triangle */
+    double atvr = 0.0;          /* vertex shader runs per vertex, 1.0 is the best possible */
+    double overfetch = 0.0;     /* bytes read from the vertex buffer / its size, 1.0 = every byte once */
+};
+
+/* FIFO post transform cache of 'cacheSize' vertices, vertex fetch through 64 lines of 64 bytes */
+static VertexCacheStats AnalyzeVertexCache(const std::vector<unsigned int>& indices, unsigned int vertexCount, size_t vertexSize, unsigned int cacheSize = 16) {
+
+    const size_t lineSize = 64, lineCount = 64;
+
+    /* an entry is in the FIFO when it was put in during the last 'size' insertions */
+    std::vector<unsigned int> vertexTime(vertexCount, 0);
+    unsigned int vertexClock = cacheSize + 1;
+
+    std::vector<unsigned int> lineTime((vertexCount * vertexSize + lineSize - 1) / lineSize, 0);
+    unsigned int lineClock = lineCount + 1;
+
+    size_t shaderRuns = 0, linesFetched = 0;
+    for (unsigned int index : indices) {
+        if (vertexClock - vertexTime[index] <= cacheSize)
+            continue;
+        vertexTime[index] = vertexClock++;
+        shaderRuns++;
+
+        for (size_t line = index * vertexSize / lineSize; line <= ((index + 1) * vertexSize - 1) / lineSize; line++) {
+            if (lineClock - lineTime[line] <= lineCount)
+                continue;
+            lineTime[line] = lineClock++;
+            linesFetched++;
+        }
+    }
+
+    VertexCacheStats stats;
+    stats.acmr = indices.empty() ? 0.0 : (double)shaderRuns / (indices.size() / 3);
+    stats.atvr = vertexCount == 0 ? 0.0 : (double)shaderRuns / vertexCount;
+    stats.overfetch = vertexCount == 0 ? 0.0 : (double)(linesFetched * lineSize) / (vertexCount * vertexSize);
+    return stats;
+}
+
+
+
+/* ------------- VERTEX CACHE OPTIMIZATION (Forsyth) ------------- */
+
+namespace Forsyth {
+
+    const int CacheSize = 32;               /* simulated LRU cache, works well for real caches of 16 - 32 */
+    const float CacheDecayPower = 1.5f;
+    const float LastTriangleScore = 0.75f;  /* lower than the next ones, the 3 newest vertices were just used */
+    const float ValenceBoostScale = 2.0f;   /* vertices with few triangles left get a boost, so no single triangles are left behind */
+    const float ValenceBoostPower = 0.5f;
+
+    static float VertexScore(int cachePosition, unsigned int trianglesLeft) {
+        if (trianglesLeft == 0)
+            return -1.0f;       /* not used anymore */
+
+        float score = 0.0f;
+        if (cachePosition >= 0) {
+            if (cachePosition < 3)
+                score = LastTriangleScore;
+            else
+                score = powf(1.0f - (float)(cachePosition - 3) / (CacheSize - 3), CacheDecayPower);
+        }
+        return score + ValenceBoostScale * powf((float)trianglesLeft, -ValenceBoostPower);
+    }
+}
+
+/* returns the same triangles in an order which reuses the post transform cache */
+static std::vector<unsigned int> OptimizeVertexCache(const std::vector<unsigned int>& indices, unsigned int vertexCount) {
+
+    const size_t triangleCount = indices.size() / 3;
+
+    /* triangles of every vertex: adjacency[offsets[v] .. offsets[v] + trianglesLeft[v]], drawn ones are removed */
+    std::vector<unsigned int> trianglesLeft(vertexCount, 0);
+    for (size_t i = 0; i < triangleCount * 3; i++)
+        trianglesLeft[indices[i]]++;
+
+    std::vector<unsigned int> offsets(vertexCount + 1, 0);
+    for (unsigned int v = 0; v < vertexCount; v++)
+        offsets[v + 1] = offsets[v] + trianglesLeft[v];
+
+    std::vector<unsigned int> adjacency(triangleCount * 3);
+    std::vector<unsigned int> fill(offsets.begin(), offsets.end() - 1);
+    for (size_t t = 0; t < triangleCount; t++)
+        for (int k = 0; k < 3; k++)
+            adjacency[fill[indices[t * 3 + k]]++] = (unsigned int)t;
+
+    std::vector<int> cachePosition(vertexCount, -1);
+    std::vector<float> vertexScore(vertexCount);
+    for (unsigned int v = 0; v < vertexCount; v++)
+        vertexScore[v] = Forsyth::VertexScore(-1, trianglesLeft[v]);
+
+    std::vector<float> triangleScore(triangleCount);
+    for (size_t t = 0; t < triangleCount; t++)
+        triangleScore[t] = vertexScore[indices[t * 3]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+
+    std::vector<char> drawn(triangleCount, 0);
+    std::vector<unsigned int> cache, newCache;
+    cache.reserve(Forsyth::CacheSize + 3);
+    newCache.reserve(Forsyth::CacheSize + 3);
+
+    std::vector<unsigned int> result;
+    result.reserve(triangleCount * 3);
+
+    /* first triangle: best of all, later only triangles of cached vertices are looked at */
+    long long best = triangleCount ? (long long)(std::max_element(triangleScore.begin(), triangleScore.end()) - triangleScore.begin()) : -1;
+    size_t cursor = 0;
+
+    for (size_t count = 0; count < triangleCount; count++) {
+
+        if (best < 0) {
+            /* no cached vertex has a triangle left, take the next one which is not drawn */
+            while (drawn[cursor])
+                cursor++;
+            best = (long long)cursor;
+        }
+
+        const unsigned int* triangle = &indices[best * 3];
+        drawn[best] = 1;
+        result.insert(result.end(), triangle, triangle + 3);
+
+        /* drawn vertices go to the front of the cache */
+        newCache.clear();
+        for (int k = 0; k < 3; k++) {
+            unsigned int v = triangle[k];
+
+            unsigned int* list = &adjacency[offsets[v]];
+            for (unsigned int i = 0; i < trianglesLeft[v]; i++) {
+                if (list[i] == (unsigned int)best) {
+                    list[i] = list[trianglesLeft[v] - 1];
+                    trianglesLeft[v]--;
+                    break;
+                }
+            }
+
+            if (std::find(newCache.begin(), newCache.end(), v) == newCache.end())
+                newCache.push_back(v);
+        }
+        const size_t front = newCache.size();
+        for (unsigned int v : cache)
+            if (std::find(newCache.begin(), newCache.begin() + front, v) == newCache.begin() + front)
+                newCache.push_back(v);
+
+        /* new scores for every vertex that moved (or fell out), triangles get the difference */
+        for (size_t i = 0; i < newCache.size(); i++) {
+            unsigned int v = newCache[i];
+            cachePosition[v] = i < (size_t)Forsyth::CacheSize ? (int)i : -1;
+
+            float score = Forsyth::VertexScore(cachePosition[v], trianglesLeft[v]);
+            float delta = score - vertexScore[v];
+            vertexScore[v] = score;
+
+            const unsigned int* list = &adjacency[offsets[v]];
+            for (unsigned int j = 0; j < trianglesLeft[v]; j++)
+                triangleScore[list[j]] += delta;
+        }
+
+        /* next: best triangle which uses a cached vertex */
+        best = -1;
+        float bestScore = -1.0f;
+        if (newCache.size() > (size_t)Forsyth::CacheSize)
+            newCache.resize(Forsyth::CacheSize);
+
+        for (unsigned int v : newCache) {
+            const unsigned int* list = &adjacency[offsets[v]];
+            for (unsigned int j = 0; j < trianglesLeft[v]; j++) {
+                if (triangleScore[list[j]] > bestScore) {
+                    bestScore = triangleScore[list[j]];
+                    best = list[j];
+                }
+            }
+        }
+
+        cache.swap(newCache);
+    }
+
+    return result;
+}
+
+/* numbers the vertices in the order the indices use them first and reorders 'vertices' the same way,
+   vertices which no triangle uses go to the end, returns old index -> new index */
+template<typename Vertex>
+static std::vector<unsigned int> OptimizeVertexFetch(std::vector<unsigned int>& indices, std::vector<Vertex>& vertices) {
+
+    const unsigned int unused = ~0u;
+    std::vector<unsigned int> remap(vertices.size(), unused);
+    unsigned int next = 0;
+
+    for (unsigned int& index : indices) {
+        if (remap[index] == unused)
+            remap[index] = next++;
+        index = remap[index];
+    }
+    for (unsigned int& newIndex : remap)
+        if (newIndex == unused)
+            newIndex = next++;
+
+    std::vector<Vertex> reordered(vertices.size());
+    for (size_t v = 0; v < vertices.size(); v++)
+        reordered[remap[v]] = vertices[v];
+    vertices.swap(reordered);
+
+    return remap;
+}
+
+
+
+/* ------------- TEST MESH ------------- */
+
+struct GridVertex {
+    float position[2];
+};
+
+/* side x side vertices, vertices and triangles shuffled */
+static void MakeShuffledGrid(unsigned int side, std::vector<GridVertex>& vertices, std::vector<unsigned int>& indices) {
+
+    std::mt19937 random(1234);
+
+    std::vector<unsigned int> order(side * side);
+    for (unsigned int i = 0; i < order.size(); i++)
+        order[i] = i;
+    std::shuffle(order.begin(), order.end(), random);   /* grid vertex i is stored at order[i] */
+
+    vertices.resize(side * side);
+    for (unsigned int j = 0; j < side; j++)
+        for (unsigned int i = 0; i < side; i++)
+            vertices[order[j * side + i]] = { { -0.9f + 1.8f * i / (side - 1), -0.9f + 1.8f * j / (side - 1) } };
+
+    std::vector<unsigned int> triangles;
+    for (unsigned int j = 0; j + 1 < side; j++) {
+        for (unsigned int i = 0; i + 1 < side; i++) {
+            unsigned int a = order[j * side + i], b = order[j * side + i + 1];
+            unsigned int c = order[(j + 1) * side + i], d = order[(j + 1) * side + i + 1];
+            triangles.insert(triangles.end(), { a, b, d, d, c, a });
+        }
+    }
+
+    std::vector<unsigned int> triangleOrder(triangles.size() / 3);
+    for (unsigned int t = 0; t < triangleOrder.size(); t++)
+        triangleOrder[t] = t;
+    std::shuffle(triangleOrder.begin(), triangleOrder.end(), random);
+
+    indices.clear();
+    for (unsigned int t : triangleOrder)
+        indices.insert(indices.end(), triangles.begin() + t * 3, triangles.begin() + t * 3 + 3);
+}
+
+static unsigned int MakeVertexArray(const std::vector<GridVertex>& vertices, unsigned int& vbo) {
+    unsigned int vao;
+    GLCall(glGenVertexArrays(1, &vao));
+    GLCall(glBindVertexArray(vao));
+
+    GLCall(glGenBuffers(1, &vbo));
+    GLCall(glBindBuffer(GL_ARRAY_BUFFER, vbo));
+    GLCall(glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(GridVertex), vertices.data(), GL_STATIC_DRAW));
+
+    GLCall(glEnableVertexAttribArray(0));
+    GLCall(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(GridVertex), 0));
+    return vao;         /* still bound, the index buffer made next goes into it */
+}
+
+static void PrintStats(const char* name, const VertexCacheStats& fifo16, const VertexCacheStats& fifo32) {
+    std::cout << "  " << name << " ACMR " << fifo16.acmr << " (FIFO 16), " << fifo32.acmr << " (FIFO 32), ATVR "
+              << fifo16.atvr << ", vertex overfetch " << fifo16.overfetch << std::endl;
+}
+
+
+
+int main(void)
+{
+    /* GLFW BASIC STUFF */
+        GLFWwindow* window;
+
+        /* Initialize the GLFW library */
+        if (!glfwInit())
+            return -1;
+
+
+        /* setting version 3.3 and core profile (i.e mordern opengl) */
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);    /* most drivers only send debug messages in debug context */
+#endif
+
+
+        /* Create a windowed mode window and its OpenGL context */
+        window = glfwCreateWindow(640, 480, "Hello World", NULL, NULL);
+        if (!window)
+        {
+            glfwTerminate();
+            return -1;
+
+        }
+        /* Make the window's context current */
+        glfwMakeContextCurrent(window);
+
+        glfwSwapInterval(1);    /* controls FPS or intervel between buffer(frames) */
+
+    /*  END BASIC GLFW   */
+
+
+    /* Intitialize GLEW */
+        if (glewInit() != GLEW_OK) {
+            std::cout << "Error!" << std::endl;
+        }
+    /* END */
+
+    std::cout << glGetString(GL_VERSION) << std::endl;  /* prints the version of opengl using */
+
+    SetupGLErrorPolicy();
+
+
+    { /* scope so that the index buffers are deleted before glfwTerminate destroys the context */
+
+    /* ------------- Generating Data to be used to display in the window ------------- */
+
+            // 4 positions of vertices of sqaure
+            std::vector<GridVertex> square = {
+                { { -0.2f, -0.2f } },    // 0
+                { {  0.2f, -0.2f } },    // 1
+                { {  0.2f,  0.2f } },    // 2
+                { { -0.2f,  0.2f } }     // 3
+            };
+
+            // Index data -----> position in which vertices is to be rendered to form a square
+            std::vector<unsigned int> squareIndices = {
+                0, 1, 2,
+                2, 3, 0
+            };
+
+            unsigned int squareVbo;
+            unsigned int squareVao = MakeVertexArray(square, squareVbo);
+            IndexBuffer squareIbo(squareIndices);
+            GLCall(glBindVertexArray(0));
+
+            std::cout << "[Square] " << squareIndices.size() << " indices as " << IndexTypeName(squareIbo.GetType()) << ": "
+                      << squareIbo.GetSize() << " bytes instead of " << squareIndices.size() * sizeof(unsigned int) << std::endl;
+
+
+    /* ------------- OPTIMIZE THE GRID ------------- */
+
+            const unsigned int side = 225;      /* 224 * 224 * 2 = 100352 triangles */
+            std::vector<GridVertex> vertices;
+            std::vector<unsigned int> indices;
+            MakeShuffledGrid(side, vertices, indices);
+            const unsigned int vertexCount = (unsigned int)vertices.size();
+
+            /* as loaded: shuffled, 32 bit indices (what every sample does) */
+            unsigned int originalVbo;
+            unsigned int originalVao = MakeVertexArray(vertices, originalVbo);
+            IndexBuffer originalIbo(indices, GL_UNSIGNED_INT);
+            GLCall(glBindVertexArray(0));
+
+            VertexCacheStats before16 = AnalyzeVertexCache(indices, vertexCount, sizeof(GridVertex), 16);
+            VertexCacheStats before32 = AnalyzeVertexCache(indices, vertexCount, sizeof(GridVertex), 32);
+
+            auto start = std::chrono::high_resolution_clock::now();
+            std::vector<unsigned int> optimizedIndices = OptimizeVertexCache(indices, vertexCount);
+            double cacheMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+            std::vector<GridVertex> optimizedVertices = vertices;
+            start = std::chrono::high_resolution_clock::now();
+            OptimizeVertexFetch(optimizedIndices, optimizedVertices);
+            double fetchMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+            VertexCacheStats after16 = AnalyzeVertexCache(optimizedIndices, vertexCount, sizeof(GridVertex), 16);
+            VertexCacheStats after32 = AnalyzeVertexCache(optimizedIndices, vertexCount, sizeof(GridVertex), 32);
+
+            unsigned int optimizedVbo;
+            unsigned int optimizedVao = MakeVertexArray(optimizedVertices, optimizedVbo);
+            IndexBuffer optimizedIbo(optimizedIndices);
+            GLCall(glBindVertexArray(0));
+
+            std::cout << "[Grid] " << vertexCount << " vertices, " << indices.size() / 3 << " triangles" << std::endl;
+            PrintStats("before", before16, before32);
+            PrintStats("after ", after16, after32);
+            std::cout << "  optimize: vertex cache " << cacheMs << " ms, vertex fetch " << fetchMs << " ms" << std::endl;
+            std::cout << "  indices " << IndexTypeName(originalIbo.GetType()) << " " << originalIbo.GetSize() / 1024 << " KB -> "
+                      << IndexTypeName(optimizedIbo.GetType()) << " " << optimizedIbo.GetSize() / 1024 << " KB (saved "
+                      << (originalIbo.GetSize() - optimizedIbo.GetSize()) / 1024 << " KB)" << std::endl;
+
+
+        ShaderProgramSource shaderSource = ParseShader("res/shaders/Basic - UNFORMS.shader");
+        unsigned int shader = CreateShader(shaderSource.VertexSource, shaderSource.FragmentSource);
+        GLCall(glUseProgram(shader));
+        GLCall(int location = glGetUniformLocation(shader, "u_Color"));
+        ASSERT(location != -1);
+        GLCall(glUniform4f(location, 0.2f, 0.3f, 0.8f, 1.0f));
+
+
+    /* ------------- BENCHMARK (same grid, before / after) ------------- */
+
+        glfwSwapInterval(0);
+
+        const int benchFrames = 50, drawsPerFrame = 20;
+
+        auto runFrames = [&](unsigned int vao, const IndexBuffer& ibo) {
+            GLCall(glBindVertexArray(vao));
+            ibo.Draw();         /* warm up */
+            glFinish();
+
+            auto begin = std::chrono::high_resolution_clock::now();
+            for (int frame = 0; frame < benchFrames; frame++) {
+                glClear(GL_COLOR_BUFFER_BIT);
+                for (int d = 0; d < drawsPerFrame; d++)
+                    ibo.Draw();
+                glFinish();
+            }
+            return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - begin).count() / benchFrames;
+        };
+
+        double originalMs = runFrames(originalVao, originalIbo);
+        double optimizedMs = runFrames(optimizedVao, optimizedIbo);
+
+        std::cout << "[Benchmark] " << drawsPerFrame << " draws of the grid per frame: before " << originalMs
+                  << " ms/frame, after " << optimizedMs << " ms/frame" << std::endl;
+
+        glfwSwapInterval(1);
+
+
+    /* ------------- END OF GENERATING DATA ------------- */
+
+
+    /* ----------- Animation Variable ----------- */
+    float r = 0.0f;
+    float increment = 0.05f;
+
+
+
+    /* WHILE Loop to keep the window active till window is closed */
+    while (!glfwWindowShouldClose(window))
+    {
+        /* Render here */
+
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        GLCall(glUseProgram(shader));
+
+        GLCall(glPolygonMode(GL_FRONT_AND_BACK, GL_LINE));      /* to see the triangles */
+        GLCall(glUniform4f(location, 0.2f, 0.3f, 0.8f, 1.0f));
+        GLCall(glBindVertexArray(optimizedVao));
+        optimizedIbo.Draw();
+
+        GLCall(glPolygonMode(GL_FRONT_AND_BACK, GL_FILL));
+        GLCall(glUniform4f(location, r, 0.8f, 0.3f, 1.0f));
+        GLCall(glBindVertexArray(squareVao));
+        squareIbo.Draw();       /* GL_UNSIGNED_BYTE */
+
+        if (r > 1.0f)
+            increment = -0.05f;
+        else if (r < 0.0f)
+            increment = 0.05f;
+
+        r += increment;
+
+
+        /* Swap front and back buffers */
+        glfwSwapBuffers(window);
+
+        /* Poll for and process events */
+        glfwPollEvents();
+    }
+
+    glDeleteProgram(shader);
+    glDeleteBuffers(1, &squareVbo);
+    glDeleteBuffers(1, &originalVbo);
+    glDeleteBuffers(1, &optimizedVbo);
+    glDeleteVertexArrays(1, &squareVao);
+    glDeleteVertexArrays(1, &originalVao);
+    glDeleteVertexArrays(1, &optimizedVao);
+
+    }
+
+    glfwTerminate();
+    return 0;
+}
+
+
+
+
+/* Makes and compile the shader by inputing the type and Source code */
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source) {
+
+    unsigned int id = glCreateShader(shaderType);   /* generate Shader and return id */
+    const char* src = source.c_str();               /* convert inputed string to char* */
+    GLCall(glShaderSource(id, 1, &src, nullptr));           /* attaching source code to the shader */
+    GLCall(glCompileShader(id));                            /* compile shader */
+
+    /* -------- ERROR HANDLING -------- */
+        int result;
+        GLCall(glGetShaderiv(id, GL_COMPILE_STATUS, &result));
+        if (result == GL_FALSE) {
+            int length;
+            GLCall(glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length));
+            std::vector<char> message(length + 1);      /* char Array of length 'length' (_malloca is only in MSVC) */
+            GLCall(glGetShaderInfoLog(id, length, &length, message.data()));
+
+            std::cout << "Failed To Compile " << (shaderType == GL_VERTEX_SHADER ? "vertex" : "fragment") << " shader" << std::endl;
+
+            std::cout << message.data() << std::endl;
+            GLCall(glDeleteShader(id));
+            return 0;
+        }
+
+    /* -------- END ERROR HANDLING -------- */
+
+    return id;
+
+}
+
+
+/* Creates a program Which contain vertex and fragment shader */
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader) {
+
+    GLCall(unsigned int program = glCreateProgram());                           /* generate program to store all shader and program to be run by GPU during while loop */
+    unsigned int vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
+    unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+
+    GLCall(glAttachShader(program, vs));                                        /* Attach shader to program to be run by GPU */
+    GLCall(glAttachShader(program, fs));
+    GLCall(glLinkProgram(program));
+    GLCall(glValidateProgram(program));
+    GLCall(glDeleteShader(vs));                                                 /* DELETING shader to save space as shader is already attached to program */
+    GLCall(glDeleteShader(fs));
+
+    return program;
+
+}
+
+
+/* Read file and output vertex and fragment shader source code */
+static ShaderProgramSource ParseShader(const std::string& filepath) {
+
+    std::ifstream stream(filepath);
+
+    enum class ShaderType {
+        NONE = -1, VERTEX = 0, FRAGMENT = 1
+    };
+
+    std::string line;
+    std::stringstream ss[2];
+    ShaderType type = ShaderType::NONE;
+    while (getline(stream, line)) {
+
+        if (line.find("#shader") != std::string::npos) {
+
+            if (line.find("vertex") != std::string::npos)
+                type = ShaderType::VERTEX;
+            else if (line.find("fragment") != std::string::npos)
+                type = ShaderType::FRAGMENT;
+
+        }
+        else {
+            ss[int(type)] << line << '\n';
+        }
+    }
+
+    return { ss[0].str(), ss[1].str() };
+}
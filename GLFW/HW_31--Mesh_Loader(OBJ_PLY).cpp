@@ -0,0 +1,1646 @@
+/*
+
+Mesh Loader (OBJ + PLY, memory mapped, parsed on all cores)
+
+geometry was only  float positions[]  written in main(), real meshes come from files
+a loader with getline + stringstream + std::map (like LoadObjNaive below) needs tens of seconds for a 5M triangle scan
+
+LoadMesh(path, pool, mesh, error) reads .obj and .ply (ascii, binary little / big endian)
+
+---> the file is memory mapped (MappedFile from HW_23), nothing is copied into a std::string
+---> the text is cut into one chunk per thread at line ends, every thread parses its chunk on its own
+     numbers with std::from_chars (no locale, no streams, no allocation)
+---> OBJ: a corner is  position/uv/normal  indices, the same triple must become the same vertex
+     corners are bucketed by hash into one part per thread (one pass), every thread deduplicates only its bucket with an
+     open addressing hash table (flat arrays, linear probing), so no locks are needed
+     negative (relative) indices are fixed after all chunks are counted, polygons are split into triangles (fan)
+---> PLY: vertices are already unique, binary vertex data has a fixed size per vertex, so every thread
+     converts its own range, binary faces with 3 indices each are also read in parallel (other faces: one thread)
+---> Mesh has  vertices + indices  (unsigned int), uploaded with the glBufferData VBO / IBO + VAO setup from HW_10
+
+    HW_31 <mesh.obj | mesh.ply>
+
+without a file a 500 x 500 grid is written as .obj and .ply to the temp folder and loaded,
+the .obj is also loaded with the naive loader to compare, times are printed
+
+*/
+
+
+
+
+#include <GL\glew.h>
+
+#include <GLFW/glfw3.h>
+
+
+#include <iostream>
+#include <fstream>  // to read file
+#include <string>   // To use getline func
+#include <string_view>
+#include <sstream>
+#include <vector>
+#include <map>
+#include <tuple>
+#include <algorithm>
+#include <chrono>
+#include <charconv> // from_chars
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <filesystem>
+#include <cstddef>  // offsetof
+#include <cstdint>
+#include <cstring>  // memchr
+#include <math.h>
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+
+/* ------------ ERROR CHECK POLICY ------------ */
+/*
+GL_CHECK_NONE   -> GLCall(x) is just x, nothing is checked (release)
+GL_CHECK_ASYNC  -> GLCall(x) is just x, driver reports errors later through glDebugMessageCallback (needs KHR_debug / GL 4.3)
+GL_CHECK_STRICT -> glGetError before and after every call, stops on the line with the error (old GLCall)
+
+default is NONE for release (NDEBUG) and STRICT for debug, or pass -DGL_CHECK_POLICY=1 to compiler to choose
+*/
+#define GL_CHECK_NONE   0
+#define GL_CHECK_ASYNC  1
+#define GL_CHECK_STRICT 2
+
+#ifndef GL_CHECK_POLICY
+    #ifdef NDEBUG
+        #define GL_CHECK_POLICY GL_CHECK_NONE
+    #else
+        #define GL_CHECK_POLICY GL_CHECK_STRICT
+    #endif
+#endif
+
+
+/* ------------ MACRO ------------ */
+
+/* __debugbreak is only in MSVC, on gcc / clang SIGTRAP does same thing (debugger stops there) */
+#if defined(_MSC_VER)
+    #define DEBUG_BREAK() __debugbreak()
+#elif defined(__GNUC__) || defined(__clang__)
+    #include <signal.h>
+    #define DEBUG_BREAK() raise(SIGTRAP)
+#else
+    #include <cstdlib>
+    #define DEBUG_BREAK() std::abort()
+#endif
+
+#define ASSERT(x) if (!(x)) DEBUG_BREAK();
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+    #define GLCall(x) GLCLearError();\
+        x;\
+        ASSERT(GlLogCall(#x, __FILE__, __LINE__))
+#else
+    #define GLCall(x) x
+#endif
+
+/*
+# before a fucntion pass it as a stringand __FILE__and __LINE__ are macros to get file loc and line of fucntion
+and since MACROS HAS TO BE IN SAME LINE we use \ before line ends to write macros in multiple lines
+*/
+
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+static void GLCLearError() {
+    while (glGetError() != GL_NO_ERROR);    // glGetError get error and we get all the error until there are no arror left
+}
+
+static bool GlLogCall(const char* function, const char* file, int line) {
+    bool ok = true;
+    while (GLenum error = glGetError()) {
+        std::cout << "[OpenGl Error] (" << error << "): " << function << " " << file << ":" << line << std::endl;
+        ok = false;
+    }
+    return ok;
+}
+#endif
+
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+/* called by the driver (maybe from its own thread) when something is wrong */
+static void APIENTRY GlDebugCallback(GLenum /*source*/, GLenum type, GLuint id, GLenum severity, GLsizei /*length*/, const GLchar* message, const void* /*userParam*/) {
+
+    const char* level = severity == GL_DEBUG_SEVERITY_HIGH ? "HIGH" : severity == GL_DEBUG_SEVERITY_MEDIUM ? "MEDIUM" : "LOW";
+    std::cout << "[OpenGl Debug] (" << level << (type == GL_DEBUG_TYPE_ERROR ? ", error" : "") << ", id " << id << "): " << message << std::endl;
+}
+#endif
+
+/* call once after glewInit, sets up whatever the chosen policy needs */
+static void SetupGLErrorPolicy() {
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+    if (GLEW_VERSION_4_3 || GLEW_KHR_debug) {
+        glEnable(GL_DEBUG_OUTPUT);
+        glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);     /* driver does not have to report inside the call, so no slow down */
+        glDebugMessageCallback(GlDebugCallback, nullptr);
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);  /* skip info messages */
+        std::cout << "GL errors: async (debug callback)" << std::endl;
+    }
+    else {
+        std::cout << "GL errors: async asked but KHR_debug is not there, errors are not checked" << std::endl;
+    }
+#elif GL_CHECK_POLICY == GL_CHECK_STRICT
+    std::cout << "GL errors: strict (glGetError after every call)" << std::endl;
+#else
+    std::cout << "GL errors: off" << std::endl;
+#endif
+}
+
+
+
+/* ------------- MAPPED FILE ------------- */
+
+/* read only view of a whole file, unmapped in destructor */
+class MappedFile {
+public:
+    MappedFile() = default;
+
+    explicit MappedFile(const std::string& filepath) {
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return;
+
+        LARGE_INTEGER size;
+        if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping) {
+                m_Data = (const char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                CloseHandle(mapping);       /* view keeps the mapping alive */
+            }
+            m_Size = m_Data ? (size_t)size.QuadPart : 0;
+        }
+        m_Open = true;
+        CloseHandle(file);
+#else
+        int fd = open(filepath.c_str(), O_RDONLY);
+        if (fd == -1)
+            return;
+
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            void* data = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED) {
+                m_Data = (const char*)data;
+                m_Size = (size_t)st.st_size;
+            }
+        }
+        m_Open = true;      /* empty file is open but has no mapping (mmap of 0 bytes fails) */
+        close(fd);          /* mapping stays valid after close */
+#endif
+    }
+
+    ~MappedFile() { Unmap(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept { *this = std::move(other); }
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            Unmap();
+            m_Data = other.m_Data; m_Size = other.m_Size; m_Open = other.m_Open;
+            other.m_Data = nullptr; other.m_Size = 0; other.m_Open = false;
+        }
+        return *this;
+    }
+
+    bool IsOpen() const { return m_Open; }
+    std::string_view View() const { return { m_Data, m_Size }; }
+
+private:
+    void Unmap() {
+        if (!m_Data)
+            return;
+#if defined(_WIN32)
+        UnmapViewOfFile(m_Data);
+#else
+        munmap((void*)m_Data, m_Size);
+#endif
+        m_Data = nullptr;
+        m_Size = 0;
+    }
+
+    const char* m_Data = nullptr;
+    size_t m_Size = 0;
+    bool m_Open = false;
+};
+
+
+
+/* ------------- WORKER POOL ------------- */
+
+/* threads stay alive and wait, Run(job) calls job(0..count-1) on all of them and returns when all are done */
+class WorkerPool {
+public:
+    WorkerPool(unsigned int count) {
+        for (unsigned int i = 0; i < count; i++)
+            m_Threads.emplace_back([this, i]() { WorkerLoop(i); });
+    }
+
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Quit = true;
+        }
+        m_Start.notify_all();
+        for (std::thread& t : m_Threads)
+            t.join();
+    }
+
+    void Run(const std::function<void(unsigned int)>& job) {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Job = job;
+        m_Pending = (unsigned int)m_Threads.size();
+        m_Generation++;
+        m_Start.notify_all();
+        m_Done.wait(lock, [this]() { return m_Pending == 0; });
+    }
+
+    unsigned int GetCount() const { return (unsigned int)m_Threads.size(); }
+
+private:
+    void WorkerLoop(unsigned int index) {
+        unsigned long long seen = 0;
+        while (true) {
+            std::function<void(unsigned int)> job;
+            {
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                m_Start.wait(lock, [&]() { return m_Quit || m_Generation != seen; });
+                if (m_Quit)
+                    return;
+                seen = m_Generation;
+                job = m_Job;
+            }
+
+            job(index);
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (--m_Pending == 0)
+                m_Done.notify_one();
+        }
+    }
+
+    std::vector<std::thread> m_Threads;
+    std::mutex m_Mutex;
+    std::condition_variable m_Start, m_Done;
+    std::function<void(unsigned int)> m_Job;
+    unsigned long long m_Generation = 0;
+    unsigned int m_Pending = 0;
+    bool m_Quit = false;
+};
+
+
+
+struct ShaderProgramSource {
+    std::string VertexSource;
+    std::string FragmentSource;
+};
+
+static ShaderProgramSource ParseShader(const std::string& filepath);
+
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader);
+
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source);
+
+
+
+/* ------------- MESH ------------- */
+
+struct MeshVertex {
+    float position[3];
+    float normal[3];
+    float uv[2];
+};
+static_assert(sizeof(MeshVertex) == 8 * sizeof(float), "MeshVertex is read as 8 floats");
+
+struct Mesh {
+    std::vector<MeshVertex> vertices;
+    std::vector<unsigned int> indices;      /* 3 per triangle */
+    bool hasNormals = false;
+    bool hasUVs = false;
+};
+
+
+
+/* ------------- TEXT PARSING ------------- */
+
+static inline bool IsSpace(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+static inline const char* SkipSpaces(const char* p, const char* end) {
+    while (p < end && IsSpace(*p))
+        p++;
+    return p;
+}
+
+/* the '\n' of the line starting at p, or end */
+static inline const char* LineEnd(const char* p, const char* end) {
+    const char* newline = (const char*)memchr(p, '\n', end - p);
+    return newline ? newline : end;
+}
+
+static inline const char* NextLine(const char* p, const char* end) {
+    const char* lineEnd = LineEnd(p, end);
+    return lineEnd < end ? lineEnd + 1 : end;
+}
+
+/* after 'count' lines, nullptr when the text has less lines */
+static const char* SkipLines(const char* p, const char* end, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (p >= end)
+            return nullptr;
+        p = NextLine(p, end);
+    }
+    return p;
+}
+
+/* from_chars does not take a leading '+' */
+template<typename T>
+static inline bool ParseNumber(const char*& p, const char* end, T& value) {
+    p = SkipSpaces(p, end);
+    if (p < end && *p == '+')
+        p++;
+    auto [next, ec] = std::from_chars(p, end, value);
+    if (ec != std::errc())
+        return false;
+    p = next;
+    return true;
+}
+
+/* 'count' ranges which start at a line start and together are [begin, end) */
+static std::vector<std::pair<const char*, const char*>> SplitLines(const char* begin, const char* end, unsigned int count) {
+    std::vector<std::pair<const char*, const char*>> chunks;
+    const char* start = begin;
+    for (unsigned int i = 1; i <= count; i++) {
+        const char* stop = i == count ? end : begin + (end - begin) * i / count;
+        if (stop <= start)
+            stop = start;
+        else if (stop < end)
+            stop = NextLine(stop - 1, end);      /* stop - 1: a chunk which already ends at a line end stays */
+        chunks.push_back({ start, stop });
+        start = stop;
+    }
+    return chunks;
+}
+
+static size_t LineNumber(std::string_view text, const char* at) {
+    return (size_t)std::count(text.data(), at, '\n') + 1;
+}
+
+
+
+/* ------------- OBJ ------------- */
+
+struct ObjCorner {
+    int index[3];               /* position, uv, normal, 0 based, -1 = not given */
+    unsigned char relative;     /* bit k: index[k] was negative, it counts from the chunk start until the chunk base is added */
+};
+
+struct ObjChunk {
+    std::vector<float> attributes[3];       /* positions (3 floats), uvs (2), normals (3) */
+    std::vector<ObjCorner> corners;         /* 3 per triangle */
+    size_t base[3] = {};                    /* attributes in the chunks before this one */
+    size_t cornerBase = 0;
+    const char* errorAt = nullptr;
+    std::string error;
+};
+
+static const unsigned int s_ObjComponents[3] = { 3, 2, 3 };
+
+static void ParseObjChunk(const char* p, const char* end, ObjChunk& chunk) {
+
+    std::vector<ObjCorner> polygon;
+
+    auto fail = [&](const char* at, const char* message) {
+        chunk.errorAt = at;
+        chunk.error = message;
+    };
+
+    while (p < end) {
+        const char* lineEnd = LineEnd(p, end);
+        const char* s = SkipSpaces(p, lineEnd);
+
+        if (lineEnd - s >= 2 && s[0] == 'v') {
+            int attribute = IsSpace(s[1]) ? 0 : (lineEnd - s >= 3 && IsSpace(s[2]) ? (s[1] == 't' ? 1 : (s[1] == 'n' ? 2 : -1)) : -1);
+            if (attribute >= 0) {
+                const char* q = s + (attribute == 0 ? 1 : 2);
+                std::vector<float>& values = chunk.attributes[attribute];
+                for (unsigned int k = 0; k < s_ObjComponents[attribute]; k++) {
+                    float value = 0.0f;
+                    if (!ParseNumber(q, lineEnd, value) && !(attribute == 1 && k > 0)) {     /* "vt u" is allowed, v = 0 */
+                        fail(s, "bad number");
+                        return;
+                    }
+                    values.push_back(value);
+                }
+            }
+        }
+        else if (lineEnd - s >= 2 && s[0] == 'f' && IsSpace(s[1])) {
+            polygon.clear();
+            const char* q = s + 1;
+            while (true) {
+                q = SkipSpaces(q, lineEnd);
+                if (q >= lineEnd || *q == '#')
+                    break;
+
+                /* v, v/vt, v//vn, v/vt/vn */
+                ObjCorner corner = { { -1, -1, -1 }, 0 };
+                for (int k = 0; k < 3; k++) {
+                    if (k > 0) {
+                        if (q >= lineEnd || *q != '/')
+                            break;
+                        q++;
+                        if (q < lineEnd && *q == '/')
+                            continue;           /* no uv */
+                    }
+                    long long value = 0;
+                    if (!ParseNumber(q, lineEnd, value) || value == 0) {
+                        fail(s, "bad face index");
+                        return;
+                    }
+                    if (value > 0)
+                        corner.index[k] = (int)(value - 1);
+                    else {
+                        corner.index[k] = (int)((long long)(chunk.attributes[k].size() / s_ObjComponents[k]) + value);
+                        corner.relative |= (unsigned char)(1 << k);
+                    }
+                }
+                if (q < lineEnd && !IsSpace(*q)) {
+                    fail(s, "bad face corner");
+                    return;
+                }
+                polygon.push_back(corner);
+            }
+
+            if (polygon.size() < 3) {
+                fail(s, "face with less than 3 corners");
+                return;
+            }
+            for (size_t i = 2; i < polygon.size(); i++) {
+                chunk.corners.push_back(polygon[0]);
+                chunk.corners.push_back(polygon[i - 1]);
+                chunk.corners.push_back(polygon[i]);
+            }
+        }
+        /* o, g, s, usemtl, mtllib, comments ... are not needed */
+
+        p = lineEnd < end ? lineEnd + 1 : end;
+    }
+}
+
+static inline uint32_t HashCorner(const ObjCorner& corner) {
+    uint64_t h = (uint32_t)corner.index[0];
+    h = h * 0x9E3779B97F4A7C15ull ^ (uint32_t)corner.index[1];
+    h = h * 0x9E3779B97F4A7C15ull ^ (uint32_t)corner.index[2];
+    h *= 0x9E3779B97F4A7C15ull;
+    return (uint32_t)(h >> 32);
+}
+
+static inline bool SameCorner(const ObjCorner& a, const ObjCorner& b) {
+    return a.index[0] == b.index[0] && a.index[1] == b.index[1] && a.index[2] == b.index[2];
+}
+
+/* part of the corners one thread deduplicates, from the high bits of the hash (table slots use the low bits) */
+static inline unsigned int CornerPart(uint32_t hash, unsigned int parts) {
+    return (unsigned int)(((uint64_t)hash * parts) >> 32);
+}
+
+static size_t NextPowerOfTwo(size_t value) {
+    size_t power = 1;
+    while (power < value)
+        power <<= 1;
+    return power;
+}
+
+static bool LoadObj(std::string_view text, WorkerPool& pool, Mesh& mesh, std::string& error) {
+
+    const unsigned int threads = pool.GetCount();
+
+    /* 1. every thread parses its chunk */
+    std::vector<std::pair<const char*, const char*>> ranges = SplitLines(text.data(), text.data() + text.size(), threads);
+    std::vector<ObjChunk> chunks(threads);
+    pool.Run([&](unsigned int t) {
+        ParseObjChunk(ranges[t].first, ranges[t].second, chunks[t]);
+    });
+
+    for (const ObjChunk& chunk : chunks) {
+        if (!chunk.error.empty()) {
+            error = "line " + std::to_string(LineNumber(text, chunk.errorAt)) + ": " + chunk.error;
+            return false;
+        }
+    }
+
+    /* 2. chunk bases, then all attributes into one array each */
+    size_t totals[3] = {}, cornerCount = 0;
+    std::vector<size_t> chunkCorners(threads + 1, 0);      /* corners of chunk t are [chunkCorners[t], chunkCorners[t + 1]) */
+    for (ObjChunk& chunk : chunks) {
+        for (int k = 0; k < 3; k++) {
+            chunk.base[k] = totals[k];
+            totals[k] += chunk.attributes[k].size() / s_ObjComponents[k];
+        }
+        chunk.cornerBase = cornerCount;
+        cornerCount += chunk.corners.size();
+        chunkCorners[&chunk - chunks.data() + 1] = cornerCount;
+    }
+    if (totals[0] > 0x7FFFFFFF || cornerCount > 0xFFFFFFFF) {
+        error = "mesh is too big";
+        return false;
+    }
+
+    std::vector<float> attributes[3];
+    for (int k = 0; k < 3; k++)
+        attributes[k].resize(totals[k] * s_ObjComponents[k]);
+
+    /* 3. absolute indices, range check, hash of every corner */
+    std::vector<ObjCorner> corners(cornerCount);
+    std::vector<uint32_t> hashes(cornerCount);
+    std::vector<std::vector<size_t>> partCounts(threads, std::vector<size_t>(threads, 0));
+    std::vector<char> badIndex(threads, 0);
+
+    pool.Run([&](unsigned int t) {
+        ObjChunk& chunk = chunks[t];
+        for (int k = 0; k < 3; k++)
+            std::copy(chunk.attributes[k].begin(), chunk.attributes[k].end(), attributes[k].begin() + chunk.base[k] * s_ObjComponents[k]);
+
+        for (size_t i = 0; i < chunk.corners.size(); i++) {
+            ObjCorner corner = chunk.corners[i];
+            for (int k = 0; k < 3; k++) {
+                if (corner.relative & (1 << k))
+                    corner.index[k] += (int)chunk.base[k];
+                if (corner.index[k] < -1 || (corner.index[k] >= 0 && (size_t)corner.index[k] >= totals[k]) || (k == 0 && corner.index[0] < 0))
+                    badIndex[t] = 1;
+            }
+            corner.relative = 0;
+
+            size_t at = chunk.cornerBase + i;
+            corners[at] = corner;
+            hashes[at] = HashCorner(corner);
+            partCounts[t][CornerPart(hashes[at], threads)]++;
+        }
+        chunk = ObjChunk();     /* free the chunk memory early */
+    });
+
+    if (std::find(badIndex.begin(), badIndex.end(), 1) != badIndex.end()) {
+        error = "face index out of range";
+        return false;
+    }
+
+    /* 4. corner numbers bucketed by part (part after part, inside a part chunk after chunk, so still in file order),
+          every thread writes the corners of its chunk to its own place in every bucket */
+    std::vector<size_t> partStart(threads + 1, 0);
+    std::vector<std::vector<size_t>> cursor(threads, std::vector<size_t>(threads, 0));     /* [chunk][part] */
+    for (unsigned int part = 0; part < threads; part++) {
+        size_t at = partStart[part];
+        for (unsigned int t = 0; t < threads; t++) {
+            cursor[t][part] = at;
+            at += partCounts[t][part];
+        }
+        partStart[part + 1] = at;
+    }
+
+    std::vector<uint32_t> partCorners(cornerCount);
+    pool.Run([&](unsigned int t) {
+        std::vector<size_t>& next = cursor[t];
+        for (size_t i = chunkCorners[t]; i < chunkCorners[t + 1]; i++)
+            partCorners[next[CornerPart(hashes[i], threads)]++] = (uint32_t)i;
+    });
+
+    /* 5. every thread deduplicates the corners of its part (open addressing, linear probing) */
+    std::vector<std::vector<ObjCorner>> unique(threads);
+    std::vector<uint32_t> localIds(cornerCount);
+
+    pool.Run([&](unsigned int part) {
+        const size_t expected = partStart[part + 1] - partStart[part];
+
+        std::vector<uint32_t> table(NextPowerOfTwo(expected * 2 + 16), 0);       /* vertex id + 1, 0 = empty */
+        const size_t mask = table.size() - 1;
+        std::vector<ObjCorner>& keys = unique[part];
+        keys.reserve(expected / 2);
+
+        for (size_t j = partStart[part]; j < partStart[part + 1]; j++) {
+            const size_t i = partCorners[j];
+            uint32_t hash = hashes[i];
+
+            size_t slot = hash & mask;
+            while (table[slot] != 0 && !SameCorner(keys[table[slot] - 1], corners[i]))
+                slot = (slot + 1) & mask;
+
+            if (table[slot] == 0) {
+                keys.push_back(corners[i]);
+                table[slot] = (uint32_t)keys.size();
+            }
+            localIds[i] = table[slot] - 1;
+        }
+    });
+
+    /* 6. vertex buffer and index buffer */
+    std::vector<size_t> partBase(threads + 1, 0);
+    for (unsigned int part = 0; part < threads; part++)
+        partBase[part + 1] = partBase[part] + unique[part].size();
+
+    mesh.vertices.resize(partBase[threads]);
+    mesh.indices.resize(cornerCount);
+    mesh.hasUVs = totals[1] > 0;
+    mesh.hasNormals = totals[2] > 0;
+
+    pool.Run([&](unsigned int t) {
+        for (size_t i = cornerCount * t / threads; i < cornerCount * (t + 1) / threads; i++)
+            mesh.indices[i] = (unsigned int)(partBase[CornerPart(hashes[i], threads)] + localIds[i]);
+
+        const std::vector<ObjCorner>& keys = unique[t];
+        for (size_t j = 0; j < keys.size(); j++) {
+            MeshVertex& vertex = mesh.vertices[partBase[t] + j];
+            const int* index = keys[j].index;
+            const float* position = &attributes[0][index[0] * 3];
+            vertex = { { position[0], position[1], position[2] }, { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f } };
+            if (index[1] >= 0)
+                memcpy(vertex.uv, &attributes[1][index[1] * 2], sizeof(vertex.uv));
+            if (index[2] >= 0)
+                memcpy(vertex.normal, &attributes[2][index[2] * 3], sizeof(vertex.normal));
+        }
+    });
+
+    return true;
+}
+
+/* vertices come out grouped by hash part, number them in the order the triangles use them (see HW_30) */
+static void RenumberByFirstUse(Mesh& mesh) {
+    const unsigned int unused = ~0u;
+    std::vector<unsigned int> remap(mesh.vertices.size(), unused);
+    std::vector<MeshVertex> reordered(mesh.vertices.size());
+    unsigned int next = 0;
+
+    for (unsigned int& index : mesh.indices) {
+        if (remap[index] == unused) {
+            remap[index] = next;
+            reordered[next++] = mesh.vertices[index];
+        }
+        index = remap[index];
+    }
+    for (size_t v = 0; v < remap.size(); v++)
+        if (remap[v] == unused)
+            reordered[next++] = mesh.vertices[v];
+
+    mesh.vertices.swap(reordered);
+}
+
+
+
+/* ------------- PLY ------------- */
+
+enum class PlyType { None, Int8, UInt8, Int16, UInt16, Int32, UInt32, Float32, Float64 };
+
+static PlyType PlyTypeFromName(const std::string& name) {
+    if (name == "char" || name == "int8")       return PlyType::Int8;
+    if (name == "uchar" || name == "uint8")     return PlyType::UInt8;
+    if (name == "short" || name == "int16")     return PlyType::Int16;
+    if (name == "ushort" || name == "uint16")   return PlyType::UInt16;
+    if (name == "int" || name == "int32")       return PlyType::Int32;
+    if (name == "uint" || name == "uint32")     return PlyType::UInt32;
+    if (name == "float" || name == "float32")   return PlyType::Float32;
+    if (name == "double" || name == "float64")  return PlyType::Float64;
+    return PlyType::None;
+}
+
+static size_t PlyTypeSize(PlyType type) {
+    switch (type) {
+        case PlyType::Int8:    case PlyType::UInt8:                          return 1;
+        case PlyType::Int16:   case PlyType::UInt16:                         return 2;
+        case PlyType::Int32:   case PlyType::UInt32:  case PlyType::Float32: return 4;
+        case PlyType::Float64:                                               return 8;
+        default:                                                             return 0;
+    }
+}
+
+/* one binary value of any type */
+static double ReadPlyValue(const char* p, PlyType type, bool bigEndian) {
+    unsigned char bytes[8];
+    size_t size = PlyTypeSize(type);
+    memcpy(bytes, p, size);
+    if (bigEndian)
+        std::reverse(bytes, bytes + size);
+
+    switch (type) {
+        case PlyType::Int8:    { int8_t v;   memcpy(&v, bytes, 1); return v; }
+        case PlyType::UInt8:   { uint8_t v;  memcpy(&v, bytes, 1); return v; }
+        case PlyType::Int16:   { int16_t v;  memcpy(&v, bytes, 2); return v; }
+        case PlyType::UInt16:  { uint16_t v; memcpy(&v, bytes, 2); return v; }
+        case PlyType::Int32:   { int32_t v;  memcpy(&v, bytes, 4); return v; }
+        case PlyType::UInt32:  { uint32_t v; memcpy(&v, bytes, 4); return v; }
+        case PlyType::Float32: { float v;    memcpy(&v, bytes, 4); return v; }
+        case PlyType::Float64: { double v;   memcpy(&v, bytes, 8); return v; }
+        default:               return 0.0;
+    }
+}
+
+struct PlyProperty {
+    std::string name;
+    PlyType type = PlyType::None;
+    PlyType countType = PlyType::None;      /* != None: a list, count of type 'countType' and then that many 'type' values */
+};
+
+struct PlyElement {
+    std::string name;
+    size_t count = 0;
+    std::vector<PlyProperty> properties;
+
+    /* bytes of one item in binary files, 0 if it has a list (size changes) */
+    size_t FixedSize() const {
+        size_t size = 0;
+        for (const PlyProperty& property : properties) {
+            if (property.countType != PlyType::None)
+                return 0;
+            size += PlyTypeSize(property.type);
+        }
+        return size;
+    }
+};
+
+enum class PlyFormat { Ascii, BinaryLittleEndian, BinaryBigEndian };
+
+static bool ParsePlyHeader(std::string_view file, PlyFormat& format, std::vector<PlyElement>& elements, size_t& dataOffset, std::string& error) {
+
+    size_t position = 0;
+    unsigned int lineNumber = 0;
+    bool hasFormat = false;
+
+    while (position < file.size()) {
+        size_t lineEnd = file.find('\n', position);
+        if (lineEnd == std::string_view::npos) {
+            error = "header has no end_header";
+            return false;
+        }
+        std::string line(file.substr(position, lineEnd - position));
+        position = lineEnd + 1;
+        lineNumber++;
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+
+        std::istringstream words(line);
+        std::string keyword;
+        words >> keyword;
+
+        if (lineNumber == 1) {
+            if (keyword != "ply") {
+                error = "not a ply file";
+                return false;
+            }
+        }
+        else if (keyword == "format") {
+            std::string name;
+            words >> name;
+            if (name == "ascii")                     format = PlyFormat::Ascii;
+            else if (name == "binary_little_endian") format = PlyFormat::BinaryLittleEndian;
+            else if (name == "binary_big_endian")    format = PlyFormat::BinaryBigEndian;
+            else {
+                error = "line " + std::to_string(lineNumber) + ": unknown format " + name;
+                return false;
+            }
+            hasFormat = true;
+        }
+        else if (keyword == "element") {
+            PlyElement element;
+            if (!(words >> element.name >> element.count)) {
+                error = "line " + std::to_string(lineNumber) + ": bad element";
+                return false;
+            }
+            elements.push_back(element);
+        }
+        else if (keyword == "property") {
+            std::string type, countType, itemType;
+            PlyProperty property;
+            words >> type;
+            if (type == "list") {
+                words >> countType >> itemType >> property.name;
+                property.countType = PlyTypeFromName(countType);
+                property.type = PlyTypeFromName(itemType);
+                if (property.countType == PlyType::None || property.countType == PlyType::Float32 || property.countType == PlyType::Float64)
+                    property.type = PlyType::None;
+            }
+            else {
+                words >> property.name;
+                property.type = PlyTypeFromName(type);
+            }
+            if (elements.empty() || property.type == PlyType::None || property.name.empty()) {
+                error = "line " + std::to_string(lineNumber) + ": bad property";
+                return false;
+            }
+            elements.back().properties.push_back(property);
+        }
+        else if (keyword == "end_header") {
+            if (!hasFormat) {
+                error = "header has no format";
+                return false;
+            }
+            dataOffset = position;
+            return true;
+        }
+        /* comment, obj_info */
+    }
+
+    error = "header has no end_header";
+    return false;
+}
+
+/* where a vertex property goes in MeshVertex (as 8 floats), -1 = not used */
+static int PlyVertexTarget(const std::string& name) {
+    static const char* names[][3] = {
+        { "x", nullptr, nullptr }, { "y", nullptr, nullptr }, { "z", nullptr, nullptr },
+        { "nx", nullptr, nullptr }, { "ny", nullptr, nullptr }, { "nz", nullptr, nullptr },
+        { "u", "s", "texture_u" }, { "v", "t", "texture_v" }
+    };
+    for (int target = 0; target < 8; target++)
+        for (const char* alias : names[target])
+            if (alias && name == alias)
+                return target;
+    return -1;
+}
+
+static bool IsPlyIndexList(const PlyProperty& property) {
+    return property.countType != PlyType::None && (property.name == "vertex_indices" || property.name == "vertex_index");
+}
+
+static bool LoadPly(std::string_view file, WorkerPool& pool, Mesh& mesh, std::string& error) {
+
+    PlyFormat format = PlyFormat::Ascii;
+    std::vector<PlyElement> elements;
+    size_t dataOffset = 0;
+    if (!ParsePlyHeader(file, format, elements, dataOffset, error))
+        return false;
+
+    const unsigned int threads = pool.GetCount();
+    const bool binary = format != PlyFormat::Ascii;
+    const bool bigEndian = format == PlyFormat::BinaryBigEndian;
+    const char* p = file.data() + dataOffset;
+    const char* end = file.data() + file.size();
+
+    for (const PlyElement& element : elements) {
+
+        const size_t fixedSize = element.FixedSize();
+        const char* elementEnd = nullptr;      /* ascii: end of the lines of this element */
+        if (!binary && !(elementEnd = SkipLines(p, end, element.count))) {
+            error = "file ends inside element " + element.name;
+            return false;
+        }
+
+        if (element.name == "vertex") {
+            std::vector<int> targets;
+            for (const PlyProperty& property : element.properties) {
+                if (property.countType != PlyType::None) {
+                    error = "vertex element with a list is not supported";
+                    return false;
+                }
+                int target = PlyVertexTarget(property.name);
+                targets.push_back(target);
+                mesh.hasNormals |= target >= 3 && target < 6;
+                mesh.hasUVs |= target >= 6;
+            }
+            for (int axis = 0; axis < 3; axis++)
+                if (std::find(targets.begin(), targets.end(), axis) == targets.end()) {
+                    error = "vertex element has no x / y / z";
+                    return false;
+                }
+
+            mesh.vertices.assign(element.count, MeshVertex{});
+            float* out = (float*)mesh.vertices.data();
+
+            if (binary) {
+                if (fixedSize == 0) {
+                    error = "vertex element has no properties";
+                    return false;
+                }
+                if ((size_t)(end - p) / fixedSize < element.count) {
+                    error = "file ends inside element vertex";
+                    return false;
+                }
+                pool.Run([&](unsigned int t) {
+                    for (size_t v = element.count * t / threads; v < element.count * (t + 1) / threads; v++) {
+                        const char* item = p + v * fixedSize;
+                        for (size_t k = 0; k < targets.size(); k++) {
+                            if (targets[k] >= 0)
+                                out[v * 8 + targets[k]] = (float)ReadPlyValue(item, element.properties[k].type, bigEndian);
+                            item += PlyTypeSize(element.properties[k].type);
+                        }
+                    }
+                });
+                p += element.count * fixedSize;
+            }
+            else {
+                /* every chunk counts its lines first, then parses them at the right place */
+                std::vector<std::pair<const char*, const char*>> ranges = SplitLines(p, elementEnd, threads);
+                std::vector<size_t> lineCounts(threads, 0), firstVertex(threads + 1, 0);
+                pool.Run([&](unsigned int t) {
+                    lineCounts[t] = (size_t)std::count(ranges[t].first, ranges[t].second, '\n');
+                    if (ranges[t].second == end && ranges[t].second > ranges[t].first && end[-1] != '\n')
+                        lineCounts[t]++;        /* last line without '\n' */
+                });
+                for (unsigned int t = 0; t < threads; t++)
+                    firstVertex[t + 1] = firstVertex[t] + lineCounts[t];
+
+                std::vector<char> bad(threads, 0);
+                pool.Run([&](unsigned int t) {
+                    const char* q = ranges[t].first;
+                    for (size_t v = firstVertex[t]; v < firstVertex[t + 1] && v < element.count; v++) {
+                        const char* lineEnd = LineEnd(q, ranges[t].second);
+                        for (size_t k = 0; k < targets.size(); k++) {
+                            float value = 0.0f;
+                            if (!ParseNumber(q, lineEnd, value)) {
+                                bad[t] = 1;
+                                return;
+                            }
+                            if (targets[k] >= 0)
+                                out[v * 8 + targets[k]] = value;
+                        }
+                        q = lineEnd < ranges[t].second ? lineEnd + 1 : ranges[t].second;
+                    }
+                });
+                if (std::find(bad.begin(), bad.end(), 1) != bad.end()) {
+                    error = "bad number in element vertex";
+                    return false;
+                }
+                p = elementEnd;
+            }
+        }
+        else if (element.name == "face") {
+            size_t list = element.properties.size();
+            size_t before = 0, after = 0;       /* binary: bytes of the other (fixed) properties */
+            bool otherLists = false;
+            for (size_t k = 0; k < element.properties.size(); k++) {
+                const PlyProperty& property = element.properties[k];
+                if (list == element.properties.size() && IsPlyIndexList(property))
+                    list = k;
+                else if (property.countType != PlyType::None)
+                    otherLists = true;
+                else
+                    (list == element.properties.size() ? before : after) += PlyTypeSize(property.type);
+            }
+            if (list == element.properties.size()) {
+                error = "face element has no vertex_indices";
+                return false;
+            }
+            const PlyProperty& indexList = element.properties[list];
+
+            if (binary) {
+                /* usually every face is a triangle, then every face has the same size and threads can read their own range */
+                const size_t countSize = PlyTypeSize(indexList.countType), indexSize = PlyTypeSize(indexList.type);
+                const size_t faceSize = before + countSize + 3 * indexSize + after;
+                bool triangles = !otherLists && (size_t)(end - p) / faceSize >= element.count;
+
+                if (triangles) {
+                    std::vector<char> notTriangle(threads, 0);
+                    pool.Run([&](unsigned int t) {
+                        for (size_t f = element.count * t / threads; f < element.count * (t + 1) / threads; f++)
+                            if (ReadPlyValue(p + f * faceSize + before, indexList.countType, bigEndian) != 3.0) {
+                                notTriangle[t] = 1;
+                                return;
+                            }
+                    });
+                    triangles = std::find(notTriangle.begin(), notTriangle.end(), 1) == notTriangle.end();
+                }
+
+                if (triangles) {
+                    mesh.indices.resize(element.count * 3);
+                    pool.Run([&](unsigned int t) {
+                        for (size_t f = element.count * t / threads; f < element.count * (t + 1) / threads; f++) {
+                            const char* item = p + f * faceSize + before + countSize;
+                            for (int k = 0; k < 3; k++)
+                                mesh.indices[f * 3 + k] = (unsigned int)ReadPlyValue(item + k * indexSize, indexList.type, bigEndian);
+                        }
+                    });
+                    p += element.count * faceSize;
+                }
+                else {
+                    /* one after the other, polygons are split into triangles */
+                    std::vector<unsigned int> polygon;
+                    for (size_t f = 0; f < element.count; f++) {
+                        for (const PlyProperty& property : element.properties) {
+                            size_t count = 1;
+                            if (property.countType != PlyType::None) {
+                                if ((size_t)(end - p) < PlyTypeSize(property.countType)) {
+                                    error = "file ends inside element face";
+                                    return false;
+                                }
+                                count = (size_t)ReadPlyValue(p, property.countType, bigEndian);
+                                p += PlyTypeSize(property.countType);
+                            }
+                            size_t size = PlyTypeSize(property.type);
+                            if ((size_t)(end - p) / size < count) {
+                                error = "file ends inside element face";
+                                return false;
+                            }
+                            if (&property == &indexList) {
+                                polygon.clear();
+                                for (size_t i = 0; i < count; i++)
+                                    polygon.push_back((unsigned int)ReadPlyValue(p + i * size, property.type, bigEndian));
+                                for (size_t i = 2; i < polygon.size(); i++)
+                                    mesh.indices.insert(mesh.indices.end(), { polygon[0], polygon[i - 1], polygon[i] });
+                            }
+                            p += count * size;
+                        }
+                    }
+                }
+            }
+            else {
+                /* every chunk makes its own triangles, then they are put together */
+                std::vector<std::pair<const char*, const char*>> ranges = SplitLines(p, elementEnd, threads);
+                std::vector<std::vector<unsigned int>> parts(threads);
+                std::vector<char> bad(threads, 0);
+                pool.Run([&](unsigned int t) {
+                    std::vector<unsigned int> polygon;
+                    const char* q = ranges[t].first;
+                    while (q < ranges[t].second) {
+                        const char* lineEnd = LineEnd(q, ranges[t].second);
+                        for (const PlyProperty& property : element.properties) {
+                            size_t count = 1;
+                            if (property.countType != PlyType::None && !ParseNumber(q, lineEnd, count)) {
+                                bad[t] = 1;
+                                return;
+                            }
+                            polygon.clear();
+                            for (size_t i = 0; i < count; i++) {
+                                double value = 0.0;
+                                if (!ParseNumber(q, lineEnd, value)) {
+                                    bad[t] = 1;
+                                    return;
+                                }
+                                polygon.push_back((unsigned int)value);
+                            }
+                            if (&property == &indexList)
+                                for (size_t i = 2; i < polygon.size(); i++)
+                                    parts[t].insert(parts[t].end(), { polygon[0], polygon[i - 1], polygon[i] });
+                        }
+                        q = lineEnd < ranges[t].second ? lineEnd + 1 : ranges[t].second;
+                    }
+                });
+                if (std::find(bad.begin(), bad.end(), 1) != bad.end()) {
+                    error = "bad number in element face";
+                    return false;
+                }
+
+                std::vector<size_t> firstIndex(threads + 1, 0);
+                for (unsigned int t = 0; t < threads; t++)
+                    firstIndex[t + 1] = firstIndex[t] + parts[t].size();
+                mesh.indices.resize(firstIndex[threads]);
+                pool.Run([&](unsigned int t) {
+                    std::copy(parts[t].begin(), parts[t].end(), mesh.indices.begin() + firstIndex[t]);
+                });
+                p = elementEnd;
+            }
+        }
+        else {
+            /* not needed, skipped */
+            if (!binary)
+                p = elementEnd;
+            else if (fixedSize > 0) {
+                if ((size_t)(end - p) / fixedSize < element.count) {
+                    error = "file ends inside element " + element.name;
+                    return false;
+                }
+                p += element.count * fixedSize;
+            }
+            else {
+                for (size_t i = 0; i < element.count; i++) {
+                    for (const PlyProperty& property : element.properties) {
+                        size_t count = 1;
+                        if (property.countType != PlyType::None) {
+                            if ((size_t)(end - p) < PlyTypeSize(property.countType)) {
+                                error = "file ends inside element " + element.name;
+                                return false;
+                            }
+                            count = (size_t)ReadPlyValue(p, property.countType, bigEndian);
+                            p += PlyTypeSize(property.countType);
+                        }
+                        if ((size_t)(end - p) / PlyTypeSize(property.type) < count) {
+                            error = "file ends inside element " + element.name;
+                            return false;
+                        }
+                        p += count * PlyTypeSize(property.type);
+                    }
+                }
+            }
+        }
+    }
+
+    /* indices must point at vertices */
+    std::vector<char> badIndex(threads, 0);
+    const size_t indexCount = mesh.indices.size();
+    pool.Run([&](unsigned int t) {
+        for (size_t i = indexCount * t / threads; i < indexCount * (t + 1) / threads; i++)
+            if (mesh.indices[i] >= mesh.vertices.size()) {
+                badIndex[t] = 1;
+                return;
+            }
+    });
+    if (std::find(badIndex.begin(), badIndex.end(), 1) != badIndex.end()) {
+        error = "face index out of range";
+        return false;
+    }
+
+    return true;
+}
+
+
+
+/* ------------- LOAD MESH ------------- */
+
+struct MeshLoadTimes {
+    double mapMs = 0.0;
+    double parseMs = 0.0;       /* parse + deduplicate */
+    double reorderMs = 0.0;
+};
+
+/* .obj or .ply by extension, false and 'error' when the file can not be read */
+static bool LoadMesh(const std::string& filepath, WorkerPool& pool, Mesh& mesh, std::string& error, MeshLoadTimes* times = nullptr) {
+
+    mesh = Mesh();
+    auto start = std::chrono::high_resolution_clock::now();
+    auto lap = [&start]() {
+        auto now = std::chrono::high_resolution_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(now - start).count();
+        start = now;
+        return ms;
+    };
+
+    std::string extension = std::filesystem::path(filepath).extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return (char)tolower((unsigned char)c); });
+    if (extension != ".obj" && extension != ".ply") {
+        error = "only .obj and .ply files";
+        return false;
+    }
+
+    MappedFile file(filepath);
+    if (!file.IsOpen()) {
+        error = "can not open file";
+        return false;
+    }
+    double mapMs = lap();
+
+    bool ok = extension == ".obj" ? LoadObj(file.View(), pool, mesh, error) : LoadPly(file.View(), pool, mesh, error);
+    double parseMs = lap();
+    if (!ok)
+        return false;
+
+    if (extension == ".obj")
+        RenumberByFirstUse(mesh);
+    double reorderMs = lap();
+
+    if (times)
+        *times = { mapMs, parseMs, reorderMs };
+    return true;
+}
+
+
+
+/* ------------- NAIVE LOADER (for comparison) ------------- */
+
+/* what many loaders do: getline + stringstream, std::map for the position/uv/normal triples */
+static bool LoadObjNaive(const std::string& filepath, Mesh& mesh) {
+
+    std::ifstream stream(filepath);
+    if (!stream)
+        return false;
+
+    mesh = Mesh();
+    std::vector<float> positions, uvs, normals;
+    std::map<std::tuple<int, int, int>, unsigned int> unique;
+
+    std::string line, type, corner;
+    while (getline(stream, line)) {
+        std::istringstream words(line);
+        if (!(words >> type))
+            continue;
+
+        if (type == "v" || type == "vn") {
+            float x, y, z;
+            words >> x >> y >> z;
+            (type == "v" ? positions : normals).insert((type == "v" ? positions : normals).end(), { x, y, z });
+        }
+        else if (type == "vt") {
+            float u = 0.0f, v = 0.0f;
+            words >> u >> v;
+            uvs.insert(uvs.end(), { u, v });
+        }
+        else if (type == "f") {
+            std::vector<unsigned int> polygon;
+            while (words >> corner) {
+                int index[3] = { 0, 0, 0 };
+                size_t a = corner.find('/');
+                index[0] = std::stoi(corner.substr(0, a));
+                if (a != std::string::npos) {
+                    size_t b = corner.find('/', a + 1);
+                    std::string uv = corner.substr(a + 1, b == std::string::npos ? std::string::npos : b - a - 1);
+                    if (!uv.empty())
+                        index[1] = std::stoi(uv);
+                    if (b != std::string::npos)
+                        index[2] = std::stoi(corner.substr(b + 1));
+                }
+                const size_t counts[3] = { positions.size() / 3, uvs.size() / 2, normals.size() / 3 };
+                for (int k = 0; k < 3; k++)
+                    if (index[k] < 0)
+                        index[k] += (int)counts[k] + 1;
+
+                auto key = std::make_tuple(index[0], index[1], index[2]);
+                auto it = unique.find(key);
+                if (it == unique.end()) {
+                    MeshVertex vertex = {};
+                    memcpy(vertex.position, &positions[(index[0] - 1) * 3], sizeof(vertex.position));
+                    if (index[1] > 0)
+                        memcpy(vertex.uv, &uvs[(index[1] - 1) * 2], sizeof(vertex.uv));
+                    if (index[2] > 0)
+                        memcpy(vertex.normal, &normals[(index[2] - 1) * 3], sizeof(vertex.normal));
+                    it = unique.emplace(key, (unsigned int)mesh.vertices.size()).first;
+                    mesh.vertices.push_back(vertex);
+                }
+                polygon.push_back(it->second);
+            }
+            for (size_t i = 2; i < polygon.size(); i++)
+                mesh.indices.insert(mesh.indices.end(), { polygon[0], polygon[i - 1], polygon[i] });
+        }
+    }
+    return true;
+}
+
+
+
+/* ------------- TEST FILES ------------- */
+
+/* side x side grid with waves, as quads with normals (obj) and as triangles (binary ply) */
+static bool WriteTestMeshes(unsigned int side, const std::string& objPath, const std::string& plyPath) {
+
+    std::vector<MeshVertex> vertices;
+    for (unsigned int j = 0; j < side; j++) {
+        for (unsigned int i = 0; i < side; i++) {
+            float x = -1.0f + 2.0f * i / (side - 1), y = -1.0f + 2.0f * j / (side - 1);
+            float dx = 0.6f * cosf(x * 6.0f) * cosf(y * 5.0f), dy = -0.5f * sinf(x * 6.0f) * sinf(y * 5.0f);
+            float length = sqrtf(dx * dx + dy * dy + 1.0f);
+            vertices.push_back({ { x, y, 0.1f * sinf(x * 6.0f) * cosf(y * 5.0f) }, { -dx / length, -dy / length, 1.0f / length }, { 0.0f, 0.0f } });
+        }
+    }
+
+    std::string text;
+    char buffer[160];
+    for (const MeshVertex& v : vertices) {
+        text.append(buffer, snprintf(buffer, sizeof(buffer), "v %.6f %.6f %.6f\n", v.position[0], v.position[1], v.position[2]));
+        text.append(buffer, snprintf(buffer, sizeof(buffer), "vn %.5f %.5f %.5f\n", v.normal[0], v.normal[1], v.normal[2]));
+    }
+    for (unsigned int j = 0; j + 1 < side; j++) {
+        for (unsigned int i = 0; i + 1 < side; i++) {
+            unsigned int a = j * side + i + 1, b = a + 1, c = a + side, d = c + 1;     /* obj counts from 1 */
+            text.append(buffer, snprintf(buffer, sizeof(buffer), "f %u//%u %u//%u %u//%u %u//%u\n", a, a, b, b, d, d, c, c));
+        }
+    }
+    std::ofstream obj(objPath, std::ios::binary);
+    obj << "# test grid\n" << text;
+
+    std::ofstream ply(plyPath, std::ios::binary);
+    ply << "ply\nformat binary_little_endian 1.0\ncomment test grid\n"
+        << "element vertex " << vertices.size() << "\n"
+        << "property float x\nproperty float y\nproperty float z\nproperty float nx\nproperty float ny\nproperty float nz\n"
+        << "element face " << (side - 1) * (side - 1) * 2 << "\n"
+        << "property list uchar int vertex_indices\nend_header\n";
+    for (const MeshVertex& v : vertices)
+        ply.write((const char*)&v, 6 * sizeof(float));        /* test only, assumes a little endian machine */
+    for (unsigned int j = 0; j + 1 < side; j++) {
+        for (unsigned int i = 0; i + 1 < side; i++) {
+            int a = (int)(j * side + i), b = a + 1, c = a + (int)side, d = c + 1;
+            int triangles[2][3] = { { a, b, d }, { d, c, a } };
+            for (auto& triangle : triangles) {
+                unsigned char count = 3;
+                ply.write((const char*)&count, 1);
+                ply.write((const char*)triangle, sizeof(triangle));
+            }
+        }
+    }
+
+    return (bool)obj && (bool)ply;
+}
+
+/* the sample shader has no matrices, so the mesh is moved and scaled into -0.9 .. 0.9 */
+static void FitToView(Mesh& mesh) {
+    if (mesh.vertices.empty())
+        return;
+
+    float low[3], high[3];
+    for (int k = 0; k < 3; k++)
+        low[k] = high[k] = mesh.vertices[0].position[k];
+    for (const MeshVertex& v : mesh.vertices)
+        for (int k = 0; k < 3; k++) {
+            low[k] = std::min(low[k], v.position[k]);
+            high[k] = std::max(high[k], v.position[k]);
+        }
+
+    float size = std::max({ high[0] - low[0], high[1] - low[1], high[2] - low[2], 1e-6f });
+    for (MeshVertex& v : mesh.vertices)
+        for (int k = 0; k < 3; k++)
+            v.position[k] = (v.position[k] - (low[k] + high[k]) * 0.5f) * 1.8f / size;
+}
+
+/* for files without normals: sum of the face normals at every vertex */
+static void ComputeNormals(Mesh& mesh) {
+    for (MeshVertex& v : mesh.vertices)
+        v.normal[0] = v.normal[1] = v.normal[2] = 0.0f;
+
+    for (size_t i = 0; i + 2 < mesh.indices.size(); i += 3) {
+        const float* a = mesh.vertices[mesh.indices[i]].position;
+        const float* b = mesh.vertices[mesh.indices[i + 1]].position;
+        const float* c = mesh.vertices[mesh.indices[i + 2]].position;
+        float e1[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] }, e2[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+        float n[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+        for (int k = 0; k < 3; k++)
+            for (int j = 0; j < 3; j++)
+                mesh.vertices[mesh.indices[i + k]].normal[j] += n[j];
+    }
+
+    for (MeshVertex& v : mesh.vertices) {
+        float length = sqrtf(v.normal[0] * v.normal[0] + v.normal[1] * v.normal[1] + v.normal[2] * v.normal[2]);
+        if (length > 0.0f)
+            for (int j = 0; j < 3; j++)
+                v.normal[j] /= length;
+        else
+            v.normal[2] = 1.0f;
+    }
+    mesh.hasNormals = true;
+}
+
+static void PrintLoad(const char* name, const Mesh& mesh, const MeshLoadTimes& times, size_t fileBytes) {
+    double totalMs = times.mapMs + times.parseMs + times.reorderMs;
+    std::cout << "  " << name << ": " << mesh.vertices.size() << " vertices, " << mesh.indices.size() / 3 << " triangles in " << totalMs
+              << " ms (map " << times.mapMs << ", parse " << times.parseMs << ", reorder " << times.reorderMs << "), "
+              << (totalMs > 0.0 ? fileBytes / 1048576.0 / (totalMs / 1000.0) : 0.0) << " MB/s" << std::endl;
+}
+
+
+
+int main(int argc, char** argv)
+{
+    /* GLFW BASIC STUFF */
+        GLFWwindow* window;
+
+        /* Initialize the GLFW library */
+        if (!glfwInit())
+            return -1;
+
+
+        /* setting version 3.3 and core profile (i.e mordern opengl) */
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);    /* most drivers only send debug messages in debug context */
+#endif
+
+
+        /* Create a windowed mode window and its OpenGL context */
+        window = glfwCreateWindow(640, 480, "Hello World", NULL, NULL);
+        if (!window)
+        {
+            glfwTerminate();
+            return -1;
+
+        }
+        /* Make the window's context current */
+        glfwMakeContextCurrent(window);
+
+        glfwSwapInterval(1);    /* controls FPS or intervel between buffer(frames) */
+
+    /*  END BASIC GLFW   */
+
+
+    /* Intitialize GLEW */
+        if (glewInit() != GLEW_OK) {
+            std::cout << "Error!" << std::endl;
+        }
+    /* END */
+
+    std::cout << glGetString(GL_VERSION) << std::endl;  /* prints the version of opengl using */
+
+    SetupGLErrorPolicy();
+
+
+
+    /* ------------- LOAD THE MESH ------------- */
+
+        WorkerPool pool(std::max(1u, std::thread::hardware_concurrency()));
+        Mesh mesh;
+        std::string error;
+        MeshLoadTimes times;
+
+        if (argc > 1) {
+            std::error_code ec;
+            size_t fileBytes = (size_t)std::filesystem::file_size(argv[1], ec);
+            std::cout << "[MeshLoader] " << argv[1] << ", " << pool.GetCount() << " threads" << std::endl;
+            if (!LoadMesh(argv[1], pool, mesh, error, &times)) {
+                std::cout << "  " << error << std::endl;
+                glfwTerminate();
+                return -1;
+            }
+            PrintLoad("loaded", mesh, times, fileBytes);
+        }
+        else {
+            std::filesystem::path folder = std::filesystem::temp_directory_path();
+            std::string objPath = (folder / "hw31_grid.obj").string(), plyPath = (folder / "hw31_grid.ply").string();
+            if (!WriteTestMeshes(501, objPath, plyPath)) {
+                std::cout << "[MeshLoader] can not write test meshes to " << folder.string() << std::endl;
+                glfwTerminate();
+                return -1;
+            }
+            std::cout << "[MeshLoader] test grid in " << folder.string() << ", " << pool.GetCount() << " threads" << std::endl;
+
+            Mesh naive;
+            auto start = std::chrono::high_resolution_clock::now();
+            LoadObjNaive(objPath, naive);
+            double naiveMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+            std::cout << "  obj naive: " << naive.vertices.size() << " vertices, " << naive.indices.size() / 3 << " triangles in " << naiveMs << " ms" << std::endl;
+
+            Mesh ply;
+            if (!LoadMesh(plyPath, pool, ply, error, &times))
+                std::cout << "  ply: " << error << std::endl;
+            else
+                PrintLoad("ply", ply, times, (size_t)std::filesystem::file_size(plyPath));
+
+            if (!LoadMesh(objPath, pool, mesh, error, &times)) {
+                std::cout << "  obj: " << error << std::endl;
+                glfwTerminate();
+                return -1;
+            }
+            PrintLoad("obj", mesh, times, (size_t)std::filesystem::file_size(objPath));
+        }
+
+        if (!mesh.hasNormals)
+            ComputeNormals(mesh);
+        FitToView(mesh);
+
+
+
+    /* ------------- Generating Data to be used to display in the window ------------- */
+
+            unsigned int vao;
+            GLCall(glGenVertexArrays(1, &vao));
+            GLCall(glBindVertexArray(vao));
+
+            unsigned int buffer;
+            GLCall(glGenBuffers(1, &buffer));
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, buffer));
+            GLCall(glBufferData(GL_ARRAY_BUFFER, mesh.vertices.size() * sizeof(MeshVertex), mesh.vertices.data(), GL_STATIC_DRAW));
+
+            GLCall(glEnableVertexAttribArray(0));
+            GLCall(glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(MeshVertex), (const void*)offsetof(MeshVertex, position)));
+            GLCall(glEnableVertexAttribArray(1));
+            GLCall(glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(MeshVertex), (const void*)offsetof(MeshVertex, normal)));
+            GLCall(glVertexAttrib4f(2, 0.8f, 0.75f, 0.6f, 1.0f));      /* color is the same for every vertex (attribute not enabled) */
+
+            unsigned int ibo;       // index buffer object
+            GLCall(glGenBuffers(1, &ibo));
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo));
+            GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh.indices.size() * sizeof(unsigned int), mesh.indices.data(), GL_STATIC_DRAW));
+
+            GLCall(glBindVertexArray(0));
+
+            const int indexCount = (int)mesh.indices.size();
+            mesh = Mesh();      /* on the GPU now */
+
+
+        ShaderProgramSource shaderSource = ParseShader("res/shaders/Basic - PACKED.shader");
+        unsigned int shader = CreateShader(shaderSource.VertexSource, shaderSource.FragmentSource);
+        GLCall(glUseProgram(shader));
+        GLCall(int location = glGetUniformLocation(shader, "u_Light"));
+        ASSERT(location != -1);
+
+
+    /* ------------- END OF GENERATING DATA ------------- */
+
+
+    /* ----------- Animation Variable ----------- */
+    float angle = 0.0f;
+
+
+
+    /* WHILE Loop to keep the window active till window is closed */
+    while (!glfwWindowShouldClose(window))
+    {
+        /* Render here */
+
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        GLCall(glUseProgram(shader));
+        GLCall(glUniform3f(location, cosf(angle), sinf(angle), 0.7f));     /* light goes around */
+        GLCall(glBindVertexArray(vao));
+        GLCall(glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr));
+
+        angle += 0.02f;
+
+
+        /* Swap front and back buffers */
+        glfwSwapBuffers(window);
+
+        /* Poll for and process events */
+        glfwPollEvents();
+    }
+
+    glDeleteProgram(shader);
+    glDeleteBuffers(1, &buffer);
+    glDeleteBuffers(1, &ibo);
+    glDeleteVertexArrays(1, &vao);
+
+    glfwTerminate();
+    return 0;
+}
+
+
+
+
+/* Makes and compile the shader by inputing the type and Source code */
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source) {
+
+    unsigned int id = glCreateShader(shaderType);   /* generate Shader and return id */
+    const char* src = source.c_str();               /* convert inputed string to char* */
+    GLCall(glShaderSource(id, 1, &src, nullptr));           /* attaching source code to the shader */
+    GLCall(glCompileShader(id));                            /* compile shader */
+
+    /* -------- ERROR HANDLING -------- */
+        int result;
+        GLCall(glGetShaderiv(id, GL_COMPILE_STATUS, &result));
+        if (result == GL_FALSE) {
+            int length;
+            GLCall(glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length));
+            std::vector<char> message(length + 1);      /* char Array of length 'length' (_malloca is only in MSVC) */
+            GLCall(glGetShaderInfoLog(id, length, &length, message.data()));
+
+            std::cout << "Failed To Compile " << (shaderType == GL_VERTEX_SHADER ? "vertex" : "fragment") << " shader" << std::endl;
+
+            std::cout << message.data() << std::endl;
+            GLCall(glDeleteShader(id));
+            return 0;
+        }
+
+    /* -------- END ERROR HANDLING -------- */
+
+    return id;
+
+}
+
+
+/* Creates a program Which contain vertex and fragment shader */
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader) {
+
+    GLCall(unsigned int program = glCreateProgram());                           /* generate program to store all shader and program to be run by GPU during while loop */
+    unsigned int vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
+    unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+
+    GLCall(glAttachShader(program, vs));                                        /* Attach shader to program to be run by GPU */
+    GLCall(glAttachShader(program, fs));
+    GLCall(glLinkProgram(program));
+    GLCall(glValidateProgram(program));
+    GLCall(glDeleteShader(vs));                                                 /* DELETING shader to save space as shader is already attached to program */
+    GLCall(glDeleteShader(fs));
+
+    return program;
+
+}
+
+
+/* Read file and output vertex and fragment shader source code */
+static ShaderProgramSource ParseShader(const std::string& filepath) {
+
+    std::ifstream stream(filepath);
+
+    enum class ShaderType {
+        NONE = -1, VERTEX = 0, FRAGMENT = 1
+    };
+
+    std::string line;
+    std::stringstream ss[2];
+    ShaderType type = ShaderType::NONE;
+    while (getline(stream, line)) {
+
+        if (line.find("#shader") != std::string::npos) {
+
+            if (line.find("vertex") != std::string::npos)
+                type = ShaderType::VERTEX;
+            else if (line.find("fragment") != std::string::npos)
+                type = ShaderType::FRAGMENT;
+
+        }
+        else {
+            ss[int(type)] << line << '\n';
+        }
+    }
+
+    return { ss[0].str(), ss[1].str() };
+}
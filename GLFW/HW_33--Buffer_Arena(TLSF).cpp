@@ -0,0 +1,901 @@
+/*
+
+Buffer Arena (many meshes in one VBO + IBO, TLSF sub allocator, base vertex draws)
+
+HW_9 / HW_10 make a VBO + IBO (+ VAO) for every object, drawing N objects is N VAO binds
+and every bind changes which buffers the GPU reads, so nothing can be batched
+
+MeshArena has one big VBO, one big IBO and one VAO for all meshes with the same vertex layout
+
+---> TlsfAllocator hands out (offset, size) ranges inside a buffer, it only does the book keeping (CPU side)
+     Two Level Segregated Fit: free ranges are in lists by size class (first level = power of 2,
+     second level = 16 steps in between), two bitmaps tell which lists have ranges,
+     so Allocate and Free are O(1) (a few bit scans), freed ranges are merged with free neighbours
+---> sizes are in vertices / indices and not in bytes, so the vertex offset is directly the base vertex:
+         glDrawElementsBaseVertex(GL_TRIANGLES, count, GL_UNSIGNED_INT, indexOffset * 4, vertexOffset)
+     indices of every mesh start at 0, the GPU adds the base vertex
+---> Add(vertices, indices) uploads with glBufferSubData (through GL_COPY_WRITE_BUFFER, so the VAO is not changed)
+     Remove(id) gives the ranges back
+---> stats: utilization = used / capacity, fragmentation = 1 - largest free range / all free space
+     (0 = all free space in one piece, near 1 = free space in many small holes)
+---> Defragment() moves every mesh to the front of new buffers with glCopyBufferSubData (GPU to GPU, no read back),
+     the mesh ids stay the same (needs the buffer memory twice for a moment)
+
+at start 3000 polygons are added, half removed and bigger ones added (holes), then defragmented,
+stats after every step and draw time of per object VAOs (HW_10 way) vs the arena
+
+*/
+
+
+
+
+#include <GL\glew.h>
+
+#include <GLFW/glfw3.h>
+
+
+#include <iostream>
+#include <fstream>  // to read file
+#include <string>   // To use getline func
+#include <sstream>
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <chrono>
+#include <functional>
+#include <cstddef>  // offsetof
+#include <cstdint>
+#include <math.h>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>     // _BitScanForward / _BitScanReverse
+#endif
+
+
+/* ------------ ERROR CHECK POLICY ------------ */
+/*
+GL_CHECK_NONE   -> GLCall(x) is just x, nothing is checked (release)
+GL_CHECK_ASYNC  -> GLCall(x) is just x, driver reports errors later through glDebugMessageCallback (needs KHR_debug / GL 4.3)
+GL_CHECK_STRICT -> glGetError before and after every call, stops on the line with the error (old GLCall)
+
+default is NONE for release (NDEBUG) and STRICT for debug, or pass -DGL_CHECK_POLICY=1 to compiler to choose
+*/
+#define GL_CHECK_NONE   0
+#define GL_CHECK_ASYNC  1
+#define GL_CHECK_STRICT 2
+
+#ifndef GL_CHECK_POLICY
+    #ifdef NDEBUG
+        #define GL_CHECK_POLICY GL_CHECK_NONE
+    #else
+        #define GL_CHECK_POLICY GL_CHECK_STRICT
+    #endif
+#endif
+
+
+/* ------------ MACRO ------------ */
+
+/* __debugbreak is only in MSVC, on gcc / clang SIGTRAP does same thing (debugger stops there) */
+#if defined(_MSC_VER)
+    #define DEBUG_BREAK() __debugbreak()
+#elif defined(__GNUC__) || defined(__clang__)
+    #include <signal.h>
+    #define DEBUG_BREAK() raise(SIGTRAP)
+#else
+    #include <cstdlib>
+    #define DEBUG_BREAK() std::abort()
+#endif
+
+#define ASSERT(x) if (!(x)) DEBUG_BREAK();
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+    #define GLCall(x) GLCLearError();\
+        x;\
+        ASSERT(GlLogCall(#x, __FILE__, __LINE__))
+#else
+    #define GLCall(x) x
+#endif
+
+/*
+# before a fucntion pass it as a stringand __FILE__and __LINE__ are macros to get file loc and line of fucntion
+and since MACROS HAS TO BE IN SAME LINE we use \ before line ends to write macros in multiple lines
+*/
+
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+static void GLCLearError() {
+    while (glGetError() != GL_NO_ERROR);    // glGetError get error and we get all the error until there are no arror left
+}
+
+static bool GlLogCall(const char* function, const char* file, int line) {
+    bool ok = true;
+    while (GLenum error = glGetError()) {
+        std::cout << "[OpenGl Error] (" << error << "): " << function << " " << file << ":" << line << std::endl;
+        ok = false;
+    }
+    return ok;
+}
+#endif
+
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+/* called by the driver (maybe from its own thread) when something is wrong */
+static void APIENTRY GlDebugCallback(GLenum /*source*/, GLenum type, GLuint id, GLenum severity, GLsizei /*length*/, const GLchar* message, const void* /*userParam*/) {
+
+    const char* level = severity == GL_DEBUG_SEVERITY_HIGH ? "HIGH" : severity == GL_DEBUG_SEVERITY_MEDIUM ? "MEDIUM" : "LOW";
+    std::cout << "[OpenGl Debug] (" << level << (type == GL_DEBUG_TYPE_ERROR ? ", error" : "") << ", id " << id << "): " << message << std::endl;
+}
+#endif
+
+/* call once after glewInit, sets up whatever the chosen policy needs */
+static void SetupGLErrorPolicy() {
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+    if (GLEW_VERSION_4_3 || GLEW_KHR_debug) {
+        glEnable(GL_DEBUG_OUTPUT);
+        glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);     /* driver does not have to report inside the call, so no slow down */
+        glDebugMessageCallback(GlDebugCallback, nullptr);
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);  /* skip info messages */
+        std::cout << "GL errors: async (debug callback)" << std::endl;
+    }
+    else {
+        std::cout << "GL errors: async asked but KHR_debug is not there, errors are not checked" << std::endl;
+    }
+#elif GL_CHECK_POLICY == GL_CHECK_STRICT
+    std::cout << "GL errors: strict (glGetError after every call)" << std::endl;
+#else
+    std::cout << "GL errors: off" << std::endl;
+#endif
+}
+
+
+
+struct ShaderProgramSource {
+    std::string VertexSource;
+    std::string FragmentSource;
+};
+
+static ShaderProgramSource ParseShader(const std::string& filepath);
+
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader);
+
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source);
+
+
+
+/* ------------- TLSF ALLOCATOR ------------- */
+
+/* index of the lowest / highest set bit, value must not be 0 */
+static inline int LowestBit(uint32_t value) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, value);
+    return (int)index;
+#else
+    return __builtin_ctz(value);
+#endif
+}
+
+static inline int HighestBit(uint32_t value) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse(&index, value);
+    return (int)index;
+#else
+    return 31 - __builtin_clz(value);
+#endif
+}
+
+/* ranges inside [0, capacity), in any unit (here vertices or indices), no memory is touched */
+class TlsfAllocator {
+public:
+    static const uint32_t Invalid = ~0u;
+
+    struct Stats {
+        uint32_t capacity = 0;
+        uint32_t used = 0;
+        uint32_t largestFree = 0;
+        uint32_t freeRanges = 0;
+        uint32_t allocations = 0;
+        float utilization = 0.0f;       /* used / capacity */
+        float fragmentation = 0.0f;     /* 1 - largest free / all free */
+    };
+
+    explicit TlsfAllocator(uint32_t capacity) : m_Capacity(capacity) { Reset(); }
+
+    /* everything free again, all handles are invalid */
+    void Reset() {
+        m_Blocks.clear();
+        m_UnusedBlocks.clear();
+        m_FirstLevel = 0;
+        for (int fl = 0; fl < FL_COUNT; fl++) {
+            m_SecondLevel[fl] = 0;
+            for (int sl = 0; sl < SL_COUNT; sl++)
+                m_Heads[fl][sl] = Invalid;
+        }
+        m_Used = 0;
+        m_Allocations = 0;
+        m_FreeRanges = 0;
+
+        if (m_Capacity > 0)
+            InsertFree(NewBlock(0, m_Capacity, Invalid, Invalid));
+    }
+
+    /* handle of a range of 'size', Invalid when no free range is big enough */
+    uint32_t Allocate(uint32_t size) {
+        if (size == 0 || size > m_Capacity - m_Used)
+            return Invalid;
+
+        uint32_t block = FindFree(size);
+        if (block == Invalid)
+            return Invalid;
+        RemoveFree(block);
+
+        /* rest of the range stays free */
+        if (m_Blocks[block].size > size) {
+            Block b = m_Blocks[block];
+            uint32_t rest = NewBlock(b.offset + size, b.size - size, block, b.nextPhysical);
+            if (b.nextPhysical != Invalid)
+                m_Blocks[b.nextPhysical].prevPhysical = rest;
+            m_Blocks[block].nextPhysical = rest;
+            m_Blocks[block].size = size;
+            InsertFree(rest);
+        }
+
+        m_Blocks[block].free = false;
+        m_Used += size;
+        m_Allocations++;
+        return block;
+    }
+
+    void Free(uint32_t block) {
+        ASSERT(block < m_Blocks.size() && !m_Blocks[block].free);
+        m_Used -= m_Blocks[block].size;
+        m_Allocations--;
+
+        /* merge with free neighbours, so free space does not stay in small pieces */
+        uint32_t next = m_Blocks[block].nextPhysical;
+        if (next != Invalid && m_Blocks[next].free) {
+            RemoveFree(next);
+            m_Blocks[block].size += m_Blocks[next].size;
+            Unlink(next);
+        }
+        uint32_t prev = m_Blocks[block].prevPhysical;
+        if (prev != Invalid && m_Blocks[prev].free) {
+            RemoveFree(prev);
+            m_Blocks[prev].size += m_Blocks[block].size;
+            Unlink(block);
+            block = prev;
+        }
+
+        InsertFree(block);
+    }
+
+    uint32_t GetOffset(uint32_t block) const { return m_Blocks[block].offset; }
+    uint32_t GetSize(uint32_t block) const { return m_Blocks[block].size; }
+    uint32_t GetCapacity() const { return m_Capacity; }
+
+    Stats GetStats() const {
+        Stats stats;
+        stats.capacity = m_Capacity;
+        stats.used = m_Used;
+        stats.freeRanges = m_FreeRanges;
+        stats.allocations = m_Allocations;
+
+        /* largest free range is in the highest list which has one */
+        if (m_FirstLevel != 0) {
+            int fl = HighestBit(m_FirstLevel);
+            int sl = HighestBit(m_SecondLevel[fl]);
+            for (uint32_t b = m_Heads[fl][sl]; b != Invalid; b = m_Blocks[b].nextFree)
+                stats.largestFree = std::max(stats.largestFree, m_Blocks[b].size);
+        }
+
+        uint32_t freeTotal = m_Capacity - m_Used;
+        stats.utilization = m_Capacity ? (float)m_Used / m_Capacity : 0.0f;
+        stats.fragmentation = freeTotal ? 1.0f - (float)stats.largestFree / freeTotal : 0.0f;
+        return stats;
+    }
+
+private:
+    static const int SL_BITS = 4;
+    static const int SL_COUNT = 1 << SL_BITS;
+    static const int FL_COUNT = 32 - SL_BITS + 1;       /* sizes up to 2^32 - 1 */
+
+    struct Block {
+        uint32_t offset, size;
+        uint32_t prevPhysical, nextPhysical;    /* neighbours in the buffer */
+        uint32_t prevFree, nextFree;            /* in the free list of its size class */
+        bool free;
+    };
+
+    /* size class: sizes < 16 have their own list, then every power of 2 is split in 16 lists */
+    static void Mapping(uint32_t size, int& fl, int& sl) {
+        if (size < (uint32_t)SL_COUNT) {
+            fl = 0;
+            sl = (int)size;
+        }
+        else {
+            int high = HighestBit(size);
+            sl = (int)(size >> (high - SL_BITS)) - SL_COUNT;
+            fl = high - SL_BITS + 1;
+        }
+    }
+
+    /* good fit: size rounded up to the next class, so the first range of any list found is big enough */
+    uint32_t FindFree(uint32_t size) const {
+        int fl, sl;
+        uint64_t rounded = size;
+        if (size >= (uint32_t)SL_COUNT)
+            rounded += (1u << (HighestBit(size) - SL_BITS)) - 1;
+
+        if (rounded <= 0xFFFFFFFFull) {
+            Mapping((uint32_t)rounded, fl, sl);
+            uint32_t secondMap = m_SecondLevel[fl] & (~0u << sl);
+            if (secondMap == 0) {
+                uint32_t firstMap = fl + 1 < 32 ? m_FirstLevel & (~0u << (fl + 1)) : 0;
+                if (firstMap != 0) {
+                    fl = LowestBit(firstMap);
+                    secondMap = m_SecondLevel[fl];
+                }
+            }
+            if (secondMap != 0)
+                return m_Heads[fl][LowestBit(secondMap)];
+        }
+
+        /* nearly full: a range in the size's own class may still fit */
+        Mapping(size, fl, sl);
+        for (uint32_t b = m_Heads[fl][sl]; b != Invalid; b = m_Blocks[b].nextFree)
+            if (m_Blocks[b].size >= size)
+                return b;
+        return Invalid;
+    }
+
+    void InsertFree(uint32_t block) {
+        int fl, sl;
+        Mapping(m_Blocks[block].size, fl, sl);
+
+        Block& b = m_Blocks[block];
+        b.free = true;
+        b.prevFree = Invalid;
+        b.nextFree = m_Heads[fl][sl];
+        if (b.nextFree != Invalid)
+            m_Blocks[b.nextFree].prevFree = block;
+        m_Heads[fl][sl] = block;
+
+        m_FirstLevel |= 1u << fl;
+        m_SecondLevel[fl] |= 1u << sl;
+        m_FreeRanges++;
+    }
+
+    void RemoveFree(uint32_t block) {
+        int fl, sl;
+        Mapping(m_Blocks[block].size, fl, sl);
+
+        Block& b = m_Blocks[block];
+        if (b.prevFree != Invalid)
+            m_Blocks[b.prevFree].nextFree = b.nextFree;
+        else
+            m_Heads[fl][sl] = b.nextFree;
+        if (b.nextFree != Invalid)
+            m_Blocks[b.nextFree].prevFree = b.prevFree;
+        b.free = false;
+
+        if (m_Heads[fl][sl] == Invalid) {
+            m_SecondLevel[fl] &= ~(1u << sl);
+            if (m_SecondLevel[fl] == 0)
+                m_FirstLevel &= ~(1u << fl);
+        }
+        m_FreeRanges--;
+    }
+
+    uint32_t NewBlock(uint32_t offset, uint32_t size, uint32_t prevPhysical, uint32_t nextPhysical) {
+        Block b = { offset, size, prevPhysical, nextPhysical, Invalid, Invalid, false };
+        if (!m_UnusedBlocks.empty()) {
+            uint32_t index = m_UnusedBlocks.back();
+            m_UnusedBlocks.pop_back();
+            m_Blocks[index] = b;
+            return index;
+        }
+        m_Blocks.push_back(b);
+        return (uint32_t)m_Blocks.size() - 1;
+    }
+
+    /* block was merged into its neighbour */
+    void Unlink(uint32_t block) {
+        Block& b = m_Blocks[block];
+        if (b.prevPhysical != Invalid)
+            m_Blocks[b.prevPhysical].nextPhysical = b.nextPhysical;
+        if (b.nextPhysical != Invalid)
+            m_Blocks[b.nextPhysical].prevPhysical = b.prevPhysical;
+        m_UnusedBlocks.push_back(block);
+    }
+
+    uint32_t m_Capacity;
+    std::vector<Block> m_Blocks;
+    std::vector<uint32_t> m_UnusedBlocks;
+    uint32_t m_FirstLevel = 0;
+    uint32_t m_SecondLevel[FL_COUNT];
+    uint32_t m_Heads[FL_COUNT][SL_COUNT];
+    uint32_t m_Used = 0, m_Allocations = 0, m_FreeRanges = 0;
+};
+
+
+
+/* ------------- MESH ARENA ------------- */
+
+/* one vertex -> position + color (same as HW_11) */
+struct QuadVertex {
+    float x, y;
+    float r, g, b, a;
+};
+
+/* one VAO + VBO + IBO for many meshes with QuadVertex layout */
+class MeshArena {
+public:
+    static const uint32_t Invalid = ~0u;
+
+    MeshArena(uint32_t vertexCapacity, uint32_t indexCapacity)
+        : m_Vertices(vertexCapacity), m_Indices(indexCapacity) {
+        GLCall(glGenVertexArrays(1, &m_VertexArray));
+        CreateBuffers(m_VertexBuffer, m_IndexBuffer);
+        SetupVertexArray();
+    }
+
+    ~MeshArena() {
+        glDeleteBuffers(1, &m_VertexBuffer);
+        glDeleteBuffers(1, &m_IndexBuffer);
+        glDeleteVertexArrays(1, &m_VertexArray);
+    }
+
+    MeshArena(const MeshArena&) = delete;
+    MeshArena& operator=(const MeshArena&) = delete;
+
+    /* copies the mesh into the arena, indices start at 0 for every mesh, Invalid when the arena has no room */
+    uint32_t Add(const QuadVertex* vertices, uint32_t vertexCount, const unsigned int* indices, uint32_t indexCount) {
+        uint32_t vertexBlock = m_Vertices.Allocate(vertexCount);
+        if (vertexBlock == Invalid)
+            return Invalid;
+        uint32_t indexBlock = m_Indices.Allocate(indexCount);
+        if (indexBlock == Invalid) {
+            m_Vertices.Free(vertexBlock);
+            return Invalid;
+        }
+
+        GLCall(glBindBuffer(GL_COPY_WRITE_BUFFER, m_VertexBuffer));
+        GLCall(glBufferSubData(GL_COPY_WRITE_BUFFER, (size_t)m_Vertices.GetOffset(vertexBlock) * sizeof(QuadVertex), vertexCount * sizeof(QuadVertex), vertices));
+        GLCall(glBindBuffer(GL_COPY_WRITE_BUFFER, m_IndexBuffer));
+        GLCall(glBufferSubData(GL_COPY_WRITE_BUFFER, (size_t)m_Indices.GetOffset(indexBlock) * sizeof(unsigned int), indexCount * sizeof(unsigned int), indices));
+
+        uint32_t id;
+        if (!m_FreeIds.empty()) {
+            id = m_FreeIds.back();
+            m_FreeIds.pop_back();
+        }
+        else {
+            id = (uint32_t)m_Meshes.size();
+            m_Meshes.push_back({});
+        }
+        m_Meshes[id] = { vertexBlock, indexBlock, true };
+        return id;
+    }
+
+    void Remove(uint32_t id) {
+        ASSERT(id < m_Meshes.size() && m_Meshes[id].live);
+        m_Vertices.Free(m_Meshes[id].vertexBlock);
+        m_Indices.Free(m_Meshes[id].indexBlock);
+        m_Meshes[id].live = false;
+        m_FreeIds.push_back(id);
+    }
+
+    /* once for all meshes */
+    void Bind() const {
+        GLCall(glBindVertexArray(m_VertexArray));
+    }
+
+    /* Bind() first */
+    void Draw(uint32_t id) const {
+        const ArenaMesh& mesh = m_Meshes[id];
+        const void* indexOffset = (const void*)((size_t)m_Indices.GetOffset(mesh.indexBlock) * sizeof(unsigned int));
+        GLCall(glDrawElementsBaseVertex(GL_TRIANGLES, (int)m_Indices.GetSize(mesh.indexBlock), GL_UNSIGNED_INT, indexOffset, (int)m_Vertices.GetOffset(mesh.vertexBlock)));
+    }
+
+    /* every mesh to the front of new buffers (GPU copies), ids stay the same, returns bytes copied */
+    size_t Defragment() {
+        struct Range { uint32_t id, offset, size; };
+        std::vector<Range> vertexRanges, indexRanges;
+        for (uint32_t id = 0; id < m_Meshes.size(); id++) {
+            if (!m_Meshes[id].live)
+                continue;
+            vertexRanges.push_back({ id, m_Vertices.GetOffset(m_Meshes[id].vertexBlock), m_Vertices.GetSize(m_Meshes[id].vertexBlock) });
+            indexRanges.push_back({ id, m_Indices.GetOffset(m_Meshes[id].indexBlock), m_Indices.GetSize(m_Meshes[id].indexBlock) });
+        }
+        auto byOffset = [](const Range& a, const Range& b) { return a.offset < b.offset; };
+        std::sort(vertexRanges.begin(), vertexRanges.end(), byOffset);
+        std::sort(indexRanges.begin(), indexRanges.end(), byOffset);
+
+        unsigned int vertexBuffer, indexBuffer;
+        CreateBuffers(vertexBuffer, indexBuffer);
+
+        /* empty allocator gives ranges one after the other from 0, in the same order as before */
+        size_t copied = 0;
+        m_Vertices.Reset();
+        GLCall(glBindBuffer(GL_COPY_READ_BUFFER, m_VertexBuffer));
+        GLCall(glBindBuffer(GL_COPY_WRITE_BUFFER, vertexBuffer));
+        for (const Range& range : vertexRanges) {
+            uint32_t block = m_Vertices.Allocate(range.size);
+            m_Meshes[range.id].vertexBlock = block;
+            GLCall(glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, (size_t)range.offset * sizeof(QuadVertex),
+                                       (size_t)m_Vertices.GetOffset(block) * sizeof(QuadVertex), (size_t)range.size * sizeof(QuadVertex)));
+            copied += (size_t)range.size * sizeof(QuadVertex);
+        }
+
+        m_Indices.Reset();
+        GLCall(glBindBuffer(GL_COPY_READ_BUFFER, m_IndexBuffer));
+        GLCall(glBindBuffer(GL_COPY_WRITE_BUFFER, indexBuffer));
+        for (const Range& range : indexRanges) {
+            uint32_t block = m_Indices.Allocate(range.size);
+            m_Meshes[range.id].indexBlock = block;
+            GLCall(glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, (size_t)range.offset * sizeof(unsigned int),
+                                       (size_t)m_Indices.GetOffset(block) * sizeof(unsigned int), (size_t)range.size * sizeof(unsigned int)));
+            copied += (size_t)range.size * sizeof(unsigned int);
+        }
+
+        glDeleteBuffers(1, &m_VertexBuffer);
+        glDeleteBuffers(1, &m_IndexBuffer);
+        m_VertexBuffer = vertexBuffer;
+        m_IndexBuffer = indexBuffer;
+        SetupVertexArray();         /* VAO points at the new buffers */
+
+        return copied;
+    }
+
+    TlsfAllocator::Stats GetVertexStats() const { return m_Vertices.GetStats(); }
+    TlsfAllocator::Stats GetIndexStats() const { return m_Indices.GetStats(); }
+
+private:
+    struct ArenaMesh {
+        uint32_t vertexBlock = Invalid;
+        uint32_t indexBlock = Invalid;
+        bool live = false;
+    };
+
+    void CreateBuffers(unsigned int& vertexBuffer, unsigned int& indexBuffer) const {
+        GLCall(glGenBuffers(1, &vertexBuffer));
+        GLCall(glBindBuffer(GL_COPY_WRITE_BUFFER, vertexBuffer));
+        GLCall(glBufferData(GL_COPY_WRITE_BUFFER, (size_t)m_Vertices.GetCapacity() * sizeof(QuadVertex), nullptr, GL_STATIC_DRAW));
+
+        GLCall(glGenBuffers(1, &indexBuffer));
+        GLCall(glBindBuffer(GL_COPY_WRITE_BUFFER, indexBuffer));
+        GLCall(glBufferData(GL_COPY_WRITE_BUFFER, (size_t)m_Indices.GetCapacity() * sizeof(unsigned int), nullptr, GL_STATIC_DRAW));
+    }
+
+    void SetupVertexArray() const {
+        GLCall(glBindVertexArray(m_VertexArray));
+        GLCall(glBindBuffer(GL_ARRAY_BUFFER, m_VertexBuffer));
+        GLCall(glEnableVertexAttribArray(0));
+        GLCall(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(QuadVertex), (const void*)offsetof(QuadVertex, x)));
+        GLCall(glEnableVertexAttribArray(1));
+        GLCall(glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(QuadVertex), (const void*)offsetof(QuadVertex, r)));
+        GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IndexBuffer));
+        GLCall(glBindVertexArray(0));
+    }
+
+    TlsfAllocator m_Vertices, m_Indices;
+    unsigned int m_VertexArray = 0, m_VertexBuffer = 0, m_IndexBuffer = 0;
+    std::vector<ArenaMesh> m_Meshes;
+    std::vector<uint32_t> m_FreeIds;
+};
+
+
+
+/* ------------- TEST MESHES ------------- */
+
+struct PolygonMesh {
+    std::vector<QuadVertex> vertices;
+    std::vector<unsigned int> indices;
+};
+
+/* filled polygon with 'sides' corners (center + ring, triangle fan as indices) */
+static PolygonMesh MakePolygon(float x, float y, float radius, unsigned int sides, const float color[4]) {
+    PolygonMesh mesh;
+    mesh.vertices.push_back({ x, y, color[0], color[1], color[2], color[3] });
+    for (unsigned int i = 0; i < sides; i++) {
+        float angle = 6.2831853f * i / sides;
+        mesh.vertices.push_back({ x + radius * cosf(angle), y + radius * sinf(angle), color[0] * 0.6f, color[1] * 0.6f, color[2] * 0.6f, color[3] });
+        mesh.indices.insert(mesh.indices.end(), { 0, 1 + i, 1 + (i + 1) % sides });
+    }
+    return mesh;
+}
+
+static void PrintArenaStats(const char* step, const MeshArena& arena) {
+    TlsfAllocator::Stats v = arena.GetVertexStats(), i = arena.GetIndexStats();
+    std::cout << "  " << step << ": " << v.allocations << " meshes, vertices " << v.utilization * 100.0f << "% used, fragmentation "
+              << v.fragmentation * 100.0f << "% (" << v.freeRanges << " free ranges), indices " << i.utilization * 100.0f
+              << "% used, fragmentation " << i.fragmentation * 100.0f << "% (" << i.freeRanges << " free ranges)" << std::endl;
+}
+
+
+
+int main(void)
+{
+    /* GLFW BASIC STUFF */
+        GLFWwindow* window;
+
+        /* Initialize the GLFW library */
+        if (!glfwInit())
+            return -1;
+
+
+        /* setting version 3.3 and core profile (i.e mordern opengl) */
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);    /* most drivers only send debug messages in debug context */
+#endif
+
+
+        /* Create a windowed mode window and its OpenGL context */
+        window = glfwCreateWindow(640, 480, "Hello World", NULL, NULL);
+        if (!window)
+        {
+            glfwTerminate();
+            return -1;
+
+        }
+        /* Make the window's context current */
+        glfwMakeContextCurrent(window);
+
+        glfwSwapInterval(1);    /* controls FPS or intervel between buffer(frames) */
+
+    /*  END BASIC GLFW   */
+
+
+    /* Intitialize GLEW */
+        if (glewInit() != GLEW_OK) {
+            std::cout << "Error!" << std::endl;
+        }
+    /* END */
+
+    std::cout << glGetString(GL_VERSION) << std::endl;  /* prints the version of opengl using */
+
+    SetupGLErrorPolicy();
+
+
+    { /* scope so that the arena deletes its buffers before glfwTerminate destroys the context */
+
+    /* ------------- Generating Data to be used to display in the window ------------- */
+
+        std::mt19937 random(42);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+        auto randomPolygon = [&](unsigned int minSides, unsigned int maxSides) {
+            float color[4] = { 0.3f + 0.7f * unit(random), 0.3f + 0.7f * unit(random), 0.3f + 0.7f * unit(random), 1.0f };
+            unsigned int sides = minSides + (unsigned int)(unit(random) * (maxSides - minSides));
+            return MakePolygon(-0.95f + 1.9f * unit(random), -0.95f + 1.9f * unit(random), 0.01f + 0.02f * unit(random), sides, color);
+        };
+
+        MeshArena arena(1 << 18, 3 << 18);      /* 262144 vertices (6 MB), 786432 indices (3 MB) */
+        std::vector<uint32_t> ids;
+        std::vector<PolygonMesh> meshes;        /* CPU copy, index = arena id, for the per object comparison */
+
+        auto add = [&](PolygonMesh mesh) {
+            uint32_t id = arena.Add(mesh.vertices.data(), (uint32_t)mesh.vertices.size(), mesh.indices.data(), (uint32_t)mesh.indices.size());
+            if (id == MeshArena::Invalid)
+                return false;
+            if (id >= meshes.size())
+                meshes.resize(id + 1);
+            meshes[id] = std::move(mesh);
+            ids.push_back(id);
+            return true;
+        };
+
+        std::cout << "[Arena]" << std::endl;
+        for (int i = 0; i < 3000; i++)
+            add(randomPolygon(3, 48));
+        PrintArenaStats("3000 added        ", arena);
+
+        /* half removed, bigger ones added -> the small holes do not fit them */
+        std::shuffle(ids.begin(), ids.end(), random);
+        for (size_t i = ids.size() / 2; i < ids.size(); i++)
+            arena.Remove(ids[i]);
+        ids.resize(ids.size() / 2);
+        PrintArenaStats("1500 removed      ", arena);
+
+        unsigned int failed = 0;
+        for (int i = 0; i < 1500; i++)
+            if (!add(randomPolygon(40, 96)))
+                failed++;
+        PrintArenaStats("1500 bigger added ", arena);
+        if (failed)
+            std::cout << "  " << failed << " did not fit" << std::endl;
+
+        glFinish();
+        auto start = std::chrono::high_resolution_clock::now();
+        size_t copied = arena.Defragment();
+        glFinish();
+        double defragMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+        PrintArenaStats("defragmented      ", arena);
+        std::cout << "  defragment copied " << copied / 1024 << " KB on the GPU in " << defragMs << " ms" << std::endl;
+
+        /* the HW_10 way: VAO + VBO + IBO per object */
+        std::vector<unsigned int> objectVaos, objectBuffers;
+        for (uint32_t id : ids) {
+            const PolygonMesh& mesh = meshes[id];
+            unsigned int vao, buffers[2];
+            GLCall(glGenVertexArrays(1, &vao));
+            GLCall(glBindVertexArray(vao));
+            GLCall(glGenBuffers(2, buffers));
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, buffers[0]));
+            GLCall(glBufferData(GL_ARRAY_BUFFER, mesh.vertices.size() * sizeof(QuadVertex), mesh.vertices.data(), GL_STATIC_DRAW));
+            GLCall(glEnableVertexAttribArray(0));
+            GLCall(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(QuadVertex), (const void*)offsetof(QuadVertex, x)));
+            GLCall(glEnableVertexAttribArray(1));
+            GLCall(glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(QuadVertex), (const void*)offsetof(QuadVertex, r)));
+            GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]));
+            GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh.indices.size() * sizeof(unsigned int), mesh.indices.data(), GL_STATIC_DRAW));
+            objectVaos.push_back(vao);
+            objectBuffers.insert(objectBuffers.end(), buffers, buffers + 2);
+        }
+        GLCall(glBindVertexArray(0));
+
+
+        ShaderProgramSource shaderSource = ParseShader("res/shaders/Basic - BATCH.shader");
+        unsigned int shader = CreateShader(shaderSource.VertexSource, shaderSource.FragmentSource);
+        GLCall(glUseProgram(shader));
+
+
+    /* ------------- BENCHMARK (per object VAOs vs arena) ------------- */
+
+        glfwSwapInterval(0);
+
+        const int benchFrames = 100;
+
+        auto timeFrames = [&](const std::function<void()>& drawAll) {
+            drawAll();
+            glFinish();
+            auto begin = std::chrono::high_resolution_clock::now();
+            for (int frame = 0; frame < benchFrames; frame++) {
+                glClear(GL_COLOR_BUFFER_BIT);
+                drawAll();
+                glFinish();
+            }
+            return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - begin).count() / benchFrames;
+        };
+
+        double objectMs = timeFrames([&]() {
+            for (size_t i = 0; i < ids.size(); i++) {
+                GLCall(glBindVertexArray(objectVaos[i]));
+                GLCall(glDrawElements(GL_TRIANGLES, (int)meshes[ids[i]].indices.size(), GL_UNSIGNED_INT, nullptr));
+            }
+        });
+        double arenaMs = timeFrames([&]() {
+            arena.Bind();
+            for (uint32_t id : ids)
+                arena.Draw(id);
+        });
+
+        std::cout << "[Benchmark] " << ids.size() << " meshes: VAO per object " << objectMs << " ms/frame, arena (1 VAO, base vertex) "
+                  << arenaMs << " ms/frame" << std::endl;
+
+        glfwSwapInterval(1);
+
+        for (unsigned int vao : objectVaos)
+            glDeleteVertexArrays(1, &vao);
+        glDeleteBuffers((int)objectBuffers.size(), objectBuffers.data());
+
+
+    /* ------------- END OF GENERATING DATA ------------- */
+
+
+
+    /* WHILE Loop to keep the window active till window is closed */
+    while (!glfwWindowShouldClose(window))
+    {
+        /* Render here */
+
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        GLCall(glUseProgram(shader));
+        arena.Bind();
+        for (uint32_t id : ids)
+            arena.Draw(id);
+
+
+        /* Swap front and back buffers */
+        glfwSwapBuffers(window);
+
+        /* Poll for and process events */
+        glfwPollEvents();
+    }
+
+    glDeleteProgram(shader);
+
+    }
+
+    glfwTerminate();
+    return 0;
+}
+
+
+
+
+/* Makes and compile the shader by inputing the type and Source code */
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source) {
+
+    unsigned int id = glCreateShader(shaderType);   /* generate Shader and return id */
+    const char* src = source.c_str();               /* convert inputed string to char* */
+    GLCall(glShaderSource(id, 1, &src, nullptr));           /* attaching source code to the shader */
+    GLCall(glCompileShader(id));                            /* compile shader */
+
+    /* -------- ERROR HANDLING -------- */
+        int result;
+        GLCall(glGetShaderiv(id, GL_COMPILE_STATUS, &result));
+        if (result == GL_FALSE) {
+            int length;
+            GLCall(glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length));
+            std::vector<char> message(length + 1);      /* char Array of length 'length' (_malloca is only in MSVC) */
+            GLCall(glGetShaderInfoLog(id, length, &length, message.data()));
+
+            std::cout << "Failed To Compile " << (shaderType == GL_VERTEX_SHADER ? "vertex" : "fragment") << " shader" << std::endl;
+
+            std::cout << message.data() << std::endl;
+            GLCall(glDeleteShader(id));
+            return 0;
+        }
+
+    /* -------- END ERROR HANDLING -------- */
+
+    return id;
+
+}
+
+
+/* Creates a program Which contain vertex and fragment shader */
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader) {
+
+    GLCall(unsigned int program = glCreateProgram());                           /* generate program to store all shader and program to be run by GPU during while loop */
+    unsigned int vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
+    unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+
+    GLCall(glAttachShader(program, vs));                                        /* Attach shader to program to be run by GPU */
+    GLCall(glAttachShader(program, fs));
+    GLCall(glLinkProgram(program));
+    GLCall(glValidateProgram(program));
+    GLCall(glDeleteShader(vs));                                                 /* DELETING shader to save space as shader is already attached to program */
+    GLCall(glDeleteShader(fs));
+
+    return program;
+
+}
+
+
+/* Read file and output vertex and fragment shader source code */
+static ShaderProgramSource ParseShader(const std::string& filepath) {
+
+    std::ifstream stream(filepath);
+
+    enum class ShaderType {
+        NONE = -1, VERTEX = 0, FRAGMENT = 1
+    };
+
+    std::string line;
+    std::stringstream ss[2];
+    ShaderType type = ShaderType::NONE;
+    while (getline(stream, line)) {
+
+        if (line.find("#shader") != std::string::npos) {
+
+            if (line.find("vertex") != std::string::npos)
+                type = ShaderType::VERTEX;
+            else if (line.find("fragment") != std::string::npos)
+                type = ShaderType::FRAGMENT;
+
+        }
+        else {
+            ss[int(type)] << line << '\n';
+        }
+    }
+
+    return { ss[0].str(), ss[1].str() };
+}
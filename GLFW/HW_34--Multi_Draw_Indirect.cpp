@@ -0,0 +1,608 @@
+/*
+
+Multi Draw Indirect (one draw call for every visible object)
+
+HW_9 / HW_10 bind and draw every object on its own, CPU cost grows with the object count
+(every draw call is validated by the driver), HW_33 put all meshes in one VBO + IBO so no binds are needed,
+but it is still one glDrawElementsBaseVertex per object
+
+here the draw calls themselves are data in a buffer:
+
+    struct DrawElementsIndirectCommand { count, instanceCount, firstIndex, baseVertex, baseInstance }
+
+---> every frame the objects are culled against the screen, for every visible one a command is written
+     (mesh range in the shared VBO + IBO) and its InstanceData (offset, scale, color) is written at index i
+---> both go to buffers (orphaned with glBufferData nullptr, HW_13) and ONE call draws all of them:
+         glBindBuffer(GL_DRAW_INDIRECT_BUFFER, ...)
+         glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, commandCount, 0)
+---> per draw data: command i has baseInstance = i, and the instance attributes (glVertexAttribDivisor = 1)
+     start reading at baseInstance, so draw i gets InstanceData i with the same "Basic - INSTANCED.shader" as HW_12
+     (with ARB_shader_draw_parameters the shader could read gl_DrawIDARB and index a buffer itself,
+      base instance is used here because it works with the #version 330 shader and plain vertex attributes)
+---> needs GL 4.3 or ARB_multi_draw_indirect + ARB_base_instance, software GL / old drivers often have not:
+     then the same command list is drawn by a loop of glDrawElementsBaseVertex,
+     per draw data set with glVertexAttrib* (current value of a disabled attribute, no buffer)
+
+    HW_34           indirect path when supported
+    HW_34 --loop    always the loop path
+
+at start both paths are benchmarked (CPU time to build + submit, frame time with glFinish) for 20000 objects
+
+*/
+
+
+
+
+#include <GL\glew.h>
+
+#include <GLFW/glfw3.h>
+
+
+#include <iostream>
+#include <fstream>  // to read file
+#include <string>   // To use getline func
+#include <sstream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <functional>
+#include <cstddef>  // offsetof
+#include <math.h>
+
+
+
+/* ------------ ERROR CHECK POLICY ------------ */
+/*
+GL_CHECK_NONE   -> GLCall(x) is just x, nothing is checked (release)
+GL_CHECK_ASYNC  -> GLCall(x) is just x, driver reports errors later through glDebugMessageCallback (needs KHR_debug / GL 4.3)
+GL_CHECK_STRICT -> glGetError before and after every call, stops on the line with the error (old GLCall)
+
+default is NONE for release (NDEBUG) and STRICT for debug, or pass -DGL_CHECK_POLICY=1 to compiler to choose
+*/
+#define GL_CHECK_NONE   0
+#define GL_CHECK_ASYNC  1
+#define GL_CHECK_STRICT 2
+
+#ifndef GL_CHECK_POLICY
+    #ifdef NDEBUG
+        #define GL_CHECK_POLICY GL_CHECK_NONE
+    #else
+        #define GL_CHECK_POLICY GL_CHECK_STRICT
+    #endif
+#endif
+
+
+/* ------------ MACRO ------------ */
+
+/* __debugbreak is only in MSVC, on gcc / clang SIGTRAP does same thing (debugger stops there) */
+#if defined(_MSC_VER)
+    #define DEBUG_BREAK() __debugbreak()
+#elif defined(__GNUC__) || defined(__clang__)
+    #include <signal.h>
+    #define DEBUG_BREAK() raise(SIGTRAP)
+#else
+    #include <cstdlib>
+    #define DEBUG_BREAK() std::abort()
+#endif
+
+#define ASSERT(x) if (!(x)) DEBUG_BREAK();
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+    #define GLCall(x) GLCLearError();\
+        x;\
+        ASSERT(GlLogCall(#x, __FILE__, __LINE__))
+#else
+    #define GLCall(x) x
+#endif
+
+/*
+# before a fucntion pass it as a stringand __FILE__and __LINE__ are macros to get file loc and line of fucntion
+and since MACROS HAS TO BE IN SAME LINE we use \ before line ends to write macros in multiple lines
+*/
+
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+static void GLCLearError() {
+    while (glGetError() != GL_NO_ERROR);    // glGetError get error and we get all the error until there are no arror left
+}
+
+static bool GlLogCall(const char* function, const char* file, int line) {
+    bool ok = true;
+    while (GLenum error = glGetError()) {
+        std::cout << "[OpenGl Error] (" << error << "): " << function << " " << file << ":" << line << std::endl;
+        ok = false;
+    }
+    return ok;
+}
+#endif
+
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+/* called by the driver (maybe from its own thread) when something is wrong */
+static void APIENTRY GlDebugCallback(GLenum /*source*/, GLenum type, GLuint id, GLenum severity, GLsizei /*length*/, const GLchar* message, const void* /*userParam*/) {
+
+    const char* level = severity == GL_DEBUG_SEVERITY_HIGH ? "HIGH" : severity == GL_DEBUG_SEVERITY_MEDIUM ? "MEDIUM" : "LOW";
+    std::cout << "[OpenGl Debug] (" << level << (type == GL_DEBUG_TYPE_ERROR ? ", error" : "") << ", id " << id << "): " << message << std::endl;
+}
+#endif
+
+/* call once after glewInit, sets up whatever the chosen policy needs */
+static void SetupGLErrorPolicy() {
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+    if (GLEW_VERSION_4_3 || GLEW_KHR_debug) {
+        glEnable(GL_DEBUG_OUTPUT);
+        glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);     /* driver does not have to report inside the call, so no slow down */
+        glDebugMessageCallback(GlDebugCallback, nullptr);
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);  /* skip info messages */
+        std::cout << "GL errors: async (debug callback)" << std::endl;
+    }
+    else {
+        std::cout << "GL errors: async asked but KHR_debug is not there, errors are not checked" << std::endl;
+    }
+#elif GL_CHECK_POLICY == GL_CHECK_STRICT
+    std::cout << "GL errors: strict (glGetError after every call)" << std::endl;
+#else
+    std::cout << "GL errors: off" << std::endl;
+#endif
+}
+
+
+
+struct ShaderProgramSource {
+    std::string VertexSource;
+    std::string FragmentSource;
+};
+
+static ShaderProgramSource ParseShader(const std::string& filepath);
+
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader);
+
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source);
+
+
+
+/* ------------- SCENE ------------- */
+
+/* layout fixed by GL, one command = one glDrawElementsInstancedBaseVertexBaseInstance */
+struct DrawElementsIndirectCommand {
+    GLuint count;
+    GLuint instanceCount;
+    GLuint firstIndex;
+    GLint  baseVertex;
+    GLuint baseInstance;
+};
+
+/* per draw data, same as HW_12 */
+struct InstanceData {
+    float offsetX, offsetY;
+    float scale;
+    float r, g, b, a;
+};
+
+/* where a mesh is in the shared VBO + IBO */
+struct MeshRange {
+    unsigned int indexCount;
+    unsigned int firstIndex;
+    int baseVertex;
+};
+
+struct SceneObject {
+    float x, y;
+    float velocityX, velocityY;
+    float scale;
+    float color[4];
+    unsigned int mesh;
+};
+
+/* all polygons with 3 .. 3 + count - 1 sides, radius 1 around 0 (triangle fan as indices, starting at 0 for every mesh) */
+static std::vector<MeshRange> MakePolygonMeshes(unsigned int count, std::vector<float>& positions, std::vector<unsigned int>& indices) {
+    std::vector<MeshRange> ranges;
+    for (unsigned int mesh = 0; mesh < count; mesh++) {
+        unsigned int sides = 3 + mesh;
+        MeshRange range = { sides * 3, (unsigned int)indices.size(), (int)(positions.size() / 2) };
+
+        positions.insert(positions.end(), { 0.0f, 0.0f });
+        for (unsigned int i = 0; i < sides; i++) {
+            float angle = 6.2831853f * i / sides;
+            positions.insert(positions.end(), { cosf(angle), sinf(angle) });
+            indices.insert(indices.end(), { 0, 1 + i, 1 + (i + 1) % sides });
+        }
+        ranges.push_back(range);
+    }
+    return ranges;
+}
+
+static void MoveObjects(std::vector<SceneObject>& objects, float deltaTime) {
+    for (SceneObject& object : objects) {
+        object.x += object.velocityX * deltaTime;
+        object.y += object.velocityY * deltaTime;
+        /* objects go a bit out of the screen before turning, so some are always culled */
+        if (object.x < -1.3f || object.x > 1.3f)
+            object.velocityX = -object.velocityX;
+        if (object.y < -1.3f || object.y > 1.3f)
+            object.velocityY = -object.velocityY;
+    }
+}
+
+/* one command + one InstanceData for every object on screen, command i reads InstanceData i */
+static void BuildDrawList(const std::vector<SceneObject>& objects, const std::vector<MeshRange>& meshes,
+                          std::vector<DrawElementsIndirectCommand>& commands, std::vector<InstanceData>& instances) {
+    commands.clear();
+    instances.clear();
+    for (const SceneObject& object : objects) {
+        if (fabsf(object.x) - object.scale > 1.0f || fabsf(object.y) - object.scale > 1.0f)
+            continue;
+
+        const MeshRange& mesh = meshes[object.mesh];
+        commands.push_back({ mesh.indexCount, 1, mesh.firstIndex, mesh.baseVertex, (GLuint)instances.size() });
+        instances.push_back({ object.x, object.y, object.scale, object.color[0], object.color[1], object.color[2], object.color[3] });
+    }
+}
+
+
+
+/* ------------- RENDERER ------------- */
+
+/* shared VBO + IBO, draws a command list with one glMultiDrawElementsIndirect or a loop of glDrawElementsBaseVertex */
+class IndirectRenderer {
+public:
+    IndirectRenderer(const std::vector<float>& positions, const std::vector<unsigned int>& indices) {
+        m_IndirectSupported = (GLEW_VERSION_4_3 || GLEW_ARB_multi_draw_indirect) && (GLEW_VERSION_4_2 || GLEW_ARB_base_instance);
+
+        GLCall(glGenBuffers(1, &m_VertexBuffer));
+        GLCall(glBindBuffer(GL_ARRAY_BUFFER, m_VertexBuffer));
+        GLCall(glBufferData(GL_ARRAY_BUFFER, positions.size() * sizeof(float), positions.data(), GL_STATIC_DRAW));
+        GLCall(glGenBuffers(1, &m_IndexBuffer));
+        GLCall(glGenBuffers(1, &m_InstanceBuffer));
+        GLCall(glGenBuffers(1, &m_IndirectBuffer));
+
+        /* indirect path: position per vertex + InstanceData per instance */
+        GLCall(glGenVertexArrays(1, &m_IndirectVertexArray));
+        GLCall(glBindVertexArray(m_IndirectVertexArray));
+        GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IndexBuffer));
+        GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW));
+        GLCall(glEnableVertexAttribArray(0));
+        GLCall(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), nullptr));
+
+        GLCall(glBindBuffer(GL_ARRAY_BUFFER, m_InstanceBuffer));
+        GLCall(glEnableVertexAttribArray(1));
+        GLCall(glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (const void*)offsetof(InstanceData, offsetX)));
+        GLCall(glVertexAttribDivisor(1, 1));
+        GLCall(glEnableVertexAttribArray(2));
+        GLCall(glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (const void*)offsetof(InstanceData, scale)));
+        GLCall(glVertexAttribDivisor(2, 1));
+        GLCall(glEnableVertexAttribArray(3));
+        GLCall(glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (const void*)offsetof(InstanceData, r)));
+        GLCall(glVertexAttribDivisor(3, 1));
+
+        /* loop path: only position, attributes 1 .. 3 are disabled and take the glVertexAttrib* value */
+        GLCall(glGenVertexArrays(1, &m_LoopVertexArray));
+        GLCall(glBindVertexArray(m_LoopVertexArray));
+        GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IndexBuffer));
+        GLCall(glBindBuffer(GL_ARRAY_BUFFER, m_VertexBuffer));
+        GLCall(glEnableVertexAttribArray(0));
+        GLCall(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), nullptr));
+
+        GLCall(glBindVertexArray(0));
+    }
+
+    ~IndirectRenderer() {
+        glDeleteBuffers(1, &m_VertexBuffer);
+        glDeleteBuffers(1, &m_IndexBuffer);
+        glDeleteBuffers(1, &m_InstanceBuffer);
+        glDeleteBuffers(1, &m_IndirectBuffer);
+        glDeleteVertexArrays(1, &m_IndirectVertexArray);
+        glDeleteVertexArrays(1, &m_LoopVertexArray);
+    }
+
+    IndirectRenderer(const IndirectRenderer&) = delete;
+    IndirectRenderer& operator=(const IndirectRenderer&) = delete;
+
+    bool IsIndirectSupported() const { return m_IndirectSupported; }
+
+    /* whole list with one call */
+    void DrawIndirect(const std::vector<DrawElementsIndirectCommand>& commands, const std::vector<InstanceData>& instances) const {
+        ASSERT(m_IndirectSupported);
+        if (commands.empty())
+            return;
+
+        /* orphan + fill, last frame's data can still be in use by the GPU (HW_13) */
+        GLCall(glBindBuffer(GL_ARRAY_BUFFER, m_InstanceBuffer));
+        GLCall(glBufferData(GL_ARRAY_BUFFER, instances.size() * sizeof(InstanceData), nullptr, GL_STREAM_DRAW));
+        GLCall(glBufferSubData(GL_ARRAY_BUFFER, 0, instances.size() * sizeof(InstanceData), instances.data()));
+
+        GLCall(glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_IndirectBuffer));
+        GLCall(glBufferData(GL_DRAW_INDIRECT_BUFFER, commands.size() * sizeof(DrawElementsIndirectCommand), nullptr, GL_STREAM_DRAW));
+        GLCall(glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, commands.size() * sizeof(DrawElementsIndirectCommand), commands.data()));
+
+        GLCall(glBindVertexArray(m_IndirectVertexArray));
+        GLCall(glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, (GLsizei)commands.size(), 0));
+    }
+
+    /* same list, one draw call per command (works on every GL 3.3) */
+    void DrawLoop(const std::vector<DrawElementsIndirectCommand>& commands, const std::vector<InstanceData>& instances) const {
+        GLCall(glBindVertexArray(m_LoopVertexArray));
+        for (const DrawElementsIndirectCommand& command : commands) {
+            const InstanceData& instance = instances[command.baseInstance];
+            GLCall(glVertexAttrib2f(1, instance.offsetX, instance.offsetY));
+            GLCall(glVertexAttrib1f(2, instance.scale));
+            GLCall(glVertexAttrib4f(3, instance.r, instance.g, instance.b, instance.a));
+            GLCall(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)command.count, GL_UNSIGNED_INT,
+                                            (const void*)((size_t)command.firstIndex * sizeof(unsigned int)), command.baseVertex));
+        }
+    }
+
+    void Draw(const std::vector<DrawElementsIndirectCommand>& commands, const std::vector<InstanceData>& instances, bool indirect) const {
+        if (indirect)
+            DrawIndirect(commands, instances);
+        else
+            DrawLoop(commands, instances);
+    }
+
+private:
+    bool m_IndirectSupported = false;
+    unsigned int m_VertexBuffer = 0, m_IndexBuffer = 0, m_InstanceBuffer = 0, m_IndirectBuffer = 0;
+    unsigned int m_IndirectVertexArray = 0, m_LoopVertexArray = 0;
+};
+
+
+
+int main(int argc, char** argv)
+{
+    /* GLFW BASIC STUFF */
+        GLFWwindow* window;
+
+        /* Initialize the GLFW library */
+        if (!glfwInit())
+            return -1;
+
+
+        /* 4.3 core for glMultiDrawElementsIndirect, 3.3 core if the driver has no 4.3 (loop path, or the ARB extensions) */
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);    /* most drivers only send debug messages in debug context */
+#endif
+
+
+        /* Create a windowed mode window and its OpenGL context */
+        window = glfwCreateWindow(640, 480, "Hello World", NULL, NULL);
+        if (!window) {
+            glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+            glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+            window = glfwCreateWindow(640, 480, "Hello World", NULL, NULL);
+        }
+        if (!window)
+        {
+            glfwTerminate();
+            return -1;
+
+        }
+        /* Make the window's context current */
+        glfwMakeContextCurrent(window);
+
+        glfwSwapInterval(1);    /* controls FPS or intervel between buffer(frames) */
+
+    /*  END BASIC GLFW   */
+
+
+    /* Intitialize GLEW */
+        if (glewInit() != GLEW_OK) {
+            std::cout << "Error!" << std::endl;
+        }
+    /* END */
+
+    std::cout << glGetString(GL_VERSION) << std::endl;  /* prints the version of opengl using */
+
+    SetupGLErrorPolicy();
+
+
+    { /* scope so that the renderer deletes its buffers before glfwTerminate destroys the context */
+
+    /* ------------- Generating Data to be used to display in the window ------------- */
+
+        std::vector<float> positions;
+        std::vector<unsigned int> indices;
+        std::vector<MeshRange> meshes = MakePolygonMeshes(62, positions, indices);     /* 3 .. 64 sides */
+
+        std::mt19937 random(42);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+        const unsigned int objectCount = 20000;
+        std::vector<SceneObject> objects(objectCount);
+        for (SceneObject& object : objects) {
+            object.x = -1.3f + 2.6f * unit(random);
+            object.y = -1.3f + 2.6f * unit(random);
+            object.velocityX = -0.2f + 0.4f * unit(random);
+            object.velocityY = -0.2f + 0.4f * unit(random);
+            object.scale = 0.004f + 0.01f * unit(random);
+            object.color[0] = 0.3f + 0.7f * unit(random);
+            object.color[1] = 0.3f + 0.7f * unit(random);
+            object.color[2] = 0.3f + 0.7f * unit(random);
+            object.color[3] = 1.0f;
+            object.mesh = (unsigned int)(unit(random) * meshes.size()) % meshes.size();
+        }
+
+        IndirectRenderer renderer(positions, indices);
+
+        bool forceLoop = argc > 1 && std::string(argv[1]) == "--loop";
+        bool indirect = renderer.IsIndirectSupported() && !forceLoop;
+        std::cout << "[MultiDraw] " << objectCount << " objects, " << meshes.size() << " meshes in one VBO + IBO, "
+                  << (renderer.IsIndirectSupported() ? "glMultiDrawElementsIndirect supported" : "no multi draw indirect / base instance")
+                  << ", drawing with " << (indirect ? "indirect path" : "glDrawElementsBaseVertex loop") << std::endl;
+
+        std::vector<DrawElementsIndirectCommand> commands;
+        std::vector<InstanceData> instances;
+        commands.reserve(objectCount);
+        instances.reserve(objectCount);
+
+
+        ShaderProgramSource shaderSource = ParseShader("res/shaders/Basic - INSTANCED.shader");
+        unsigned int shader = CreateShader(shaderSource.VertexSource, shaderSource.FragmentSource);
+        GLCall(glUseProgram(shader));
+
+
+    /* ------------- BENCHMARK (draw loop vs multi draw indirect) ------------- */
+
+        glfwSwapInterval(0);
+
+        const int benchFrames = 100;
+
+        /* cpuMs = cull + build + submit (no wait), frameMs = with glFinish */
+        auto timeFrames = [&](bool useIndirect, double& cpuMs, double& frameMs) {
+            BuildDrawList(objects, meshes, commands, instances);
+            renderer.Draw(commands, instances, useIndirect);
+            glFinish();
+
+            double cpu = 0.0;
+            auto begin = std::chrono::high_resolution_clock::now();
+            for (int frame = 0; frame < benchFrames; frame++) {
+                glClear(GL_COLOR_BUFFER_BIT);
+                auto submitStart = std::chrono::high_resolution_clock::now();
+                BuildDrawList(objects, meshes, commands, instances);
+                renderer.Draw(commands, instances, useIndirect);
+                cpu += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - submitStart).count();
+                glFinish();
+            }
+            frameMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - begin).count() / benchFrames;
+            cpuMs = cpu / benchFrames;
+        };
+
+        double loopCpuMs, loopFrameMs;
+        timeFrames(false, loopCpuMs, loopFrameMs);
+        std::cout << "[Benchmark] " << commands.size() << " visible, glDrawElementsBaseVertex loop: " << commands.size() << " draw calls, "
+                  << loopCpuMs << " ms CPU, " << loopFrameMs << " ms/frame" << std::endl;
+
+        if (renderer.IsIndirectSupported()) {
+            double indirectCpuMs, indirectFrameMs;
+            timeFrames(true, indirectCpuMs, indirectFrameMs);
+            std::cout << "[Benchmark] " << commands.size() << " visible, glMultiDrawElementsIndirect: 1 draw call, "
+                      << indirectCpuMs << " ms CPU, " << indirectFrameMs << " ms/frame" << std::endl;
+        }
+        else {
+            std::cout << "[Benchmark] multi draw indirect not supported, only the loop path was timed" << std::endl;
+        }
+
+        glfwSwapInterval(1);
+
+
+    /* ------------- END OF GENERATING DATA ------------- */
+
+
+        double lastTime = glfwGetTime();
+
+    /* WHILE Loop to keep the window active till window is closed */
+    while (!glfwWindowShouldClose(window))
+    {
+        /* Render here */
+
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        double now = glfwGetTime();
+        MoveObjects(objects, (float)(now - lastTime));
+        lastTime = now;
+
+        GLCall(glUseProgram(shader));
+        BuildDrawList(objects, meshes, commands, instances);
+        renderer.Draw(commands, instances, indirect);
+
+
+        /* Swap front and back buffers */
+        glfwSwapBuffers(window);
+
+        /* Poll for and process events */
+        glfwPollEvents();
+    }
+
+    glDeleteProgram(shader);
+
+    }
+
+    glfwTerminate();
+    return 0;
+}
+
+
+
+
+/* Makes and compile the shader by inputing the type and Source code */
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source) {
+
+    unsigned int id = glCreateShader(shaderType);   /* generate Shader and return id */
+    const char* src = source.c_str();               /* convert inputed string to char* */
+    GLCall(glShaderSource(id, 1, &src, nullptr));           /* attaching source code to the shader */
+    GLCall(glCompileShader(id));                            /* compile shader */
+
+    /* -------- ERROR HANDLING -------- */
+        int result;
+        GLCall(glGetShaderiv(id, GL_COMPILE_STATUS, &result));
+        if (result == GL_FALSE) {
+            int length;
+            GLCall(glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length));
+            std::vector<char> message(length + 1);      /* char Array of length 'length' (_malloca is only in MSVC) */
+            GLCall(glGetShaderInfoLog(id, length, &length, message.data()));
+
+            std::cout << "Failed To Compile " << (shaderType == GL_VERTEX_SHADER ? "vertex" : "fragment") << " shader" << std::endl;
+
+            std::cout << message.data() << std::endl;
+            GLCall(glDeleteShader(id));
+            return 0;
+        }
+
+    /* -------- END ERROR HANDLING -------- */
+
+    return id;
+
+}
+
+
+/* Creates a program Which contain vertex and fragment shader */
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader) {
+
+    GLCall(unsigned int program = glCreateProgram());                           /* generate program to store all shader and program to be run by GPU during while loop */
+    unsigned int vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
+    unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+
+    GLCall(glAttachShader(program, vs));                                        /* Attach shader to program to be run by GPU */
+    GLCall(glAttachShader(program, fs));
+    GLCall(glLinkProgram(program));
+    GLCall(glValidateProgram(program));
+    GLCall(glDeleteShader(vs));                                                 /* DELETING shader to save space as shader is already attached to program */
+    GLCall(glDeleteShader(fs));
+
+    return program;
+
+}
+
+
+/* Read file and output vertex and fragment shader source code */
+static ShaderProgramSource ParseShader(const std::string& filepath) {
+
+    std::ifstream stream(filepath);
+
+    enum class ShaderType {
+        NONE = -1, VERTEX = 0, FRAGMENT = 1
+    };
+
+    std::string line;
+    std::stringstream ss[2];
+    ShaderType type = ShaderType::NONE;
+    while (getline(stream, line)) {
+
+        if (line.find("#shader") != std::string::npos) {
+
+            if (line.find("vertex") != std::string::npos)
+                type = ShaderType::VERTEX;
+            else if (line.find("fragment") != std::string::npos)
+                type = ShaderType::FRAGMENT;
+
+        }
+        else {
+            ss[int(type)] << line << '\n';
+        }
+    }
+
+    return { ss[0].str(), ss[1].str() };
+}
@@ -0,0 +1,939 @@
+/*
+
+Frustum Culling (SIMD, structure of arrays, multithreaded)
+
+until now every object is always drawn, also the ones behind the camera or far away,
+the GPU transforms all their vertices just to clip them
+
+here 1M boxes are in a 3D scene and only the ones in the camera frustum go to the draw call
+
+---> bounds are kept as structure of arrays (SoA): centerX[], centerY[], centerZ[], extentX[] ... radius[]
+     so 8 objects are 8 floats next to each other in every array -> one load per array for 8 objects
+     (array of structs would need a gather / shuffle to get the x of 8 objects into one register)
+---> frustum = 6 planes taken from the view projection matrix (Gribb / Hartmann), a x + b y + c z + d >= 0 is inside
+     sphere: outside a plane when  dist(center) < -radius
+     AABB:   outside a plane when  dist(center) + |a| ex + |b| ey + |c| ez < 0   (corner nearest to inside)
+     visible = inside or touching all 6 planes (some objects near the corners of the frustum stay, that is fine)
+---> AVX2: 8 objects per loop, 6 planes without branches, movemask gives 8 bits,
+     a 256 entry table turns the bits into the packed lane numbers -> one store writes the visible indices
+     SSE2: 4 objects per loop, bits -> indices with a bit scan,   scalar: one object, branchless
+     the best one is chosen at runtime (cpuid / __builtin_cpu_supports), so the same exe runs on old CPUs
+---> output is a compact visible index list (increasing order), the render loop copies only those objects
+     to the instance buffer and draws them with one glDrawElementsInstanced
+---> multithreaded: the arrays are split in one range per thread (multiple of 8), every thread writes its
+     indices to its own part of the list, then the parts are moved together
+
+at start sphere and AABB culling of 1M objects is timed for every SIMD level the CPU has,
+on one thread and on all threads (results are checked against the scalar one)
+
+*/
+
+
+
+
+#include <GL\glew.h>
+
+#include <GLFW/glfw3.h>
+
+
+#include <iostream>
+#include <fstream>  // to read file
+#include <string>   // To use getline func
+#include <sstream>
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <cstddef>  // offsetof
+#include <cstdint>
+#include <cstring>  // memmove
+#include <math.h>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define CULL_X86 1
+    #include <immintrin.h>  // SSE2 / AVX2 intrinsics
+    #if defined(_MSC_VER)
+        #include <intrin.h>     // __cpuid / _BitScanForward
+    #endif
+#else
+    #define CULL_X86 0          /* other CPUs -> scalar only */
+#endif
+
+/* gcc / clang only allow AVX2 intrinsics in functions marked for it (the rest of the file stays plain x86) */
+#if CULL_X86 && (defined(__GNUC__) || defined(__clang__))
+    #define TARGET_SSE2 __attribute__((target("sse2")))
+    #define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+    #define TARGET_SSE2
+    #define TARGET_AVX2
+#endif
+
+
+
+/* ------------ ERROR CHECK POLICY ------------ */
+/*
+GL_CHECK_NONE   -> GLCall(x) is just x, nothing is checked (release)
+GL_CHECK_ASYNC  -> GLCall(x) is just x, driver reports errors later through glDebugMessageCallback (needs KHR_debug / GL 4.3)
+GL_CHECK_STRICT -> glGetError before and after every call, stops on the line with the error (old GLCall)
+
+default is NONE for release (NDEBUG) and STRICT for debug, or pass -DGL_CHECK_POLICY=1 to compiler to choose
+*/
+#define GL_CHECK_NONE   0
+#define GL_CHECK_ASYNC  1
+#define GL_CHECK_STRICT 2
+
+#ifndef GL_CHECK_POLICY
+    #ifdef NDEBUG
+        #define GL_CHECK_POLICY GL_CHECK_NONE
+    #else
+        #define GL_CHECK_POLICY GL_CHECK_STRICT
+    #endif
+#endif
+
+
+/* ------------ MACRO ------------ */
+
+/* __debugbreak is only in MSVC, on gcc / clang SIGTRAP does same thing (debugger stops there) */
+#if defined(_MSC_VER)
+    #define DEBUG_BREAK() __debugbreak()
+#elif defined(__GNUC__) || defined(__clang__)
+    #include <signal.h>
+    #define DEBUG_BREAK() raise(SIGTRAP)
+#else
+    #include <cstdlib>
+    #define DEBUG_BREAK() std::abort()
+#endif
+
+#define ASSERT(x) if (!(x)) DEBUG_BREAK();
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+    #define GLCall(x) GLCLearError();\
+        x;\
+        ASSERT(GlLogCall(#x, __FILE__, __LINE__))
+#else
+    #define GLCall(x) x
+#endif
+
+/*
+# before a fucntion pass it as a stringand __FILE__and __LINE__ are macros to get file loc and line of fucntion
+and since MACROS HAS TO BE IN SAME LINE we use \ before line ends to write macros in multiple lines
+*/
+
+
+#if GL_CHECK_POLICY == GL_CHECK_STRICT
+static void GLCLearError() {
+    while (glGetError() != GL_NO_ERROR);    // glGetError get error and we get all the error until there are no arror left
+}
+
+static bool GlLogCall(const char* function, const char* file, int line) {
+    bool ok = true;
+    while (GLenum error = glGetError()) {
+        std::cout << "[OpenGl Error] (" << error << "): " << function << " " << file << ":" << line << std::endl;
+        ok = false;
+    }
+    return ok;
+}
+#endif
+
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+/* called by the driver (maybe from its own thread) when something is wrong */
+static void APIENTRY GlDebugCallback(GLenum /*source*/, GLenum type, GLuint id, GLenum severity, GLsizei /*length*/, const GLchar* message, const void* /*userParam*/) {
+
+    const char* level = severity == GL_DEBUG_SEVERITY_HIGH ? "HIGH" : severity == GL_DEBUG_SEVERITY_MEDIUM ? "MEDIUM" : "LOW";
+    std::cout << "[OpenGl Debug] (" << level << (type == GL_DEBUG_TYPE_ERROR ? ", error" : "") << ", id " << id << "): " << message << std::endl;
+}
+#endif
+
+/* call once after glewInit, sets up whatever the chosen policy needs */
+static void SetupGLErrorPolicy() {
+
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+    if (GLEW_VERSION_4_3 || GLEW_KHR_debug) {
+        glEnable(GL_DEBUG_OUTPUT);
+        glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);     /* driver does not have to report inside the call, so no slow down */
+        glDebugMessageCallback(GlDebugCallback, nullptr);
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);  /* skip info messages */
+        std::cout << "GL errors: async (debug callback)" << std::endl;
+    }
+    else {
+        std::cout << "GL errors: async asked but KHR_debug is not there, errors are not checked" << std::endl;
+    }
+#elif GL_CHECK_POLICY == GL_CHECK_STRICT
+    std::cout << "GL errors: strict (glGetError after every call)" << std::endl;
+#else
+    std::cout << "GL errors: off" << std::endl;
+#endif
+}
+
+
+
+struct ShaderProgramSource {
+    std::string VertexSource;
+    std::string FragmentSource;
+};
+
+static ShaderProgramSource ParseShader(const std::string& filepath);
+
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader);
+
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source);
+
+
+
+/* ------------- WORKER POOL ------------- */
+
+/* threads stay alive and wait, Run(job) calls job(0..count-1) on all of them and returns when all are done */
+class WorkerPool {
+public:
+    WorkerPool(unsigned int count) {
+        for (unsigned int i = 0; i < count; i++)
+            m_Threads.emplace_back([this, i]() { WorkerLoop(i); });
+    }
+
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Quit = true;
+        }
+        m_Start.notify_all();
+        for (std::thread& t : m_Threads)
+            t.join();
+    }
+
+    void Run(const std::function<void(unsigned int)>& job) {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Job = job;
+        m_Pending = (unsigned int)m_Threads.size();
+        m_Generation++;
+        m_Start.notify_all();
+        m_Done.wait(lock, [this]() { return m_Pending == 0; });
+    }
+
+    unsigned int GetCount() const { return (unsigned int)m_Threads.size(); }
+
+private:
+    void WorkerLoop(unsigned int index) {
+        unsigned long long seen = 0;
+        while (true) {
+            std::function<void(unsigned int)> job;
+            {
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                m_Start.wait(lock, [&]() { return m_Quit || m_Generation != seen; });
+                if (m_Quit)
+                    return;
+                seen = m_Generation;
+                job = m_Job;
+            }
+
+            job(index);
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (--m_Pending == 0)
+                m_Done.notify_one();
+        }
+    }
+
+    std::vector<std::thread> m_Threads;
+    std::mutex m_Mutex;
+    std::condition_variable m_Start, m_Done;
+    std::function<void(unsigned int)> m_Job;
+    unsigned long long m_Generation = 0;
+    unsigned int m_Pending = 0;
+    bool m_Quit = false;
+};
+
+
+
+/* ------------- MATH ------------- */
+
+/* column major like OpenGL, m[column * 4 + row] */
+struct Mat4 {
+    float m[16];
+};
+
+static Mat4 Multiply(const Mat4& a, const Mat4& b) {
+    Mat4 r;
+    for (int column = 0; column < 4; column++)
+        for (int row = 0; row < 4; row++) {
+            float sum = 0.0f;
+            for (int k = 0; k < 4; k++)
+                sum += a.m[k * 4 + row] * b.m[column * 4 + k];
+            r.m[column * 4 + row] = sum;
+        }
+    return r;
+}
+
+static Mat4 Perspective(float fovY, float aspect, float nearZ, float farZ) {
+    float f = 1.0f / tanf(fovY * 0.5f);
+    Mat4 r = {};
+    r.m[0] = f / aspect;
+    r.m[5] = f;
+    r.m[10] = (farZ + nearZ) / (nearZ - farZ);
+    r.m[11] = -1.0f;
+    r.m[14] = 2.0f * farZ * nearZ / (nearZ - farZ);
+    return r;
+}
+
+static Mat4 LookAt(const float eye[3], const float target[3], const float up[3]) {
+    float f[3] = { target[0] - eye[0], target[1] - eye[1], target[2] - eye[2] };
+    float length = sqrtf(f[0] * f[0] + f[1] * f[1] + f[2] * f[2]);
+    for (float& v : f)
+        v /= length;
+    float s[3] = { f[1] * up[2] - f[2] * up[1], f[2] * up[0] - f[0] * up[2], f[0] * up[1] - f[1] * up[0] };
+    length = sqrtf(s[0] * s[0] + s[1] * s[1] + s[2] * s[2]);
+    for (float& v : s)
+        v /= length;
+    float u[3] = { s[1] * f[2] - s[2] * f[1], s[2] * f[0] - s[0] * f[2], s[0] * f[1] - s[1] * f[0] };
+
+    Mat4 r = {};
+    r.m[0] = s[0];  r.m[4] = s[1];  r.m[8] = s[2];
+    r.m[1] = u[0];  r.m[5] = u[1];  r.m[9] = u[2];
+    r.m[2] = -f[0]; r.m[6] = -f[1]; r.m[10] = -f[2];
+    r.m[12] = -(s[0] * eye[0] + s[1] * eye[1] + s[2] * eye[2]);
+    r.m[13] = -(u[0] * eye[0] + u[1] * eye[1] + u[2] * eye[2]);
+    r.m[14] = f[0] * eye[0] + f[1] * eye[1] + f[2] * eye[2];
+    r.m[15] = 1.0f;
+    return r;
+}
+
+
+
+/* ------------- BOUNDS + FRUSTUM ------------- */
+
+/* structure of arrays, index i is object i in every array */
+struct BoundsSoA {
+    std::vector<float> centerX, centerY, centerZ;
+    std::vector<float> extentX, extentY, extentZ;   /* AABB half size */
+    std::vector<float> radius;                      /* sphere around the AABB */
+
+    void Reserve(size_t count) {
+        for (std::vector<float>* array : { &centerX, &centerY, &centerZ, &extentX, &extentY, &extentZ, &radius })
+            array->reserve(count);
+    }
+
+    void Add(float x, float y, float z, float ex, float ey, float ez) {
+        centerX.push_back(x);
+        centerY.push_back(y);
+        centerZ.push_back(z);
+        extentX.push_back(ex);
+        extentY.push_back(ey);
+        extentZ.push_back(ez);
+        radius.push_back(sqrtf(ex * ex + ey * ey + ez * ez));
+    }
+
+    size_t Size() const { return centerX.size(); }
+};
+
+/* plane i: a[i] x + b[i] y + c[i] z + d[i] >= 0 is inside, (a, b, c) has length 1 so the value is a distance */
+struct Frustum {
+    float a[6], b[6], c[6], d[6];
+};
+
+/* planes from the rows of view projection: left, right, bottom, top, near, far */
+static Frustum ExtractFrustum(const Mat4& viewProjection) {
+    auto row = [&](int r, int column) { return viewProjection.m[column * 4 + r]; };
+
+    Frustum frustum;
+    for (int plane = 0; plane < 6; plane++) {
+        int r = plane / 2;
+        float sign = plane % 2 == 0 ? 1.0f : -1.0f;
+        float p[4];
+        for (int column = 0; column < 4; column++)
+            p[column] = row(3, column) + sign * row(r, column);
+
+        float length = sqrtf(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+        frustum.a[plane] = p[0] / length;
+        frustum.b[plane] = p[1] / length;
+        frustum.c[plane] = p[2] / length;
+        frustum.d[plane] = p[3] / length;
+    }
+    return frustum;
+}
+
+
+
+/* ------------- CULLING ------------- */
+
+enum class SimdLevel { Scalar, SSE2, AVX2 };
+
+enum class CullVolume { Sphere, Aabb };
+
+static const char* SimdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX2: return "AVX2";
+        case SimdLevel::SSE2: return "SSE2";
+        default:              return "scalar";
+    }
+}
+
+/* best level this CPU (and OS, for the AVX registers) can run */
+static SimdLevel DetectSimdLevel() {
+#if CULL_X86
+    #if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7)
+            return SimdLevel::SSE2;
+        __cpuid(info, 1);
+        bool avx = (info[2] & (1 << 28)) != 0, osxsave = (info[2] & (1 << 27)) != 0;
+        if (!avx || !osxsave || (_xgetbv(0) & 6) != 6)     /* OS saves the YMM registers */
+            return SimdLevel::SSE2;
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) ? SimdLevel::AVX2 : SimdLevel::SSE2;
+    #else
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+            return SimdLevel::AVX2;
+        return __builtin_cpu_supports("sse2") ? SimdLevel::SSE2 : SimdLevel::Scalar;
+    #endif
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+/* objects in [begin, end) -> indices of the visible ones written to out[0..], returns how many,
+   may write past the returned count (up to end - begin), never past that */
+typedef size_t (*CullRangeFunction)(const BoundsSoA& bounds, size_t begin, size_t end, const Frustum& frustum, uint32_t* out);
+
+template <bool Aabb>
+static size_t CullRangeScalar(const BoundsSoA& bounds, size_t begin, size_t end, const Frustum& frustum, uint32_t* out) {
+    const float* x = bounds.centerX.data(), * y = bounds.centerY.data(), * z = bounds.centerZ.data();
+    const float* ex = bounds.extentX.data(), * ey = bounds.extentY.data(), * ez = bounds.extentZ.data(), * r = bounds.radius.data();
+
+    size_t count = 0;
+    for (size_t i = begin; i < end; i++) {
+        bool inside = true;
+        for (int p = 0; p < 6; p++) {
+            float dist = frustum.a[p] * x[i] + frustum.b[p] * y[i] + frustum.c[p] * z[i] + frustum.d[p];
+            float reach = Aabb ? fabsf(frustum.a[p]) * ex[i] + fabsf(frustum.b[p]) * ey[i] + fabsf(frustum.c[p]) * ez[i] : r[i];
+            inside &= dist + reach >= 0.0f;
+        }
+        /* no branch: always written, only counted when visible */
+        out[count] = (uint32_t)i;
+        count += inside;
+    }
+    return count;
+}
+
+#if CULL_X86
+
+static inline int LowestBit(uint32_t value) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, value);
+    return (int)index;
+#else
+    return __builtin_ctz(value);
+#endif
+}
+
+template <bool Aabb>
+TARGET_SSE2 static size_t CullRangeSse2(const BoundsSoA& bounds, size_t begin, size_t end, const Frustum& frustum, uint32_t* out) {
+    const float* x = bounds.centerX.data(), * y = bounds.centerY.data(), * z = bounds.centerZ.data();
+    const float* ex = bounds.extentX.data(), * ey = bounds.extentY.data(), * ez = bounds.extentZ.data(), * r = bounds.radius.data();
+
+    __m128 a[6], b[6], c[6], d[6], absA[6], absB[6], absC[6];
+    for (int p = 0; p < 6; p++) {
+        a[p] = _mm_set1_ps(frustum.a[p]);
+        b[p] = _mm_set1_ps(frustum.b[p]);
+        c[p] = _mm_set1_ps(frustum.c[p]);
+        d[p] = _mm_set1_ps(frustum.d[p]);
+        absA[p] = _mm_set1_ps(fabsf(frustum.a[p]));
+        absB[p] = _mm_set1_ps(fabsf(frustum.b[p]));
+        absC[p] = _mm_set1_ps(fabsf(frustum.c[p]));
+    }
+    const __m128 zero = _mm_setzero_ps();
+
+    size_t count = 0, i = begin;
+    for (; i + 4 <= end; i += 4) {
+        __m128 px = _mm_loadu_ps(x + i), py = _mm_loadu_ps(y + i), pz = _mm_loadu_ps(z + i);
+        __m128 sx, sy, sz, radius;
+        if (Aabb) {
+            sx = _mm_loadu_ps(ex + i);
+            sy = _mm_loadu_ps(ey + i);
+            sz = _mm_loadu_ps(ez + i);
+        }
+        else {
+            radius = _mm_loadu_ps(r + i);
+        }
+
+        __m128 inside = _mm_cmpeq_ps(zero, zero);      /* all bits set */
+        for (int p = 0; p < 6; p++) {
+            __m128 dist = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(a[p], px), _mm_mul_ps(b[p], py)), _mm_mul_ps(c[p], pz)), d[p]);
+            __m128 reach = Aabb ? _mm_add_ps(_mm_add_ps(_mm_mul_ps(absA[p], sx), _mm_mul_ps(absB[p], sy)), _mm_mul_ps(absC[p], sz)) : radius;
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(dist, reach), zero));
+        }
+
+        int mask = _mm_movemask_ps(inside);
+        while (mask) {
+            out[count++] = (uint32_t)(i + LowestBit(mask));
+            mask &= mask - 1;
+        }
+    }
+    return count + CullRangeScalar<Aabb>(bounds, i, end, frustum, out + count);
+}
+
+/* for every 8 bit mask: the numbers of the set lanes packed to the front, and how many there are */
+struct CompactTable {
+    alignas(32) uint32_t lanes[256][8];
+    uint8_t counts[256];
+
+    CompactTable() {
+        for (int mask = 0; mask < 256; mask++) {
+            int n = 0;
+            for (int lane = 0; lane < 8; lane++)
+                if (mask & (1 << lane))
+                    lanes[mask][n++] = (uint32_t)lane;
+            for (int lane = n; lane < 8; lane++)
+                lanes[mask][lane] = 0;
+            counts[mask] = (uint8_t)n;
+        }
+    }
+};
+
+static const CompactTable& GetCompactTable() {
+    static const CompactTable table;
+    return table;
+}
+
+template <bool Aabb>
+TARGET_AVX2 static size_t CullRangeAvx2(const BoundsSoA& bounds, size_t begin, size_t end, const Frustum& frustum, uint32_t* out) {
+    const float* x = bounds.centerX.data(), * y = bounds.centerY.data(), * z = bounds.centerZ.data();
+    const float* ex = bounds.extentX.data(), * ey = bounds.extentY.data(), * ez = bounds.extentZ.data(), * r = bounds.radius.data();
+    const CompactTable& table = GetCompactTable();
+
+    __m256 a[6], b[6], c[6], d[6], absA[6], absB[6], absC[6];
+    for (int p = 0; p < 6; p++) {
+        a[p] = _mm256_set1_ps(frustum.a[p]);
+        b[p] = _mm256_set1_ps(frustum.b[p]);
+        c[p] = _mm256_set1_ps(frustum.c[p]);
+        d[p] = _mm256_set1_ps(frustum.d[p]);
+        absA[p] = _mm256_set1_ps(fabsf(frustum.a[p]));
+        absB[p] = _mm256_set1_ps(fabsf(frustum.b[p]));
+        absC[p] = _mm256_set1_ps(fabsf(frustum.c[p]));
+    }
+    const __m256 zero = _mm256_setzero_ps();
+
+    size_t count = 0, i = begin;
+    for (; i + 8 <= end; i += 8) {
+        __m256 px = _mm256_loadu_ps(x + i), py = _mm256_loadu_ps(y + i), pz = _mm256_loadu_ps(z + i);
+        __m256 sx, sy, sz, radius;
+        if (Aabb) {
+            sx = _mm256_loadu_ps(ex + i);
+            sy = _mm256_loadu_ps(ey + i);
+            sz = _mm256_loadu_ps(ez + i);
+        }
+        else {
+            radius = _mm256_loadu_ps(r + i);
+        }
+
+        __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (int p = 0; p < 6; p++) {
+            /* same order of operations as the scalar code (no FMA), so all levels give the same list */
+            __m256 dist = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a[p], px), _mm256_mul_ps(b[p], py)), _mm256_mul_ps(c[p], pz)), d[p]);
+            __m256 reach = Aabb ? _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(absA[p], sx), _mm256_mul_ps(absB[p], sy)), _mm256_mul_ps(absC[p], sz)) : radius;
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(_mm256_add_ps(dist, reach), zero, _CMP_GE_OQ));
+        }
+
+        /* 8 bits -> packed lane numbers + i, all 8 stored, only the visible ones counted */
+        int mask = _mm256_movemask_ps(inside);
+        __m256i lanes = _mm256_load_si256((const __m256i*)table.lanes[mask]);
+        _mm256_storeu_si256((__m256i*)(out + count), _mm256_add_epi32(lanes, _mm256_set1_epi32((int)i)));
+        count += table.counts[mask];
+    }
+    return count + CullRangeScalar<Aabb>(bounds, i, end, frustum, out + count);
+}
+
+#endif
+
+static CullRangeFunction GetCullFunction(SimdLevel level, CullVolume volume) {
+    bool aabb = volume == CullVolume::Aabb;
+#if CULL_X86
+    if (level == SimdLevel::AVX2)
+        return aabb ? CullRangeAvx2<true> : CullRangeAvx2<false>;
+    if (level == SimdLevel::SSE2)
+        return aabb ? CullRangeSse2<true> : CullRangeSse2<false>;
+#endif
+    return aabb ? CullRangeScalar<true> : CullRangeScalar<false>;
+}
+
+/* keeps the visible list between frames (no allocation after the first), pool = nullptr -> on the calling thread */
+class FrustumCuller {
+public:
+    explicit FrustumCuller(SimdLevel level) : m_Level(level) {}
+
+    void SetLevel(SimdLevel level) { m_Level = level; }
+    SimdLevel GetLevel() const { return m_Level; }
+
+    /* fills the visible list, returns its size */
+    size_t Cull(const BoundsSoA& bounds, const Frustum& frustum, CullVolume volume, WorkerPool* pool = nullptr) {
+        CullRangeFunction cull = GetCullFunction(m_Level, volume);
+        size_t objectCount = bounds.Size();
+        if (m_Visible.size() < objectCount)
+            m_Visible.resize(objectCount);
+        uint32_t* visible = m_Visible.data();
+
+        /* small scenes are not worth waking the threads */
+        if (!pool || pool->GetCount() < 2 || objectCount < 65536) {
+            m_Count = cull(bounds, 0, objectCount, frustum, visible);
+            return m_Count;
+        }
+
+        unsigned int threads = pool->GetCount();
+        size_t chunk = ((objectCount + threads - 1) / threads + 7) & ~(size_t)7;
+        m_ThreadCounts.assign(threads, 0);
+        pool->Run([&](unsigned int thread) {
+            size_t begin = std::min(objectCount, thread * chunk), end = std::min(objectCount, begin + chunk);
+            m_ThreadCounts[thread] = cull(bounds, begin, end, frustum, visible + begin);
+        });
+
+        /* every part to the end of the one before */
+        m_Count = m_ThreadCounts[0];
+        for (unsigned int thread = 1; thread < threads; thread++) {
+            size_t begin = std::min(objectCount, thread * chunk);
+            memmove(visible + m_Count, visible + begin, m_ThreadCounts[thread] * sizeof(uint32_t));
+            m_Count += m_ThreadCounts[thread];
+        }
+        return m_Count;
+    }
+
+    const uint32_t* GetVisible() const { return m_Visible.data(); }
+    size_t GetVisibleCount() const { return m_Count; }
+
+private:
+    SimdLevel m_Level;
+    std::vector<uint32_t> m_Visible;
+    std::vector<size_t> m_ThreadCounts;
+    size_t m_Count = 0;
+};
+
+
+
+/* ------------- SCENE ------------- */
+
+/* per instance data, same layout as "Basic - CULLED.shader" expects */
+struct InstanceData {
+    float x, y, z;
+    float scaleX, scaleY, scaleZ;
+    float r, g, b, a;
+};
+
+static void MakeScene(size_t count, float worldSize, std::vector<InstanceData>& instances, BoundsSoA& bounds) {
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    instances.clear();
+    instances.reserve(count);
+    bounds.Reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        InstanceData object;
+        object.x = (unit(random) - 0.5f) * worldSize;
+        object.y = (unit(random) - 0.5f) * worldSize;
+        object.z = (unit(random) - 0.5f) * worldSize;
+        object.scaleX = 0.2f + 0.6f * unit(random);
+        object.scaleY = 0.2f + 0.6f * unit(random);
+        object.scaleZ = 0.2f + 0.6f * unit(random);
+        object.r = 0.3f + 0.7f * unit(random);
+        object.g = 0.3f + 0.7f * unit(random);
+        object.b = 0.3f + 0.7f * unit(random);
+        object.a = 1.0f;
+        instances.push_back(object);
+        bounds.Add(object.x, object.y, object.z, object.scaleX, object.scaleY, object.scaleZ);
+    }
+}
+
+/* camera at the center turning around, 'time' in seconds */
+static Mat4 CameraViewProjection(float time, float aspect) {
+    float eye[3] = { 0.0f, 0.0f, 0.0f };
+    float target[3] = { cosf(time * 0.2f), 0.3f * sinf(time * 0.13f), sinf(time * 0.2f) };
+    float up[3] = { 0.0f, 1.0f, 0.0f };
+    return Multiply(Perspective(1.0472f, aspect, 0.1f, 60.0f), LookAt(eye, target, up));     /* 60 degrees, far at 60 */
+}
+
+
+
+int main(void)
+{
+    /* GLFW BASIC STUFF */
+        GLFWwindow* window;
+
+        /* Initialize the GLFW library */
+        if (!glfwInit())
+            return -1;
+
+
+        /* setting version 3.3 and core profile (i.e mordern opengl) */
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#if GL_CHECK_POLICY == GL_CHECK_ASYNC
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);    /* most drivers only send debug messages in debug context */
+#endif
+
+
+        /* Create a windowed mode window and its OpenGL context */
+        window = glfwCreateWindow(640, 480, "Hello World", NULL, NULL);
+        if (!window)
+        {
+            glfwTerminate();
+            return -1;
+
+        }
+        /* Make the window's context current */
+        glfwMakeContextCurrent(window);
+
+        glfwSwapInterval(1);    /* controls FPS or intervel between buffer(frames) */
+
+    /*  END BASIC GLFW   */
+
+
+    /* Intitialize GLEW */
+        if (glewInit() != GLEW_OK) {
+            std::cout << "Error!" << std::endl;
+        }
+    /* END */
+
+    std::cout << glGetString(GL_VERSION) << std::endl;  /* prints the version of opengl using */
+
+    SetupGLErrorPolicy();
+
+
+    { /* scope so that the buffers are deleted before glfwTerminate destroys the context */
+
+    /* ------------- Generating Data to be used to display in the window ------------- */
+
+        const size_t objectCount = 1000000;
+        std::vector<InstanceData> instances;
+        BoundsSoA bounds;
+        MakeScene(objectCount, 200.0f, instances, bounds);
+
+        WorkerPool pool(std::max(1u, std::thread::hardware_concurrency()));
+        SimdLevel bestLevel = DetectSimdLevel();
+        FrustumCuller culler(bestLevel);
+        Frustum frustum = ExtractFrustum(CameraViewProjection(0.0f, 640.0f / 480.0f));
+
+
+    /* ------------- BENCHMARK (scalar vs SSE2 vs AVX2, one thread vs all) ------------- */
+
+        std::cout << "[Culling] " << objectCount << " objects, CPU has " << SimdLevelName(bestLevel) << ", "
+                  << pool.GetCount() << " threads" << std::endl;
+
+        const int benchRuns = 50;
+
+        auto timeCull = [&](CullVolume volume, WorkerPool* threads) {
+            culler.Cull(bounds, frustum, volume, threads);
+            auto begin = std::chrono::high_resolution_clock::now();
+            for (int run = 0; run < benchRuns; run++)
+                culler.Cull(bounds, frustum, volume, threads);
+            return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - begin).count() / benchRuns;
+        };
+
+        for (CullVolume volume : { CullVolume::Sphere, CullVolume::Aabb }) {
+            std::vector<uint32_t> reference;
+            for (int level = 0; level <= (int)bestLevel; level++) {
+                culler.SetLevel((SimdLevel)level);
+                double singleMs = timeCull(volume, nullptr);
+                double threadedMs = timeCull(volume, &pool);
+
+                std::vector<uint32_t> result(culler.GetVisible(), culler.GetVisible() + culler.GetVisibleCount());
+                if (level == 0)
+                    reference = result;
+
+                std::cout << "  " << (volume == CullVolume::Sphere ? "sphere" : "AABB  ") << " " << SimdLevelName((SimdLevel)level)
+                          << ": " << singleMs << " ms (1 thread), " << threadedMs << " ms (" << pool.GetCount() << " threads), "
+                          << result.size() << " visible" << (result == reference ? "" : "  -> DIFFERENT FROM SCALAR") << std::endl;
+            }
+        }
+        culler.SetLevel(bestLevel);
+
+
+        /* unit cube, 8 corners, 12 triangles */
+        float cubePositions[] = {
+            -1.0f, -1.0f, -1.0f,    1.0f, -1.0f, -1.0f,    1.0f,  1.0f, -1.0f,   -1.0f,  1.0f, -1.0f,
+            -1.0f, -1.0f,  1.0f,    1.0f, -1.0f,  1.0f,    1.0f,  1.0f,  1.0f,   -1.0f,  1.0f,  1.0f,
+        };
+        unsigned int cubeIndices[] = {
+            0, 2, 1,  0, 3, 2,      /* back   */
+            4, 5, 6,  4, 6, 7,      /* front  */
+            0, 1, 5,  0, 5, 4,      /* bottom */
+            3, 6, 2,  3, 7, 6,      /* top    */
+            0, 4, 7,  0, 7, 3,      /* left   */
+            1, 2, 6,  1, 6, 5,      /* right  */
+        };
+
+        unsigned int vao, buffers[3];
+        GLCall(glGenVertexArrays(1, &vao));
+        GLCall(glBindVertexArray(vao));
+        GLCall(glGenBuffers(3, buffers));
+
+        GLCall(glBindBuffer(GL_ARRAY_BUFFER, buffers[0]));
+        GLCall(glBufferData(GL_ARRAY_BUFFER, sizeof(cubePositions), cubePositions, GL_STATIC_DRAW));
+        GLCall(glEnableVertexAttribArray(0));
+        GLCall(glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), nullptr));
+
+        GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]));
+        GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(cubeIndices), cubeIndices, GL_STATIC_DRAW));
+
+        /* instance buffer only ever holds the visible objects */
+        GLCall(glBindBuffer(GL_ARRAY_BUFFER, buffers[2]));
+        GLCall(glEnableVertexAttribArray(1));
+        GLCall(glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (const void*)offsetof(InstanceData, x)));
+        GLCall(glVertexAttribDivisor(1, 1));
+        GLCall(glEnableVertexAttribArray(2));
+        GLCall(glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (const void*)offsetof(InstanceData, scaleX)));
+        GLCall(glVertexAttribDivisor(2, 1));
+        GLCall(glEnableVertexAttribArray(3));
+        GLCall(glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (const void*)offsetof(InstanceData, r)));
+        GLCall(glVertexAttribDivisor(3, 1));
+        GLCall(glBindVertexArray(0));
+
+        std::vector<InstanceData> visibleInstances;
+        visibleInstances.reserve(objectCount);
+
+
+        ShaderProgramSource shaderSource = ParseShader("res/shaders/Basic - CULLED.shader");
+        unsigned int shader = CreateShader(shaderSource.VertexSource, shaderSource.FragmentSource);
+        GLCall(glUseProgram(shader));
+        GLCall(int viewProjectionLocation = glGetUniformLocation(shader, "u_ViewProjection"));
+
+        GLCall(glEnable(GL_DEPTH_TEST));
+        GLCall(glEnable(GL_CULL_FACE));
+
+
+    /* ------------- END OF GENERATING DATA ------------- */
+
+
+
+    /* WHILE Loop to keep the window active till window is closed */
+    while (!glfwWindowShouldClose(window))
+    {
+        /* Render here */
+
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+        int width, height;
+        glfwGetFramebufferSize(window, &width, &height);
+        GLCall(glViewport(0, 0, width, height));
+        Mat4 viewProjection = CameraViewProjection((float)glfwGetTime(), height > 0 ? (float)width / height : 1.0f);
+
+        /* cull -> copy the visible ones -> one instanced draw */
+        size_t visibleCount = culler.Cull(bounds, ExtractFrustum(viewProjection), CullVolume::Aabb, &pool);
+        const uint32_t* visible = culler.GetVisible();
+        visibleInstances.resize(visibleCount);
+        for (size_t i = 0; i < visibleCount; i++)
+            visibleInstances[i] = instances[visible[i]];
+
+        GLCall(glBindBuffer(GL_ARRAY_BUFFER, buffers[2]));
+        GLCall(glBufferData(GL_ARRAY_BUFFER, visibleCount * sizeof(InstanceData), nullptr, GL_STREAM_DRAW));   /* orphan (HW_13) */
+        GLCall(glBufferSubData(GL_ARRAY_BUFFER, 0, visibleCount * sizeof(InstanceData), visibleInstances.data()));
+
+        GLCall(glUseProgram(shader));
+        GLCall(glUniformMatrix4fv(viewProjectionLocation, 1, GL_FALSE, viewProjection.m));
+        GLCall(glBindVertexArray(vao));
+        GLCall(glDrawElementsInstanced(GL_TRIANGLES, 36, GL_UNSIGNED_INT, nullptr, (int)visibleCount));
+
+
+        /* Swap front and back buffers */
+        glfwSwapBuffers(window);
+
+        /* Poll for and process events */
+        glfwPollEvents();
+    }
+
+    glDeleteProgram(shader);
+    glDeleteBuffers(3, buffers);
+    glDeleteVertexArrays(1, &vao);
+
+    }
+
+    glfwTerminate();
+    return 0;
+}
+
+
+
+
+/* Makes and compile the shader by inputing the type and Source code */
+static unsigned int CompileShader(unsigned int shaderType, const std::string& source) {
+
+    unsigned int id = glCreateShader(shaderType);   /* generate Shader and return id */
+    const char* src = source.c_str();               /* convert inputed string to char* */
+    GLCall(glShaderSource(id, 1, &src, nullptr));           /* attaching source code to the shader */
+    GLCall(glCompileShader(id));                            /* compile shader */
+
+    /* -------- ERROR HANDLING -------- */
+        int result;
+        GLCall(glGetShaderiv(id, GL_COMPILE_STATUS, &result));
+        if (result == GL_FALSE) {
+            int length;
+            GLCall(glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length));
+            std::vector<char> message(length + 1);      /* char Array of length 'length' (_malloca is only in MSVC) */
+            GLCall(glGetShaderInfoLog(id, length, &length, message.data()));
+
+            std::cout << "Failed To Compile " << (shaderType == GL_VERTEX_SHADER ? "vertex" : "fragment") << " shader" << std::endl;
+
+            std::cout << message.data() << std::endl;
+            GLCall(glDeleteShader(id));
+            return 0;
+        }
+
+    /* -------- END ERROR HANDLING -------- */
+
+    return id;
+
+}
+
+
+/* Creates a program Which contain vertex and fragment shader */
+static int CreateShader(const std::string& vertexShader, const std::string& fragmentShader) {
+
+    GLCall(unsigned int program = glCreateProgram());                           /* generate program to store all shader and program to be run by GPU during while loop */
+    unsigned int vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
+    unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+
+    GLCall(glAttachShader(program, vs));                                        /* Attach shader to program to be run by GPU */
+    GLCall(glAttachShader(program, fs));
+    GLCall(glLinkProgram(program));
+    GLCall(glValidateProgram(program));
+    GLCall(glDeleteShader(vs));                                                 /* DELETING shader to save space as shader is already attached to program */
+    GLCall(glDeleteShader(fs));
+
+    return program;
+
+}
+
+
+/* Read file and output vertex and fragment shader source code */
+static ShaderProgramSource ParseShader(const std::string& filepath) {
+
+    std::ifstream stream(filepath);
+
+    enum class ShaderType {
+        NONE = -1, VERTEX = 0, FRAGMENT = 1
+    };
+
+    std::string line;
+    std::stringstream ss[2];
+    ShaderType type = ShaderType::NONE;
+    while (getline(stream, line)) {
+
+        if (line.find("#shader") != std::string::npos) {
+
+            if (line.find("vertex") != std::string::npos)
+                type = ShaderType::VERTEX;
+            else if (line.find("fragment") != std::string::npos)
+                type = ShaderType::FRAGMENT;
+
+        }
+        else {
+            ss[int(type)] << line << '\n';
+        }
+    }
+
+    return { ss[0].str(), ss[1].str() };
+}
@@ -132,7 +132,7 @@ int main(void)
             unsigned int buffer;
             GLCall(glGenBuffers(1, &buffer));
             GLCall(glBindBuffer(GL_ARRAY_BUFFER, buffer));
-            GLCall(glBufferData(GL_ARRAY_BUFFER, 6 * 2 * sizeof(float), positions, GL_STATIC_DRAW));
+            GLCall(glBufferData(GL_ARRAY_BUFFER, 4 * 2 * sizeof(float), positions, GL_STATIC_DRAW));
         
 
 